@@ -11,6 +11,7 @@
 #include "audio_core/audio_core.h"
 #include "audio_core/common/common.h"
 #include "audio_core/sink/sink.h"
+#include "common/allocation_profiler.h"
 #include "common/logging/log.h"
 #include "common/thread.h"
 #include "core/core.h"
@@ -132,6 +133,7 @@ void AudioRenderer::CreateSinkStreams() {
 void AudioRenderer::Main(std::stop_token stop_token) {
     Common::SetCurrentThreadName("DSP_AudioRenderer_Main");
     Common::SetCurrentThreadPriority(Common::ThreadPriority::High);
+    ALLOCATION_SCOPE(Audio);
 
     // TODO: Create buffer map/unmap thread + mailbox
     // TODO: Create gMix devices, initialize them here
@@ -0,0 +1,97 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+// The bounded queues share their names with the ones in threadsafe_queue.h, so they are measured
+// in their own translation unit.
+
+#include <array>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/bounded_threadsafe_queue.h"
+#include "common/common_types.h"
+
+namespace Common {
+namespace {
+
+constexpr u64 NumItems = 1 << 16;
+constexpr u64 NumProducers = 4;
+constexpr size_t BatchSize = 64;
+
+} // Anonymous namespace
+
+TEST_CASE("Bounded SPSCQueue", "[spsc_queue]") {
+    SPSCQueue<u64> queue;
+
+    BENCHMARK("push and pop 4096 on one thread") {
+        for (u64 i = 0; i < 4096; ++i) {
+            queue.TryEmplace(i);
+        }
+        u64 sum = 0;
+        u64 value;
+        while (queue.TryPop(value)) {
+            sum += value;
+        }
+        return sum;
+    };
+
+    // Includes starting the producer thread, amortized over the items.
+    BENCHMARK("transfer 65536 between threads") {
+        std::jthread producer{[&] {
+            for (u64 i = 0; i < NumItems; ++i) {
+                queue.EmplaceWait(i);
+            }
+        }};
+        u64 sum = 0;
+        for (u64 i = 0; i < NumItems; ++i) {
+            sum += queue.PopWait();
+        }
+        return sum;
+    };
+
+    BENCHMARK("transfer 65536 between threads in batches of 64") {
+        std::jthread producer{[&] {
+            std::array<u64, BatchSize> batch;
+            for (u64 i = 0; i < NumItems; i += BatchSize) {
+                std::iota(batch.begin(), batch.end(), i);
+                queue.PushRangeWait(batch);
+            }
+        }};
+        std::array<u64, BatchSize> batch;
+        u64 sum = 0;
+        for (u64 received = 0; received < NumItems;) {
+            const size_t count = queue.PopRangeWait(batch);
+            for (size_t i = 0; i < count; ++i) {
+                sum += batch[i];
+            }
+            received += count;
+        }
+        return sum;
+    };
+}
+
+TEST_CASE("Bounded MPSCQueue", "[mpsc_queue]") {
+    MPSCQueue<u64> queue;
+
+    BENCHMARK("transfer 65536 from 4 threads") {
+        std::vector<std::jthread> producers;
+        for (u64 producer = 0; producer < NumProducers; ++producer) {
+            producers.emplace_back([&] {
+                for (u64 i = 0; i < NumItems / NumProducers; ++i) {
+                    queue.EmplaceWait(i);
+                }
+            });
+        }
+        u64 sum = 0;
+        for (u64 i = 0; i < NumItems; ++i) {
+            sum += queue.PopWait();
+        }
+        return sum;
+    };
+}
+
+} // namespace Common
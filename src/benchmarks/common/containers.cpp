@@ -0,0 +1,396 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include <boost/icl/interval_set.hpp>
+#include <boost/icl/split_interval_map.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "common/lru_cache.h"
+#include "common/multi_level_page_table.h"
+#include "common/range_map.h"
+#include "common/range_sets.h"
+#include "common/range_sets.inc"
+#include "common/scratch_buffer.h"
+#include "common/slot_vector.h"
+
+namespace Common {
+namespace {
+
+constexpr size_t NumElements = 4096;
+constexpr u64 Seed = 0x1234'5678'9abc'def0ULL;
+
+/// Addresses of `count` page aligned ranges spread over a 4 GiB address space.
+std::vector<u64> RandomAddresses(size_t count) {
+    std::mt19937_64 rng{Seed};
+    std::uniform_int_distribution<u64> page{0, (u64{4} << 30) / 0x1000 - 1};
+    std::vector<u64> addresses(count);
+    for (u64& address : addresses) {
+        address = page(rng) * 0x1000;
+    }
+    return addresses;
+}
+
+/// Indices in [0, count) visited in a shuffled order.
+std::vector<size_t> ShuffledIndices(size_t count) {
+    std::vector<size_t> indices(count);
+    std::iota(indices.begin(), indices.end(), size_t{0});
+    std::shuffle(indices.begin(), indices.end(), std::mt19937_64{Seed});
+    return indices;
+}
+
+} // Anonymous namespace
+
+TEST_CASE("SlotVector", "[slot_vector]") {
+    const std::vector<size_t> order = ShuffledIndices(NumElements);
+
+    BENCHMARK("insert and erase 4096") {
+        SlotVector<u64> slots;
+        std::vector<SlotId> ids(NumElements);
+        for (size_t i = 0; i < NumElements; ++i) {
+            ids[i] = slots.insert(i);
+        }
+        for (const size_t index : order) {
+            slots.erase(ids[index]);
+        }
+        return slots.size();
+    };
+
+    SlotVector<u64> slots;
+    std::vector<SlotId> ids(NumElements);
+    for (size_t i = 0; i < NumElements; ++i) {
+        ids[i] = slots.insert(i);
+    }
+    // Leave holes so iteration has to skip free slots.
+    for (size_t i = 0; i < NumElements; i += 4) {
+        slots.erase(ids[order[i]]);
+        ids[order[i]] = SlotId{};
+    }
+
+    BENCHMARK("random lookup 4096") {
+        u64 sum = 0;
+        for (const size_t index : order) {
+            if (ids[index]) {
+                sum += slots[ids[index]];
+            }
+        }
+        return sum;
+    };
+
+    BENCHMARK("iterate 4096") {
+        u64 sum = 0;
+        for (const auto [id, value] : slots) {
+            sum += *value;
+        }
+        return sum;
+    };
+}
+
+TEST_CASE("RangeMap", "[range_map]") {
+    const std::vector<u64> addresses = RandomAddresses(NumElements);
+
+    BENCHMARK("map 4096 ranges") {
+        RangeMap<u64, u32> map{0};
+        for (size_t i = 0; i < addresses.size(); ++i) {
+            map.Map(addresses[i], addresses[i] + 0x3000, static_cast<u32>(i % 7 + 1));
+        }
+        return map.GetValueAt(static_cast<s64>(addresses[0]));
+    };
+
+    RangeMap<u64, u32> map{0};
+    for (size_t i = 0; i < addresses.size(); ++i) {
+        map.Map(addresses[i], addresses[i] + 0x3000, static_cast<u32>(i % 7 + 1));
+    }
+
+    BENCHMARK("lookup 4096") {
+        u64 sum = 0;
+        for (const u64 address : addresses) {
+            sum += map.GetValueAt(static_cast<s64>(address + 0x1000));
+        }
+        return sum;
+    };
+
+    BENCHMARK("continuous size 4096") {
+        size_t sum = 0;
+        for (const u64 address : addresses) {
+            sum += map.GetContinuousSizeFrom(address);
+        }
+        return sum;
+    };
+}
+
+TEST_CASE("RangeSet", "[range_set]") {
+    const std::vector<u64> addresses = RandomAddresses(NumElements);
+
+    BENCHMARK("add 4096 ranges") {
+        RangeSet<u64> set;
+        for (const u64 address : addresses) {
+            set.Add(address, 0x3000);
+        }
+        return set.Empty();
+    };
+
+    BENCHMARK("add and subtract 4096 ranges") {
+        RangeSet<u64> set;
+        for (const u64 address : addresses) {
+            set.Add(address, 0x3000);
+        }
+        for (const u64 address : addresses) {
+            set.Subtract(address + 0x1000, 0x1000);
+        }
+        return set.Empty();
+    };
+
+    RangeSet<u64> set;
+    for (const u64 address : addresses) {
+        set.Add(address, 0x3000);
+    }
+
+    BENCHMARK("for each in 1 MiB range 4096") {
+        u64 sum = 0;
+        for (const u64 address : addresses) {
+            set.ForEachInRange(address, 1 << 20, [&](u64 begin, u64 end) { sum += end - begin; });
+        }
+        return sum;
+    };
+
+    BENCHMARK("for each") {
+        u64 sum = 0;
+        set.ForEach([&](u64 begin, u64 end) { sum += end - begin; });
+        return sum;
+    };
+
+    RangeSet<u64> other;
+    for (const u64 address : RandomAddresses(NumElements / 4)) {
+        other.Add(address + 0x2000, 0x2000);
+    }
+
+    BENCHMARK("subtract set of 1024 from 4096") {
+        RangeSet<u64> local;
+        for (const u64 address : addresses) {
+            local.Add(address, 0x3000);
+        }
+        local.Subtract(other);
+        return local.Empty();
+    };
+
+    BENCHMARK("add set of 1024 to 4096") {
+        RangeSet<u64> local;
+        for (const u64 address : addresses) {
+            local.Add(address, 0x3000);
+        }
+        local.Add(other);
+        return local.Empty();
+    };
+
+    // The boost::icl container RangeSet used to be built on.
+    using IclSet = boost::icl::interval_set<u64>;
+    using IclInterval = IclSet::interval_type;
+
+    BENCHMARK("add 4096 ranges (boost::icl reference)") {
+        IclSet icl_set;
+        for (const u64 address : addresses) {
+            icl_set.add(IclInterval{address, address + 0x3000});
+        }
+        return icl_set.empty();
+    };
+
+    BENCHMARK("add and subtract 4096 ranges (boost::icl reference)") {
+        IclSet icl_set;
+        for (const u64 address : addresses) {
+            icl_set.add(IclInterval{address, address + 0x3000});
+        }
+        for (const u64 address : addresses) {
+            icl_set.subtract(IclInterval{address + 0x1000, address + 0x2000});
+        }
+        return icl_set.empty();
+    };
+
+    IclSet icl_set;
+    for (const u64 address : addresses) {
+        icl_set.add(IclInterval{address, address + 0x3000});
+    }
+
+    BENCHMARK("for each in 1 MiB range 4096 (boost::icl reference)") {
+        u64 sum = 0;
+        for (const u64 address : addresses) {
+            const IclInterval search{address, address + (1 << 20)};
+            const auto end = icl_set.upper_bound(search);
+            for (auto it = icl_set.lower_bound(search); it != end; ++it) {
+                sum += std::min(it->upper(), search.upper()) - std::max(it->lower(), address);
+            }
+        }
+        return sum;
+    };
+}
+
+TEST_CASE("OverlapRangeSet", "[range_set]") {
+    const std::vector<u64> addresses = RandomAddresses(NumElements);
+
+    BENCHMARK("add 8192 overlapping ranges") {
+        OverlapRangeSet<u64> set;
+        for (const u64 address : addresses) {
+            set.Add(address, 0x3000);
+            set.Add(address + 0x1000, 0x3000);
+        }
+        return set.Empty();
+    };
+
+    BENCHMARK("add and subtract 4096 overlapping ranges") {
+        OverlapRangeSet<u64> set;
+        for (const u64 address : addresses) {
+            set.Add(address, 0x3000);
+            set.Add(address + 0x1000, 0x3000);
+        }
+        for (const u64 address : addresses) {
+            set.Subtract(address, 0x3000);
+        }
+        return set.Empty();
+    };
+
+    using IclMap = boost::icl::split_interval_map<u64, s32, boost::icl::partial_enricher, std::less,
+                                                  boost::icl::inplace_plus,
+                                                  boost::icl::inter_section>;
+    using IclInterval = IclMap::interval_type;
+
+    BENCHMARK("add 8192 overlapping ranges (boost::icl reference)") {
+        IclMap map;
+        for (const u64 address : addresses) {
+            map += std::make_pair(IclInterval{address, address + 0x3000}, 1);
+            map += std::make_pair(IclInterval{address + 0x1000, address + 0x4000}, 1);
+        }
+        return map.empty();
+    };
+}
+
+TEST_CASE("LeastRecentlyUsedCache", "[lru_cache]") {
+    struct Traits {
+        using ObjectType = u32;
+        using TickType = u64;
+    };
+    const std::vector<size_t> order = ShuffledIndices(NumElements);
+
+    LeastRecentlyUsedCache<Traits> cache;
+    std::vector<size_t> ids(NumElements);
+    for (size_t i = 0; i < NumElements; ++i) {
+        ids[i] = cache.Insert(static_cast<u32>(i), 0);
+    }
+    u64 tick = 0;
+
+    BENCHMARK("touch 4096") {
+        ++tick;
+        for (const size_t index : order) {
+            cache.Touch(ids[index], tick);
+        }
+        return tick;
+    };
+
+    BENCHMARK("insert and free 4096") {
+        LeastRecentlyUsedCache<Traits> local;
+        std::vector<size_t> local_ids(NumElements);
+        for (size_t i = 0; i < NumElements; ++i) {
+            local_ids[i] = local.Insert(static_cast<u32>(i), i);
+        }
+        for (const size_t index : order) {
+            local.Free(local_ids[index]);
+        }
+        return local_ids.back();
+    };
+
+    BENCHMARK("walk oldest half") {
+        u64 sum = 0;
+        cache.ForEachItemBelow(tick, [&](u32 object) {
+            sum += object;
+            return sum > NumElements * NumElements / 4;
+        });
+        return sum;
+    };
+}
+
+TEST_CASE("ScratchBuffer", "[scratch_buffer]") {
+    std::mt19937_64 rng{Seed};
+    std::uniform_int_distribution<size_t> size{1, 64 * 1024};
+    std::vector<size_t> sizes(256);
+    for (size_t& value : sizes) {
+        value = size(rng);
+    }
+
+    ScratchBuffer<u8> buffer;
+    BENCHMARK("resize_destructive 256 sizes") {
+        size_t sum = 0;
+        for (const size_t value : sizes) {
+            buffer.resize_destructive(value);
+            sum += buffer.size();
+        }
+        return sum;
+    };
+
+    BENCHMARK("resize 256 sizes") {
+        size_t sum = 0;
+        for (const size_t value : sizes) {
+            buffer.resize(value);
+            sum += buffer.size();
+        }
+        return sum;
+    };
+
+    std::vector<u8> vector;
+    BENCHMARK("std::vector resize 256 sizes (reference)") {
+        size_t sum = 0;
+        for (const size_t value : sizes) {
+            vector.resize(value);
+            sum += vector.size();
+        }
+        return sum;
+    };
+}
+
+TEST_CASE("MultiLevelPageTable", "[multi_level_page_table]") {
+    // Same layout as the GPU memory manager with small pages.
+    constexpr size_t AddressSpaceBits = 40;
+    constexpr size_t PageBits = 12;
+    constexpr size_t FirstLevelBits = AddressSpaceBits + PageBits - 38;
+
+    std::mt19937_64 rng{Seed};
+    std::uniform_int_distribution<u64> page{0, (u64{1} << (AddressSpaceBits - PageBits)) - 1};
+    std::vector<u64> pages(NumElements);
+    for (u64& value : pages) {
+        value = page(rng);
+    }
+
+    BENCHMARK("create and reserve 4096 pages") {
+        MultiLevelPageTable<u32> table{AddressSpaceBits, FirstLevelBits, PageBits};
+        for (const u64 value : pages) {
+            table.ReserveRange(value << PageBits, u64{1} << PageBits);
+        }
+        return table.data();
+    };
+
+    MultiLevelPageTable<u32> table{AddressSpaceBits, FirstLevelBits, PageBits};
+    for (const u64 value : pages) {
+        table.ReserveRange(value << PageBits, u64{1} << PageBits);
+    }
+
+    BENCHMARK("write 4096 pages") {
+        for (const u64 value : pages) {
+            table[value] = static_cast<u32>(value);
+        }
+        return table[pages[0]];
+    };
+
+    BENCHMARK("read 4096 pages") {
+        u64 sum = 0;
+        for (const u64 value : pages) {
+            sum += table[value];
+        }
+        return sum;
+    };
+}
+
+} // namespace Common
@@ -0,0 +1,54 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <memory>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "common/fiber.h"
+
+namespace Common {
+
+TEST_CASE("Fiber", "[fiber]") {
+    std::shared_ptr<Fiber> thread_fiber = Fiber::ThreadToFiber();
+    std::shared_ptr<Fiber> work_fiber;
+    std::shared_ptr<Fiber> other_fiber;
+    u64 switches = 0;
+
+    // Work fibers never return, they are destroyed while suspended like guest thread fibers.
+    work_fiber = std::make_shared<Fiber>([&] {
+        while (true) {
+            ++switches;
+            Fiber::YieldTo(work_fiber, *thread_fiber);
+        }
+    });
+    other_fiber = std::make_shared<Fiber>([&] {
+        while (true) {
+            ++switches;
+            Fiber::YieldTo(other_fiber, *work_fiber);
+        }
+    });
+
+    BENCHMARK("thread to work round trip") {
+        Fiber::YieldTo(thread_fiber, *work_fiber);
+        return switches;
+    };
+
+    BENCHMARK("work to work round trip") {
+        // Thread -> other -> work -> thread, the way the kernel hops between guest threads.
+        Fiber::YieldTo(thread_fiber, *other_fiber);
+        return switches;
+    };
+
+    BENCHMARK("create and destroy") {
+        return std::make_shared<Fiber>([] {});
+    };
+
+    work_fiber.reset();
+    other_fiber.reset();
+    thread_fiber->Exit();
+}
+
+} // namespace Common
@@ -0,0 +1,71 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <thread>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "common/threadsafe_queue.h"
+
+namespace Common {
+namespace {
+
+constexpr u64 NumItems = 1 << 16;
+constexpr u64 NumProducers = 4;
+
+} // Anonymous namespace
+
+TEST_CASE("SPSCQueue", "[spsc_queue]") {
+    SPSCQueue<u64> queue;
+
+    BENCHMARK("push and pop 4096 on one thread") {
+        for (u64 i = 0; i < 4096; ++i) {
+            queue.Push(i);
+        }
+        u64 sum = 0;
+        u64 value;
+        while (queue.Pop(value)) {
+            sum += value;
+        }
+        return sum;
+    };
+
+    // Includes starting the producer thread, amortized over the items.
+    BENCHMARK("transfer 65536 between threads") {
+        std::jthread producer{[&] {
+            for (u64 i = 0; i < NumItems; ++i) {
+                queue.Push(i);
+            }
+        }};
+        u64 sum = 0;
+        for (u64 i = 0; i < NumItems; ++i) {
+            sum += queue.PopWait();
+        }
+        return sum;
+    };
+}
+
+TEST_CASE("MPSCQueue", "[mpsc_queue]") {
+    MPSCQueue<u64> queue;
+
+    BENCHMARK("transfer 65536 from 4 threads") {
+        std::vector<std::jthread> producers;
+        for (u64 producer = 0; producer < NumProducers; ++producer) {
+            producers.emplace_back([&] {
+                for (u64 i = 0; i < NumItems / NumProducers; ++i) {
+                    queue.Push(i);
+                }
+            });
+        }
+        u64 sum = 0;
+        for (u64 i = 0; i < NumItems; ++i) {
+            sum += queue.PopWait();
+        }
+        return sum;
+    };
+}
+
+} // namespace Common
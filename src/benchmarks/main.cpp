@@ -0,0 +1,106 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+// Microbenchmarks of the common containers and primitives.
+//
+// All Catch2 options apply, e.g. `eden-bench "[slot_vector]" --benchmark-samples 50`. With
+// `--json <file>` the results are also written as JSON, to be compared between runs.
+
+#include <chrono>
+#include <cstdio>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <catch2/catch_session.hpp>
+#include <catch2/reporters/catch_reporter_event_listener.hpp>
+#include <catch2/reporters/catch_reporter_registrars.hpp>
+#include <nlohmann/json.hpp>
+
+#include "common/scm_rev.h"
+#ifdef ARCHITECTURE_x86_64
+#include "common/x64/cpu_detect.h"
+#endif
+
+namespace {
+
+using nlohmann::json;
+
+json results = json::array();
+
+class JsonCollector final : public Catch::EventListenerBase {
+public:
+    using EventListenerBase::EventListenerBase;
+
+    void testCaseStarting(const Catch::TestCaseInfo& info) override {
+        test_case = info.name;
+    }
+
+    void benchmarkEnded(const Catch::BenchmarkStats<>& stats) override {
+        results.push_back({
+            {"test_case", test_case},
+            {"name", stats.info.name},
+            {"samples", stats.info.samples},
+            {"iterations", stats.info.iterations},
+            {"mean_ns", stats.mean.point.count()},
+            {"mean_lower_ns", stats.mean.lower_bound.count()},
+            {"mean_upper_ns", stats.mean.upper_bound.count()},
+            {"std_dev_ns", stats.standardDeviation.point.count()},
+            {"outlier_variance", stats.outlierVariance},
+        });
+    }
+
+private:
+    std::string test_case;
+};
+
+std::string GetTimestamp() {
+    const auto time = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
+    std::ostringstream oss;
+    oss << std::put_time(std::gmtime(&time), "%FT%TZ");
+    return oss.str();
+}
+
+json GetContext() {
+    json context{
+        {"build_fullname", std::string(Common::g_build_fullname)},
+        {"scm_rev", std::string(Common::g_scm_rev)},
+        {"timestamp", GetTimestamp()},
+    };
+#ifdef ARCHITECTURE_x86_64
+    context["cpu"] = std::string(Common::GetCPUCaps().cpu_string);
+#endif
+    return context;
+}
+
+} // Anonymous namespace
+
+CATCH_REGISTER_LISTENER(JsonCollector)
+
+int main(int argc, char* argv[]) {
+    Catch::Session session;
+
+    std::string json_path;
+    using Catch::Clara::Opt;
+    session.cli(session.cli() |
+                Opt(json_path, "file")["--json"]("also write the benchmark results as JSON"));
+
+    if (const int result = session.applyCommandLine(argc, argv); result != 0) {
+        return result;
+    }
+    const int result = session.run();
+
+    if (!json_path.empty()) {
+        std::ofstream file{json_path, std::ios_base::out | std::ios_base::trunc};
+        if (!file) {
+            std::fprintf(stderr, "Could not open %s\n", json_path.c_str());
+            return 1;
+        }
+        file << std::setw(4) << json{{"context", GetContext()}, {"benchmarks", results}}
+             << std::endl;
+    }
+    return result;
+}
@@ -0,0 +1,424 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "common/allocation_profiler.h"
+
+#ifdef YUZU_ALLOCATION_PROFILER
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <mutex>
+#include <new>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#ifdef _WIN32
+#include <intrin.h>
+#include <malloc.h>
+#else
+#include <dlfcn.h>
+#endif
+
+#include <fmt/format.h>
+
+#include "common/demangle.h"
+#include "common/logging/log.h"
+#include "common/tracing.h"
+
+#endif
+
+namespace Common::AllocationProfiler {
+
+namespace detail {
+thread_local Subsystem current_subsystem = Subsystem::Other;
+} // namespace detail
+
+#ifdef YUZU_ALLOCATION_PROFILER
+
+namespace {
+
+constexpr size_t NumSubsystems = static_cast<size_t>(Subsystem::Count);
+
+/// Call sites tracked per thread, allocations from sites that do not fit are only counted.
+constexpr size_t CallSiteSlots = 2048;
+constexpr size_t MaxProbes = 16;
+
+/// Threads past this share one record.
+constexpr size_t MaxThreads = 1024;
+
+/// How many frames each periodic log line averages over.
+constexpr u64 SummaryFrames = 600;
+
+constexpr size_t ReportCallSites = 25;
+
+constexpr std::array<const char*, NumSubsystems> SubsystemNames{
+    "Other",     "Kernel",       "Service",     "CoreTiming", "Audio",
+    "GPUThread", "TextureCache", "BufferCache", "Shader",     "Renderer",
+};
+
+struct Counters {
+    std::atomic<u64> count;
+    std::atomic<u64> bytes;
+};
+
+struct CallSite {
+    std::atomic<uintptr_t> address;
+    std::atomic<u8> subsystem;
+    Counters counters;
+};
+
+/// Written by its thread with relaxed atomics, read by whoever builds a report.
+struct ThreadRecord {
+    std::array<Counters, NumSubsystems> subsystems;
+    std::array<CallSite, CallSiteSlots> call_sites;
+    std::atomic<u64> untracked_call_sites;
+};
+
+// Records are never freed so the report still covers threads that have exited. They are allocated
+// with calloc, allocating through operator new would recurse.
+std::array<std::atomic<ThreadRecord*>, MaxThreads> thread_records{};
+std::atomic<size_t> num_thread_records{0};
+ThreadRecord shared_record{};
+
+thread_local ThreadRecord* current_record = nullptr;
+
+ThreadRecord& CurrentRecord() {
+    if (current_record) [[likely]] {
+        return *current_record;
+    }
+    const size_t index = num_thread_records.fetch_add(1, std::memory_order::relaxed);
+    if (index >= MaxThreads) {
+        current_record = &shared_record;
+        return shared_record;
+    }
+    void* const storage = std::calloc(1, sizeof(ThreadRecord));
+    if (!storage) {
+        current_record = &shared_record;
+        return shared_record;
+    }
+    current_record = new (storage) ThreadRecord{};
+    thread_records[index].store(current_record, std::memory_order::release);
+    return *current_record;
+}
+
+void Add(Counters& counters, size_t size) {
+    counters.count.fetch_add(1, std::memory_order::relaxed);
+    counters.bytes.fetch_add(size, std::memory_order::relaxed);
+}
+
+void Record(size_t size, uintptr_t call_site) {
+    ThreadRecord& record = CurrentRecord();
+    const Subsystem subsystem = detail::current_subsystem;
+    Add(record.subsystems[static_cast<size_t>(subsystem)], size);
+
+    const size_t hash = static_cast<size_t>((call_site >> 2) * 0x9E3779B97F4A7C15ULL);
+    for (size_t probe = 0; probe < MaxProbes; ++probe) {
+        CallSite& slot = record.call_sites[(hash + probe) % CallSiteSlots];
+        uintptr_t address = slot.address.load(std::memory_order::relaxed);
+        if (address == 0 && slot.address.compare_exchange_strong(address, call_site,
+                                                                 std::memory_order::relaxed)) {
+            slot.subsystem.store(static_cast<u8>(subsystem), std::memory_order::relaxed);
+            address = call_site;
+        }
+        if (address == call_site) {
+            Add(slot.counters, size);
+            return;
+        }
+    }
+    record.untracked_call_sites.fetch_add(1, std::memory_order::relaxed);
+}
+
+template <typename Func>
+void ForEachRecord(Func&& func) {
+    const size_t count = std::min(num_thread_records.load(std::memory_order::relaxed), MaxThreads);
+    for (size_t i = 0; i < count; ++i) {
+        // A thread may have claimed its index but not published the record yet.
+        if (const ThreadRecord* record = thread_records[i].load(std::memory_order::acquire)) {
+            func(*record);
+        }
+    }
+    func(shared_record);
+}
+
+struct Totals {
+    std::array<u64, NumSubsystems> count{};
+    std::array<u64, NumSubsystems> bytes{};
+};
+
+Totals CollectTotals() {
+    Totals totals;
+    ForEachRecord([&](const ThreadRecord& record) {
+        for (size_t i = 0; i < NumSubsystems; ++i) {
+            totals.count[i] += record.subsystems[i].count.load(std::memory_order::relaxed);
+            totals.bytes[i] += record.subsystems[i].bytes.load(std::memory_order::relaxed);
+        }
+    });
+    return totals;
+}
+
+std::string DescribeAddress(uintptr_t address) {
+#ifdef _WIN32
+    return fmt::format("{:#x}", address);
+#else
+    Dl_info info{};
+    if (dladdr(reinterpret_cast<void*>(address), &info) == 0 || !info.dli_fname) {
+        return fmt::format("{:#x}", address);
+    }
+    const uintptr_t base = reinterpret_cast<uintptr_t>(info.dli_fbase);
+    std::string description = fmt::format("{}+{:#x}", info.dli_fname, address - base);
+    if (info.dli_sname) {
+        description += fmt::format(" ({})", DemangleSymbol(info.dli_sname));
+    }
+    return description;
+#endif
+}
+
+struct FrameState {
+    std::mutex mutex;
+    Totals previous;
+    Totals window_start;
+    u64 frames = 0;
+    u64 window_frames = 0;
+    u64 peak_count = 0;
+};
+
+FrameState& GetFrameState() {
+    static FrameState state;
+    return state;
+}
+
+void* Allocate(size_t size, uintptr_t call_site) {
+    Record(size, call_site);
+    return std::malloc(size != 0 ? size : 1);
+}
+
+void* AllocateAligned(size_t size, std::align_val_t alignment, uintptr_t call_site) {
+    Record(size, call_site);
+    const size_t align = static_cast<size_t>(alignment);
+#ifdef _WIN32
+    return _aligned_malloc(size != 0 ? size : 1, align);
+#else
+    // aligned_alloc wants the size to be a multiple of the alignment.
+    return std::aligned_alloc(align, (std::max<size_t>(size, 1) + align - 1) & ~(align - 1));
+#endif
+}
+
+void FreeAligned(void* pointer) {
+#ifdef _WIN32
+    _aligned_free(pointer);
+#else
+    std::free(pointer);
+#endif
+}
+
+} // Anonymous namespace
+
+void EndFrame() {
+    FrameState& state = GetFrameState();
+    std::scoped_lock lock{state.mutex};
+    const Totals totals = CollectTotals();
+
+    u64 frame_count = 0;
+    u64 frame_bytes = 0;
+    for (size_t i = 0; i < NumSubsystems; ++i) {
+        const u64 count = totals.count[i] - state.previous.count[i];
+        frame_count += count;
+        frame_bytes += totals.bytes[i] - state.previous.bytes[i];
+        TRACE_COUNTER("alloc", SubsystemNames[i], count);
+    }
+    TRACE_COUNTER("alloc", "Allocations per frame", frame_count);
+    TRACE_COUNTER("alloc", "Bytes per frame", frame_bytes);
+    state.previous = totals;
+    state.peak_count = std::max(state.peak_count, frame_count);
+    ++state.frames;
+
+    if (++state.window_frames < SummaryFrames) {
+        return;
+    }
+    std::string breakdown;
+    for (size_t i = 0; i < NumSubsystems; ++i) {
+        const u64 count = totals.count[i] - state.window_start.count[i];
+        if (count == 0) {
+            continue;
+        }
+        const u64 bytes = totals.bytes[i] - state.window_start.bytes[i];
+        breakdown += fmt::format(" {}={:.1f} ({} B)", SubsystemNames[i],
+                                 static_cast<double>(count) / state.window_frames,
+                                 bytes / state.window_frames);
+    }
+    LOG_INFO(Common_Memory, "Allocations per frame over {} frames, peak {}:{}",
+             state.window_frames, state.peak_count, breakdown);
+    state.window_start = totals;
+    state.window_frames = 0;
+    state.peak_count = 0;
+}
+
+void LogReport() {
+    const Totals totals = CollectTotals();
+    const u64 frames = std::max<u64>(GetFrameState().frames, 1);
+    LOG_INFO(Common_Memory, "Allocations over {} frames:", GetFrameState().frames);
+    for (size_t i = 0; i < NumSubsystems; ++i) {
+        if (totals.count[i] == 0) {
+            continue;
+        }
+        LOG_INFO(Common_Memory, "  {:<12} {:>10} allocations {:>12} bytes, {:.1f} per frame",
+                 SubsystemNames[i], totals.count[i], totals.bytes[i],
+                 static_cast<double>(totals.count[i]) / frames);
+    }
+
+    struct SiteTotals {
+        u64 count = 0;
+        u64 bytes = 0;
+        u8 subsystem = 0;
+    };
+    std::unordered_map<uintptr_t, SiteTotals> sites;
+    u64 untracked = 0;
+    ForEachRecord([&](const ThreadRecord& record) {
+        for (const CallSite& slot : record.call_sites) {
+            const uintptr_t address = slot.address.load(std::memory_order::relaxed);
+            if (address == 0) {
+                continue;
+            }
+            SiteTotals& site = sites[address];
+            site.count += slot.counters.count.load(std::memory_order::relaxed);
+            site.bytes += slot.counters.bytes.load(std::memory_order::relaxed);
+            site.subsystem = slot.subsystem.load(std::memory_order::relaxed);
+        }
+        untracked += record.untracked_call_sites.load(std::memory_order::relaxed);
+    });
+    std::vector<std::pair<uintptr_t, SiteTotals>> sorted(sites.begin(), sites.end());
+    const size_t num_reported = std::min(sorted.size(), ReportCallSites);
+    std::partial_sort(sorted.begin(), sorted.begin() + num_reported, sorted.end(),
+                      [](const auto& lhs, const auto& rhs) {
+                          return lhs.second.count > rhs.second.count;
+                      });
+    LOG_INFO(Common_Memory, "Busiest of {} call sites ({} allocations from untracked sites):",
+             sites.size(), untracked);
+    for (size_t i = 0; i < num_reported; ++i) {
+        const auto& [address, site] = sorted[i];
+        LOG_INFO(Common_Memory, "  {:>10} allocations {:>12} bytes [{}] {}", site.count,
+                 site.bytes, SubsystemNames[site.subsystem], DescribeAddress(address));
+    }
+}
+
+#else
+
+void EndFrame() {}
+
+void LogReport() {}
+
+#endif
+
+} // namespace Common::AllocationProfiler
+
+#ifdef YUZU_ALLOCATION_PROFILER
+
+#ifdef _MSC_VER
+#define CALL_SITE() reinterpret_cast<uintptr_t>(_ReturnAddress())
+#else
+#define CALL_SITE() reinterpret_cast<uintptr_t>(__builtin_return_address(0))
+#endif
+
+using Common::AllocationProfiler::Allocate;
+using Common::AllocationProfiler::AllocateAligned;
+using Common::AllocationProfiler::FreeAligned;
+
+void* operator new(std::size_t size) {
+    if (void* const pointer = Allocate(size, CALL_SITE())) {
+        return pointer;
+    }
+    throw std::bad_alloc{};
+}
+
+void* operator new[](std::size_t size) {
+    if (void* const pointer = Allocate(size, CALL_SITE())) {
+        return pointer;
+    }
+    throw std::bad_alloc{};
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    return Allocate(size, CALL_SITE());
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    return Allocate(size, CALL_SITE());
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    if (void* const pointer = AllocateAligned(size, alignment, CALL_SITE())) {
+        return pointer;
+    }
+    throw std::bad_alloc{};
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+    if (void* const pointer = AllocateAligned(size, alignment, CALL_SITE())) {
+        return pointer;
+    }
+    throw std::bad_alloc{};
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return AllocateAligned(size, alignment, CALL_SITE());
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment,
+                     const std::nothrow_t&) noexcept {
+    return AllocateAligned(size, alignment, CALL_SITE());
+}
+
+void operator delete(void* pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete[](void* pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept {
+    std::free(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, const std::nothrow_t&) noexcept {
+    std::free(pointer);
+}
+
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, std::align_val_t) noexcept {
+    FreeAligned(pointer);
+}
+
+void operator delete[](void* pointer, std::align_val_t) noexcept {
+    FreeAligned(pointer);
+}
+
+void operator delete(void* pointer, std::size_t, std::align_val_t) noexcept {
+    FreeAligned(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t, std::align_val_t) noexcept {
+    FreeAligned(pointer);
+}
+
+void operator delete(void* pointer, std::align_val_t, const std::nothrow_t&) noexcept {
+    FreeAligned(pointer);
+}
+
+void operator delete[](void* pointer, std::align_val_t, const std::nothrow_t&) noexcept {
+    FreeAligned(pointer);
+}
+
+#undef CALL_SITE
+
+#endif
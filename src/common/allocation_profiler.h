@@ -0,0 +1,75 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include "common/common_funcs.h"
+#include "common/common_types.h"
+
+/**
+ * Counts heap allocations by the subsystem that made them, for finding allocations to eliminate
+ * from the frame loop.
+ *
+ * Only builds with YUZU_ALLOCATION_PROFILER defined replace the global operator new and record
+ * anything. Code tags its allocations with ALLOCATION_SCOPE, which compiles to nothing otherwise.
+ * Allocations outside of any scope are counted as Other, nested scopes attribute to the innermost.
+ */
+namespace Common::AllocationProfiler {
+
+enum class Subsystem : u8 {
+    Other,
+    Kernel,
+    Service,
+    CoreTiming,
+    Audio,
+    GPUThread,
+    TextureCache,
+    BufferCache,
+    Shader,
+    Renderer,
+    Count,
+};
+
+namespace detail {
+extern thread_local Subsystem current_subsystem;
+} // namespace detail
+
+/// Attributes the allocations of the calling thread to a subsystem while in scope.
+class ScopedSubsystem {
+public:
+    explicit ScopedSubsystem(Subsystem subsystem) : previous{detail::current_subsystem} {
+        detail::current_subsystem = subsystem;
+    }
+
+    ~ScopedSubsystem() {
+        detail::current_subsystem = previous;
+    }
+
+    ScopedSubsystem(const ScopedSubsystem&) = delete;
+    ScopedSubsystem& operator=(const ScopedSubsystem&) = delete;
+
+private:
+    Subsystem previous;
+};
+
+/// Marks the end of a presented frame, publishes the frame's allocations as trace counters and
+/// periodically logs the average per frame.
+void EndFrame();
+
+/// Logs the allocations of each subsystem since startup and the busiest call sites.
+void LogReport();
+
+} // namespace Common::AllocationProfiler
+
+#ifdef YUZU_ALLOCATION_PROFILER
+
+#define ALLOCATION_SCOPE(subsystem)                                                                \
+    const ::Common::AllocationProfiler::ScopedSubsystem CONCAT2(allocation_scope_, __LINE__) {     \
+        ::Common::AllocationProfiler::Subsystem::subsystem                                         \
+    }
+
+#else
+
+#define ALLOCATION_SCOPE(subsystem) static_cast<void>(0)
+
+#endif
@@ -5,18 +5,84 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <atomic>
 #include <condition_variable>
 #include <cstddef>
+#include <memory>
 #include <mutex>
-#include <new>
+#include <span>
 
+#include "common/common_types.h"
 #include "common/polyfill_thread.h"
+#include "common/thread_pause.h"
 
 namespace Common {
 
 namespace detail {
 constexpr size_t DefaultCapacity = 0x1000;
+
+/**
+ * Where one side of a queue waits for the other side to make progress.
+ * Waiting spins for a while before parking on a condition variable (a futex on Linux). The spin
+ * budget grows when spinning was enough and shrinks when it was not. Notifying is a fence and a
+ * load unless the waiting side is actually parked. Only one thread may wait at a time.
+ */
+class AdaptiveWaiter {
+public:
+    template <typename Predicate>
+    void Wait(Predicate&& pred) noexcept {
+        for (u32 spin = 0; spin < spin_limit; ++spin) {
+            if (pred()) {
+                spin_limit = std::min(spin_limit * 2, MaxSpins);
+                return;
+            }
+            ThreadPause();
+        }
+        spin_limit = std::max(spin_limit / 2, MinSpins) & spin_mask;
+        while (!pred()) {
+            std::unique_lock lock{mutex};
+            sleepers.fetch_add(1, std::memory_order::relaxed);
+            // Pairs with the fence in Notify, either we see the update or the notifier sees us.
+            std::atomic_thread_fence(std::memory_order::seq_cst);
+            if (!pred()) {
+                cv.wait(lock);
+            }
+            sleepers.fetch_sub(1, std::memory_order::relaxed);
+        }
+    }
+
+    /// Wakes the waiting side if it is parked, called after publishing an update.
+    void Notify() noexcept {
+        std::atomic_thread_fence(std::memory_order::seq_cst);
+        if (sleepers.load(std::memory_order::relaxed) != 0) {
+            Wake();
+        }
+    }
+
+    /// Unconditionally wakes the waiting side so it re-evaluates its predicate.
+    void Wake() noexcept {
+        // Holding the lock makes sure a waiter that saw no update is already inside wait.
+        std::scoped_lock lock{mutex};
+        cv.notify_one();
+    }
+
+private:
+    static constexpr u32 MinSpins = 16;
+    static constexpr u32 MaxSpins = 1024;
+
+    /// Spinning cannot succeed when the other side has no core to run on.
+    static u32 SpinMask() noexcept {
+        return CanSpinWait() ? ~u32{0} : 0;
+    }
+
+    std::atomic<u32> sleepers{0};
+    std::mutex mutex;
+    std::condition_variable cv;
+    u32 spin_mask{SpinMask()};
+    u32 spin_limit{128 & spin_mask};
+};
 } // namespace detail
 
 template <typename T, size_t Capacity = detail::DefaultCapacity>
@@ -34,6 +100,17 @@ public:
         Emplace<PushMode::Wait>(std::forward<Args>(args)...);
     }
 
+    /// Moves as many items as fit into the queue, publishing them at once.
+    /// Returns the number of items pushed.
+    size_t TryPushRange(std::span<T> items) noexcept {
+        return PushRange<PushMode::Try>(items);
+    }
+
+    /// Moves all items into the queue, waiting for free slots as needed.
+    void PushRangeWait(std::span<T> items) noexcept {
+        PushRange<PushMode::Wait>(items);
+    }
+
     bool TryPop(T& t) noexcept {
         return Pop<PopMode::Try>(t);
     }
@@ -58,6 +135,22 @@ public:
         return t;
     }
 
+    /// Moves up to out.size() items off the queue, releasing their slots at once.
+    /// Returns the number of items popped.
+    size_t TryPopRange(std::span<T> out) noexcept {
+        return PopRange<PopMode::Try>(out);
+    }
+
+    /// Waits until the queue is not empty, then pops up to out.size() items.
+    size_t PopRangeWait(std::span<T> out) noexcept {
+        return PopRange<PopMode::Wait>(out);
+    }
+
+    /// Like PopRangeWait, returns zero when a stop is requested.
+    size_t PopRangeWait(std::span<T> out, const std::stop_token stop_token) noexcept {
+        return PopRange<PopMode::WaitWithStopToken>(out, stop_token);
+    }
+
 private:
     enum class PushMode {
         Try,
@@ -72,83 +165,134 @@ private:
         Count,
     };
 
+    /// Free slots at write_index, only reloading the consumer index when fewer than wanted.
+    size_t FreeSlots(size_t write_index, size_t wanted) noexcept {
+        size_t free_slots = Capacity - (write_index - producer.cached_read_index);
+        if (free_slots < wanted) {
+            producer.cached_read_index = consumer.index.load(std::memory_order::acquire);
+            free_slots = Capacity - (write_index - producer.cached_read_index);
+        }
+        return free_slots;
+    }
+
+    /// Filled slots at read_index, only reloading the producer index when fewer than wanted.
+    size_t FilledSlots(size_t read_index, size_t wanted) noexcept {
+        size_t filled_slots = consumer.cached_write_index - read_index;
+        if (filled_slots < wanted) {
+            consumer.cached_write_index = producer.index.load(std::memory_order::acquire);
+            filled_slots = consumer.cached_write_index - read_index;
+        }
+        return filled_slots;
+    }
+
     template <PushMode Mode, typename... Args>
     bool Emplace(Args&&... args) noexcept {
-        const std::size_t write_index = producer.index.load(std::memory_order::relaxed);
-        if constexpr (Mode == PushMode::Try) {
-            // Check if we have free slots to write to.
-            if ((write_index - consumer.index.load(std::memory_order::acquire)) == Capacity) {
+        const size_t write_index = producer.index.load(std::memory_order::relaxed);
+        if (FreeSlots(write_index, 1) == 0) {
+            if constexpr (Mode == PushMode::Try) {
                 return false;
+            } else if constexpr (Mode == PushMode::Wait) {
+                // Wait until we have free slots to write to.
+                producer.waiter.Wait([this, write_index] { return FreeSlots(write_index, 1) != 0; });
+            } else {
+                static_assert(Mode < PushMode::Count, "Invalid PushMode.");
             }
-        } else if constexpr (Mode == PushMode::Wait) {
-            // Wait until we have free slots to write to.
-            std::unique_lock lock{producer.cv_mutex};
-            producer.cv.wait(lock, [this, write_index] {
-                return (write_index - consumer.index.load(std::memory_order::acquire)) < Capacity;
-            });
-        } else {
-            static_assert(Mode < PushMode::Count, "Invalid PushMode.");
         }
-        // Determine the position to write to.
-        const std::size_t pos = write_index % Capacity;
         // Emplace into the queue.
-        std::construct_at(std::addressof(m_data[pos]), std::forward<Args>(args)...);
-        // Increment the write index.
-        ++producer.index;
-        // Notify the consumer that we have pushed into the queue.
-        std::scoped_lock lock{consumer.cv_mutex};
-        consumer.cv.notify_one();
+        std::construct_at(std::addressof(m_data[write_index % Capacity]),
+                          std::forward<Args>(args)...);
+        // Publish the entry and wake the consumer if it is parked.
+        producer.index.store(write_index + 1, std::memory_order::release);
+        consumer.waiter.Notify();
         return true;
     }
 
-    template <PopMode Mode>
-    bool Pop(T& t, [[maybe_unused]] std::stop_token stop_token = {}) noexcept {
-        const std::size_t read_index = consumer.index.load(std::memory_order::relaxed);
-        if constexpr (Mode == PopMode::Try) {
-            // Check if the queue is empty.
-            if (read_index == producer.index.load(std::memory_order::acquire)) {
-                return false;
+    template <PushMode Mode>
+    size_t PushRange(std::span<T> items) noexcept {
+        size_t pushed = 0;
+        while (true) {
+            const size_t write_index = producer.index.load(std::memory_order::relaxed);
+            const size_t remaining = items.size() - pushed;
+            const size_t count = std::min(FreeSlots(write_index, remaining), remaining);
+            for (size_t i = 0; i < count; ++i) {
+                m_data[(write_index + i) % Capacity] = std::move(items[pushed + i]);
             }
-        } else if constexpr (Mode == PopMode::Wait) {
-            // Wait until the queue is not empty.
-            std::unique_lock lock{consumer.cv_mutex};
-            consumer.cv.wait(lock, [this, read_index] {
-                return read_index != producer.index.load(std::memory_order::acquire);
-            });
-        } else if constexpr (Mode == PopMode::WaitWithStopToken) {
-            // Wait until the queue is not empty.
-            std::unique_lock lock{consumer.cv_mutex};
-            consumer.cv.wait(lock, stop_token, [this, read_index] {
-                return read_index != producer.index.load(std::memory_order::acquire);
-            });
-            if (stop_token.stop_requested()) {
-                return false;
+            if (count != 0) {
+                // A single release store publishes the whole batch.
+                producer.index.store(write_index + count, std::memory_order::release);
+                consumer.waiter.Notify();
+                pushed += count;
+            }
+            if constexpr (Mode == PushMode::Try) {
+                return pushed;
+            } else if constexpr (Mode == PushMode::Wait) {
+                if (pushed == items.size()) {
+                    return pushed;
+                }
+                const size_t next_index = write_index + count;
+                producer.waiter.Wait([this, next_index] { return FreeSlots(next_index, 1) != 0; });
+            } else {
+                static_assert(Mode < PushMode::Count, "Invalid PushMode.");
             }
-        } else {
-            static_assert(Mode < PopMode::Count, "Invalid PopMode.");
         }
-        // Determine the position to read from.
-        const std::size_t pos = read_index % Capacity;
-        // Pop the data off the queue, moving it.
-        t = std::move(m_data[pos]);
-        // Increment the read index.
-        ++consumer.index;
-        // Notify the producer that we have popped off the queue.
-        std::scoped_lock lock{producer.cv_mutex};
-        producer.cv.notify_one();
-        return true;
+    }
+
+    template <PopMode Mode>
+    bool Pop(T& t, std::stop_token stop_token = {}) noexcept {
+        return PopRange<Mode>(std::span<T>{std::addressof(t), 1}, stop_token) != 0;
+    }
+
+    template <PopMode Mode>
+    size_t PopRange(std::span<T> out, [[maybe_unused]] std::stop_token stop_token = {}) noexcept {
+        if (out.empty()) {
+            return 0;
+        }
+        const size_t read_index = consumer.index.load(std::memory_order::relaxed);
+        size_t count = FilledSlots(read_index, out.size());
+        if (count == 0) {
+            const auto has_entries = [this, read_index, &out, &count] {
+                count = FilledSlots(read_index, out.size());
+                return count != 0;
+            };
+            if constexpr (Mode == PopMode::Try) {
+                return 0;
+            } else if constexpr (Mode == PopMode::Wait) {
+                // Wait until the queue is not empty.
+                consumer.waiter.Wait(has_entries);
+            } else if constexpr (Mode == PopMode::WaitWithStopToken) {
+                // Wait until the queue is not empty, a stop request wakes us up as well.
+                std::stop_callback wake{stop_token, [this] { consumer.waiter.Wake(); }};
+                consumer.waiter.Wait(
+                    [&] { return stop_token.stop_requested() || has_entries(); });
+                if (stop_token.stop_requested()) {
+                    return 0;
+                }
+            } else {
+                static_assert(Mode < PopMode::Count, "Invalid PopMode.");
+            }
+        }
+        count = std::min(count, out.size());
+        // Move the entries off the queue.
+        for (size_t i = 0; i < count; ++i) {
+            out[i] = std::move(m_data[(read_index + i) % Capacity]);
+        }
+        // Release the slots and wake the producer if it is parked.
+        consumer.index.store(read_index + count, std::memory_order::release);
+        producer.waiter.Notify();
+        return count;
     }
 
     std::array<T, Capacity> m_data;
     alignas(64) struct {
         std::atomic_size_t index{0};
-        std::condition_variable_any cv;
-        std::mutex cv_mutex;
+        size_t cached_read_index{0};
+        // The consumer checks this on every pop, keep it off the line the producer writes.
+        alignas(64) detail::AdaptiveWaiter waiter;
     } producer;
     alignas(64) struct {
         std::atomic_size_t index{0};
-        std::condition_variable_any cv;
-        std::mutex cv_mutex;
+        size_t cached_write_index{0};
+        alignas(64) detail::AdaptiveWaiter waiter;
     } consumer;
 };
 
@@ -167,6 +311,16 @@ public:
         spsc_queue.EmplaceWait(std::forward<Args>(args)...);
     }
 
+    size_t TryPushRange(std::span<T> items) {
+        std::scoped_lock lock{write_mutex};
+        return spsc_queue.TryPushRange(items);
+    }
+
+    void PushRangeWait(std::span<T> items) {
+        std::scoped_lock lock{write_mutex};
+        spsc_queue.PushRangeWait(items);
+    }
+
     bool TryPop(T& t) {
         return spsc_queue.TryPop(t);
     }
@@ -187,6 +341,18 @@ public:
         return spsc_queue.PopWait(stop_token);
     }
 
+    size_t TryPopRange(std::span<T> out) {
+        return spsc_queue.TryPopRange(out);
+    }
+
+    size_t PopRangeWait(std::span<T> out) {
+        return spsc_queue.PopRangeWait(out);
+    }
+
+    size_t PopRangeWait(std::span<T> out, std::stop_token stop_token) {
+        return spsc_queue.PopRangeWait(out, stop_token);
+    }
+
 private:
     SPSCQueue<T, Capacity> spsc_queue;
     std::mutex write_mutex;
@@ -207,6 +373,16 @@ public:
         spsc_queue.EmplaceWait(std::forward<Args>(args)...);
     }
 
+    size_t TryPushRange(std::span<T> items) {
+        std::scoped_lock lock{write_mutex};
+        return spsc_queue.TryPushRange(items);
+    }
+
+    void PushRangeWait(std::span<T> items) {
+        std::scoped_lock lock{write_mutex};
+        spsc_queue.PushRangeWait(items);
+    }
+
     bool TryPop(T& t) {
         std::scoped_lock lock{read_mutex};
         return spsc_queue.TryPop(t);
@@ -232,6 +408,21 @@ public:
         return spsc_queue.PopWait(stop_token);
     }
 
+    size_t TryPopRange(std::span<T> out) {
+        std::scoped_lock lock{read_mutex};
+        return spsc_queue.TryPopRange(out);
+    }
+
+    size_t PopRangeWait(std::span<T> out) {
+        std::scoped_lock lock{read_mutex};
+        return spsc_queue.PopRangeWait(out);
+    }
+
+    size_t PopRangeWait(std::span<T> out, std::stop_token stop_token) {
+        std::scoped_lock lock{read_mutex};
+        return spsc_queue.PopRangeWait(out, stop_token);
+    }
+
 private:
     SPSCQueue<T, Capacity> spsc_queue;
     alignas(64) std::mutex write_mutex;
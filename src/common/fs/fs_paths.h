@@ -37,3 +37,6 @@
 
 // yuzu-specific files
 #define LOG_FILE "eden_log.txt"
+#define BINARY_LOG_FILE "eden_log.bin"
+#define TRACE_FILE "eden_trace.json"
+#define CALL_STATS_FILE "eden_call_stats.json"
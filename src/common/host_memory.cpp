@@ -24,6 +24,10 @@
 #include "common/scope_exit.h"
 
 #if defined(__linux__)
+#include <cinttypes>
+#include <cstdio>
+#include <fstream>
+#include <string>
 #include <sys/random.h>
 #elif defined(__APPLE__)
 #include <sys/types.h>
@@ -44,6 +48,15 @@
 #ifndef MAP_ANONYMOUS
 #define MAP_ANONYMOUS MAP_ANON
 #endif
+// Older libc headers
+#if defined(__linux__)
+#ifndef MFD_HUGETLB
+#define MFD_HUGETLB 0x0004U
+#endif
+#ifndef MFD_HUGE_2MB
+#define MFD_HUGE_2MB (21U << 26)
+#endif
+#endif
 
 #endif // ^^^ POSIX ^^^
 
@@ -119,7 +132,7 @@ static void GetFuncAddress(Common::DynamicLibrary& dll, const char* name, T& pfn
 
 class HostMemory::Impl {
 public:
-    explicit Impl(size_t backing_size_, size_t virtual_size_)
+    explicit Impl(size_t backing_size_, size_t virtual_size_, Settings::HugePages)
         : backing_size{backing_size_}, virtual_size{virtual_size_}, process{GetCurrentProcess()},
           kernelbase_dll("Kernelbase") {
         if (!kernelbase_dll.IsOpen()) {
@@ -231,6 +244,7 @@ public:
 
     const size_t backing_size; ///< Size of the backing memory in bytes
     const size_t virtual_size; ///< Size of the virtual address placeholder in bytes
+    const Settings::HugePages huge_pages{Settings::HugePages::Off};
 
     u8* backing_base{};
     u8* virtual_base{};
@@ -496,55 +510,63 @@ static int shm_open_anon(int flags, mode_t mode) {
 }
 #endif
 
+#ifdef __linux__
+/// Maps `size` bytes starting on a huge page boundary, which huge page mappings require.
+static void* MapHugeAligned(size_t size, int prot, int flags, int fd) {
+    const size_t reserve_size = size + HugePageSize;
+    u8* const reserve = static_cast<u8*>(
+        mmap(nullptr, reserve_size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0));
+    if (reserve == MAP_FAILED) {
+        return MAP_FAILED;
+    }
+    u8* const aligned = reinterpret_cast<u8*>(
+        Common::AlignUp(reinterpret_cast<uintptr_t>(reserve), HugePageSize));
+    if (mmap(aligned, size, prot, flags | MAP_FIXED, fd, 0) == MAP_FAILED) {
+        const int error = errno;
+        munmap(reserve, reserve_size);
+        errno = error;
+        return MAP_FAILED;
+    }
+    if (aligned != reserve) {
+        munmap(reserve, aligned - reserve);
+    }
+    if (const size_t tail = reserve + reserve_size - (aligned + size); tail != 0) {
+        munmap(aligned + size, tail);
+    }
+    return aligned;
+}
+
+/// Shared memory only gets transparent huge pages when the administrator allows it.
+static bool ShmemHugePagesAllowed() {
+    std::ifstream file{"/sys/kernel/mm/transparent_hugepage/shmem_enabled"};
+    std::string modes;
+    if (!std::getline(file, modes)) {
+        return false;
+    }
+    return modes.find("[never]") == std::string::npos && modes.find("[deny]") == std::string::npos;
+}
+#endif
+
 class HostMemory::Impl {
 public:
-    explicit Impl(size_t backing_size_, size_t virtual_size_)
-        : backing_size{backing_size_}, virtual_size{virtual_size_} {
+    explicit Impl(size_t backing_size_, size_t virtual_size_, Settings::HugePages huge_pages_)
+        : backing_size{backing_size_}, virtual_size{virtual_size_}, huge_pages{huge_pages_} {
         long page_size = sysconf(_SC_PAGESIZE);
         ASSERT_MSG(page_size == 0x1000, "page size {:#x} is incompatible with 4K paging",
                    page_size);
         // Backing memory initialization
-#if defined(__sun__) || defined(__HAIKU__) || defined(__NetBSD__) || defined(__DragonFly__)
-        fd = shm_open_anon(O_RDWR | O_CREAT | O_EXCL | O_NOFOLLOW, 0600);
-#elif defined(__OpenBSD__)
-        fd = shm_open_anon(O_RDWR | O_CREAT | O_EXCL | O_NOFOLLOW, 0600);
-#elif defined(__FreeBSD__) && __FreeBSD__ < 13
-        // XXX Drop after FreeBSD 12.* reaches EOL on 2024-06-30
-        fd = shm_open(SHM_ANON, O_RDWR, 0600);
-#elif defined(__APPLE__)
-        // macOS doesn't have memfd_create, use anonymous temporary file
-        char template_path[] = "/tmp/eden_mem_XXXXXX";
-        fd = mkstemp(template_path);
-        if (fd >= 0) {
-            unlink(template_path);
+#ifdef __linux__
+        if (huge_pages == Settings::HugePages::HugeTlb && !InitializeHugeTlbBacking()) {
+            LOG_WARNING(Common_Memory, "Falling back to transparent huge pages");
+            huge_pages = Settings::HugePages::Transparent;
+        }
+        if (huge_pages != Settings::HugePages::HugeTlb) {
+            InitializeBacking();
         }
 #else
-        fd = memfd_create("HostMemory", 0);
+        huge_pages = Settings::HugePages::Off;
+        InitializeBacking();
 #endif
-        bool use_anon = false;
-        if (fd <= 0) {
-            LOG_WARNING(Common_Memory, "memfd_create: {}", strerror(errno));
-            use_anon = true;
-        }
-        if (!use_anon) {
-            // Defined to extend the file with zeros
-            int ret = ftruncate(fd, backing_size);
-            if (ret != 0) {
-                LOG_WARNING(Common_Memory, "ftruncate: {} (likely out-of-emory)", strerror(errno));
-                use_anon = true;
-            }
-        }
-        if (use_anon) {
-            LOG_WARNING(Common_Memory, "Using private mappings instead of shared ones");
-            backing_base = static_cast<u8*>(mmap(nullptr, backing_size, PROT_READ | PROT_WRITE, MAP_ANONYMOUS | MAP_PRIVATE, -1, 0));
-            if (fd > 0) {
-                fd = -1;
-                close(fd);
-            }
-        } else {
-            backing_base = static_cast<u8*>(mmap(nullptr, backing_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0));
-        }
-        ASSERT_MSG(backing_base != MAP_FAILED, "mmap failed: {}", strerror(errno));
 
         // Virtual memory initialization
         virtual_base = virtual_map_base = static_cast<u8*>(ChooseVirtualBase(virtual_size));
@@ -579,6 +601,11 @@ public:
         int flags = (fd > 0 ? MAP_SHARED : MAP_PRIVATE) | MAP_FIXED;
         void* ret = mmap(virtual_base + virtual_offset, length, prot_flags, flags, fd, host_offset);
         ASSERT_MSG(ret != MAP_FAILED, "mmap: {}", strerror(errno));
+#ifdef __linux__
+        if (huge_pages == Settings::HugePages::Transparent) {
+            AdviseHugePages(virtual_offset, host_offset, length);
+        }
+#endif
     }
 
     void Unmap(size_t virtual_offset, size_t length) {
@@ -621,6 +648,11 @@ public:
 #ifdef __linux__
         // Only incur syscall cost IF memset would be slower (theshold = 16MiB)
         // TODO(lizzie): Smarter way to dynamically get this threshold (broadwell != raptor lake) for example
+        if (huge_pages == Settings::HugePages::HugeTlb &&
+            ((physical_offset | length) & (HugePageSize - 1)) != 0) {
+            // hugetlbfs can only release whole huge pages.
+            return false;
+        }
         if (length >= 2097152UL * 8) {
             // Set MADV_REMOVE on backing map to destroy it instantly.
             // This also deletes the area from the backing file.
@@ -639,14 +671,172 @@ public:
         virtual_base = nullptr;
     }
 
+#ifdef __linux__
+    HugePageUsage GetHugePageUsage() const {
+        const uintptr_t backing_begin = reinterpret_cast<uintptr_t>(backing_base);
+        const uintptr_t backing_end = backing_begin + backing_size;
+        const uintptr_t virtual_begin = reinterpret_cast<uintptr_t>(virtual_map_base);
+        const uintptr_t virtual_end = virtual_begin + virtual_size;
+
+        HugePageUsage usage{};
+        size_t* counter = nullptr;
+        std::ifstream smaps{"/proc/self/smaps"};
+        std::string line;
+        while (std::getline(smaps, line)) {
+            uintptr_t begin;
+            uintptr_t end;
+            if (std::sscanf(line.c_str(), "%" SCNxPTR "-%" SCNxPTR, &begin, &end) == 2) {
+                // Header of the next mapping.
+                if (begin >= backing_begin && end <= backing_end) {
+                    counter = &usage.backing_bytes;
+                } else if (begin >= virtual_begin && end <= virtual_end) {
+                    counter = &usage.virtual_bytes;
+                } else {
+                    counter = nullptr;
+                }
+                continue;
+            }
+            if (counter == nullptr) {
+                continue;
+            }
+            for (const std::string_view field : {"AnonHugePages:", "ShmemPmdMapped:",
+                                                 "FilePmdMapped:", "Shared_Hugetlb:",
+                                                 "Private_Hugetlb:"}) {
+                if (line.starts_with(field)) {
+                    *counter += std::strtoull(line.c_str() + field.size(), nullptr, 10) * 1024;
+                    break;
+                }
+            }
+        }
+        return usage;
+    }
+#endif
+
     const size_t backing_size; ///< Size of the backing memory in bytes
     const size_t virtual_size; ///< Size of the virtual address placeholder in bytes
+    Settings::HugePages huge_pages; ///< Huge page mode after falling back
 
     u8* backing_base{reinterpret_cast<u8*>(MAP_FAILED)};
     u8* virtual_base{reinterpret_cast<u8*>(MAP_FAILED)};
     u8* virtual_map_base{reinterpret_cast<u8*>(MAP_FAILED)};
 
 private:
+    void InitializeBacking() {
+#if defined(__sun__) || defined(__HAIKU__) || defined(__NetBSD__) || defined(__DragonFly__)
+        fd = shm_open_anon(O_RDWR | O_CREAT | O_EXCL | O_NOFOLLOW, 0600);
+#elif defined(__OpenBSD__)
+        fd = shm_open_anon(O_RDWR | O_CREAT | O_EXCL | O_NOFOLLOW, 0600);
+#elif defined(__FreeBSD__) && __FreeBSD__ < 13
+        // XXX Drop after FreeBSD 12.* reaches EOL on 2024-06-30
+        fd = shm_open(SHM_ANON, O_RDWR, 0600);
+#elif defined(__APPLE__)
+        // macOS doesn't have memfd_create, use anonymous temporary file
+        char template_path[] = "/tmp/eden_mem_XXXXXX";
+        fd = mkstemp(template_path);
+        if (fd >= 0) {
+            unlink(template_path);
+        }
+#else
+        fd = memfd_create("HostMemory", 0);
+#endif
+        bool use_anon = false;
+        if (fd <= 0) {
+            LOG_WARNING(Common_Memory, "memfd_create: {}", strerror(errno));
+            use_anon = true;
+        }
+        if (!use_anon) {
+            // Defined to extend the file with zeros
+            int ret = ftruncate(fd, backing_size);
+            if (ret != 0) {
+                LOG_WARNING(Common_Memory, "ftruncate: {} (likely out-of-emory)", strerror(errno));
+                use_anon = true;
+            }
+        }
+        const int prot = PROT_READ | PROT_WRITE;
+        const int flags = use_anon ? MAP_ANONYMOUS | MAP_PRIVATE : MAP_SHARED;
+        if (use_anon) {
+            LOG_WARNING(Common_Memory, "Using private mappings instead of shared ones");
+            if (fd > 0) {
+                fd = -1;
+                close(fd);
+            }
+        }
+#ifdef __linux__
+        if (huge_pages == Settings::HugePages::Transparent) {
+            backing_base = static_cast<u8*>(MapHugeAligned(backing_size, prot, flags, fd));
+        } else {
+            backing_base = static_cast<u8*>(mmap(nullptr, backing_size, prot, flags, fd, 0));
+        }
+#else
+        backing_base = static_cast<u8*>(mmap(nullptr, backing_size, prot, flags, fd, 0));
+#endif
+        ASSERT_MSG(backing_base != MAP_FAILED, "mmap failed: {}", strerror(errno));
+
+#ifdef __linux__
+        if (huge_pages != Settings::HugePages::Transparent) {
+            return;
+        }
+        if (!use_anon && !ShmemHugePagesAllowed()) {
+            LOG_WARNING(Common_Memory, "Transparent huge pages for shared memory are disabled, "
+                                       "set /sys/kernel/mm/transparent_hugepage/shmem_enabled "
+                                       "to advise to use them");
+            huge_pages = Settings::HugePages::Off;
+        } else if (madvise(backing_base, backing_size, MADV_HUGEPAGE) != 0) {
+            LOG_WARNING(Common_Memory, "madvise(MADV_HUGEPAGE): {}", strerror(errno));
+            huge_pages = Settings::HugePages::Off;
+        } else {
+            LOG_INFO(Common_Memory, "Using transparent huge pages for {} MiB of guest memory",
+                     backing_size >> 20);
+        }
+#endif
+    }
+
+#ifdef __linux__
+    bool InitializeHugeTlbBacking() {
+        if (backing_size % HugePageSize != 0) {
+            return false;
+        }
+        const int huge_fd = memfd_create("HostMemory", MFD_HUGETLB | MFD_HUGE_2MB);
+        if (huge_fd < 0) {
+            LOG_WARNING(Common_Memory, "memfd_create(MFD_HUGETLB): {}", strerror(errno));
+            return false;
+        }
+        if (ftruncate(huge_fd, backing_size) != 0) {
+            LOG_WARNING(Common_Memory, "ftruncate on hugetlbfs: {}", strerror(errno));
+            close(huge_fd);
+            return false;
+        }
+        // Shared hugetlbfs mappings reserve their pages up front, so a small pool fails here
+        // instead of raising SIGBUS on a later access.
+        void* const base = MapHugeAligned(backing_size, PROT_READ | PROT_WRITE, MAP_SHARED, huge_fd);
+        if (base == MAP_FAILED) {
+            LOG_WARNING(Common_Memory, "Could not reserve {} huge pages: {}",
+                        backing_size / HugePageSize, strerror(errno));
+            close(huge_fd);
+            return false;
+        }
+        fd = huge_fd;
+        backing_base = static_cast<u8*>(base);
+        LOG_INFO(Common_Memory, "Using explicit huge pages for {} MiB of guest memory",
+                 backing_size >> 20);
+        return true;
+    }
+
+    /// A view can only be mapped with huge pages where its address and file offset agree modulo
+    /// the huge page size.
+    void AdviseHugePages(size_t virtual_offset, size_t host_offset, size_t length) {
+        const uintptr_t begin = reinterpret_cast<uintptr_t>(virtual_base + virtual_offset);
+        if ((begin - host_offset) % HugePageSize != 0) {
+            return;
+        }
+        const uintptr_t huge_begin = Common::AlignUp(begin, HugePageSize);
+        const uintptr_t huge_end = Common::AlignDown(begin + length, HugePageSize);
+        if (huge_begin < huge_end) {
+            madvise(reinterpret_cast<void*>(huge_begin), huge_end - huge_begin, MADV_HUGEPAGE);
+        }
+    }
+#endif
+
     /// Release all resources in the object
     void Release() {
         if (virtual_map_base != MAP_FAILED) {
@@ -692,18 +882,28 @@ private:
 
 #endif // ^^^ POSIX ^^^
 
-HostMemory::HostMemory(size_t backing_size_, size_t virtual_size_)
+HostMemory::HostMemory(size_t backing_size_, size_t virtual_size_, Settings::HugePages huge_pages)
     : backing_size(backing_size_), virtual_size(virtual_size_) {
+#ifndef __linux__
+    if (huge_pages != Settings::HugePages::Off) {
+        LOG_WARNING(HW_Memory, "Huge pages are only supported on Linux");
+    }
+#endif
     try {
         // Try to allocate a fastmem arena.
         // The implementation will fail with std::bad_alloc on errors.
-        impl =
-            std::make_unique<HostMemory::Impl>(AlignUp(backing_size, PageAlignment),
-                                               AlignUp(virtual_size, PageAlignment) + HugePageSize);
+        impl = std::make_unique<HostMemory::Impl>(AlignUp(backing_size, PageAlignment),
+                                                  AlignUp(virtual_size, PageAlignment) +
+                                                      HugePageSize,
+                                                  huge_pages);
         backing_base = impl->backing_base;
         virtual_base = impl->virtual_base;
 
-        if (virtual_base) {
+        if (impl->huge_pages == Settings::HugePages::HugeTlb) {
+            // hugetlbfs pages cannot be mapped with 4 KiB granularity.
+            LOG_WARNING(HW_Memory, "Fastmem is unavailable with explicit huge pages");
+            virtual_base = nullptr;
+        } else if (virtual_base) {
             // Ensure the virtual base is aligned to the L2 block size.
             virtual_base = reinterpret_cast<u8*>(
                 Common::AlignUp(reinterpret_cast<uintptr_t>(virtual_base), HugePageSize));
@@ -767,6 +967,19 @@ void HostMemory::ClearBackingRegion(size_t physical_offset, size_t length, u32 f
     }
 }
 
+Settings::HugePages HostMemory::HugePageMode() const noexcept {
+    return impl ? impl->huge_pages : Settings::HugePages::Off;
+}
+
+HugePageUsage HostMemory::GetHugePageUsage() const {
+#ifdef __linux__
+    if (impl) {
+        return impl->GetHugePageUsage();
+    }
+#endif
+    return {};
+}
+
 void HostMemory::EnableDirectMappedAddress() {
     if (impl) {
         impl->EnableDirectMappedAddress();
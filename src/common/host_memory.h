@@ -6,6 +6,7 @@
 #include <memory>
 #include "common/common_funcs.h"
 #include "common/common_types.h"
+#include "common/settings_enums.h"
 #include "common/virtual_buffer.h"
 
 namespace Common {
@@ -18,13 +19,25 @@ enum class MemoryPermission : u32 {
 };
 DECLARE_ENUM_FLAG_OPERATORS(MemoryPermission)
 
+/// Amount of memory currently mapped with huge pages.
+struct HugePageUsage {
+    size_t backing_bytes; ///< Part of the backing memory
+    size_t virtual_bytes; ///< Part of the fastmem views
+};
+
 /**
  * A low level linear memory buffer, which supports multiple mappings
  * Its purpose is to rebuild a given sparse memory layout, including mirrors.
+ *
+ * On Linux the backing memory can use huge pages. Transparent huge pages are requested for the
+ * backing memory and for fastmem views that are 2 MiB aligned in both spaces. Explicit huge pages
+ * from hugetlbfs cover all the backing memory but cannot be mapped with 4 KiB granularity, so the
+ * fastmem arena is not available with them. Unavailable modes fall back to the next smaller one.
  */
 class HostMemory {
 public:
-    explicit HostMemory(size_t backing_size_, size_t virtual_size_);
+    explicit HostMemory(size_t backing_size_, size_t virtual_size_,
+                        Settings::HugePages huge_pages = Settings::HugePages::Off);
     ~HostMemory();
 
     /**
@@ -69,6 +82,12 @@ public:
         return address >= virtual_base && address < virtual_base + virtual_size;
     }
 
+    /// Huge page mode in use after falling back from the requested one.
+    [[nodiscard]] Settings::HugePages HugePageMode() const noexcept;
+
+    /// Reads how much memory the kernel currently maps with huge pages, this is not cheap.
+    [[nodiscard]] HugePageUsage GetHugePageUsage() const;
+
 private:
     size_t backing_size{};
     size_t virtual_size{};
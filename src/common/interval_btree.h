@@ -0,0 +1,602 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "common/assert.h"
+#include "common/common_types.h"
+#include "common/div_ceil.h"
+
+namespace Common {
+
+/**
+ * Ordered set of disjoint half-open intervals [begin, end), each with an optional value, stored in
+ * a B+tree whose nodes live in flat pools and refer to each other by index.
+ *
+ * Nodes are a few cache lines large and keep keys apart from the rest of the node, so a lookup
+ * touches one or two lines per level. Once the pools have grown, inserting and erasing intervals
+ * does not allocate. Intervals are keyed by their begin address; since they do not overlap, that
+ * order also sorts them by end address, which is what LowerBound relies on.
+ *
+ * Underfull nodes are merged with a sibling when both fit in one node. Positions are invalidated
+ * by any insertion or erasure.
+ */
+template <typename Key, typename Value = void>
+class IntervalBTree {
+    struct NoValue {};
+
+public:
+    using MappedType = std::conditional_t<std::is_void_v<Value>, NoValue, Value>;
+
+    /// Number of intervals in a leaf, two cache lines of begin addresses.
+    static constexpr u32 LeafCapacity = 128 / sizeof(Key);
+    /// Number of children of an inner node.
+    static constexpr u32 InnerFanout = 16;
+
+    struct Interval {
+        Key begin;
+        Key end;
+        [[no_unique_address]] MappedType value{};
+    };
+
+    struct Position {
+        u32 leaf;
+        u32 index;
+
+        bool operator==(const Position&) const = default;
+    };
+
+    IntervalBTree() = default;
+    ~IntervalBTree() = default;
+
+    IntervalBTree(const IntervalBTree&) = default;
+    IntervalBTree& operator=(const IntervalBTree&) = default;
+
+    IntervalBTree(IntervalBTree&& other) noexcept {
+        *this = std::move(other);
+    }
+
+    IntervalBTree& operator=(IntervalBTree&& other) noexcept {
+        leaves = std::move(other.leaves);
+        inners = std::move(other.inners);
+        free_leaves = std::move(other.free_leaves);
+        free_inners = std::move(other.free_inners);
+        root = std::exchange(other.root, Invalid);
+        first_leaf = std::exchange(other.first_leaf, Invalid);
+        height = std::exchange(other.height, 0);
+        count = std::exchange(other.count, 0);
+        other.Clear();
+        return *this;
+    }
+
+    [[nodiscard]] bool Empty() const noexcept {
+        return count == 0;
+    }
+
+    /// Number of intervals in the tree.
+    [[nodiscard]] size_t Size() const noexcept {
+        return count;
+    }
+
+    /// Removes all intervals, keeping the node pools for reuse.
+    void Clear() noexcept {
+        leaves.clear();
+        inners.clear();
+        free_leaves.clear();
+        free_inners.clear();
+        root = Invalid;
+        first_leaf = Invalid;
+        height = 0;
+        count = 0;
+    }
+
+    [[nodiscard]] static constexpr Position End() noexcept {
+        return {Invalid, 0};
+    }
+
+    /// Position of the lowest interval.
+    [[nodiscard]] Position First() const noexcept {
+        return count == 0 ? End() : Position{first_leaf, 0};
+    }
+
+    [[nodiscard]] Position Next(Position position) const noexcept {
+        const Leaf& leaf = leaves[position.leaf];
+        if (position.index + 1 < leaf.size) {
+            return {position.leaf, position.index + 1};
+        }
+        return {leaf.next, 0};
+    }
+
+    /// Position of the lowest interval whose end is above the given address.
+    [[nodiscard]] Position LowerBound(Key address) const noexcept {
+        if (count == 0) {
+            return End();
+        }
+        const u32 leaf_id = Descend(address, nullptr);
+        const Leaf& leaf = leaves[leaf_id];
+        const u32 index = CountNotAbove(leaf.begins, leaf.size, address);
+        if (index > 0) {
+            if (leaf.ends[index - 1] > address) {
+                return {leaf_id, index - 1};
+            }
+            return index < leaf.size ? Position{leaf_id, index} : Position{leaf.next, 0};
+        }
+        // Separators are not updated when the lowest interval of a leaf is erased, so the interval
+        // holding the address may be the last one of the previous leaf.
+        if (leaf.prev != Invalid) {
+            const Leaf& prev = leaves[leaf.prev];
+            if (prev.ends[prev.size - 1] > address) {
+                return {leaf.prev, prev.size - 1};
+            }
+        }
+        return {leaf_id, 0};
+    }
+
+    [[nodiscard]] Interval Get(Position position) const noexcept {
+        const Leaf& leaf = leaves[position.leaf];
+        Interval interval{leaf.begins[position.index], leaf.ends[position.index]};
+        if constexpr (!std::is_void_v<Value>) {
+            interval.value = leaf.values[position.index];
+        }
+        return interval;
+    }
+
+    /// Moves the end of an interval, which must stay below the begin of the next one.
+    void SetEnd(Position position, Key end) noexcept {
+        leaves[position.leaf].ends[position.index] = end;
+    }
+
+    void SetValue(Position position, const MappedType& value) noexcept
+        requires(!std::is_void_v<Value>)
+    {
+        leaves[position.leaf].values[position.index] = value;
+    }
+
+    /// Inserts an interval, which must not overlap any interval in the tree.
+    void Insert(const Interval& interval) {
+        if (root == Invalid) {
+            root = first_leaf = AllocateLeaf();
+            height = 0;
+        }
+        Path path;
+        const u32 leaf_id = Descend(interval.begin, &path);
+        ++count;
+
+        Leaf* leaf = &leaves[leaf_id];
+        const u32 index = CountNotAbove(leaf->begins, leaf->size, interval.begin);
+        if (leaf->size < LeafCapacity) {
+            InsertEntry(*leaf, index, interval);
+            return;
+        }
+        const u32 right_id = AllocateLeaf();
+        leaf = &leaves[leaf_id];
+        Leaf& right = leaves[right_id];
+        constexpr u32 Half = LeafCapacity / 2;
+        CopyEntries(right, 0, *leaf, Half, LeafCapacity - Half);
+        right.size = LeafCapacity - Half;
+        leaf->size = Half;
+        right.prev = leaf_id;
+        right.next = leaf->next;
+        if (leaf->next != Invalid) {
+            leaves[leaf->next].prev = right_id;
+        }
+        leaf->next = right_id;
+        if (index <= Half) {
+            InsertEntry(*leaf, index, interval);
+        } else {
+            InsertEntry(right, index - Half, interval);
+        }
+        InsertChild(path, height, right.begins[0], right_id);
+    }
+
+    /// Erases the intervals whose begin is in [first, last].
+    void Erase(Key first, Key last) {
+        EraseIf(first, last, [](const Interval&) { return true; });
+    }
+
+    /// Erases the intervals whose begin is in [first, last] and that satisfy the predicate.
+    template <typename Predicate>
+    void EraseIf(Key first, Key last, Predicate&& predicate) {
+        while (count != 0) {
+            Path path;
+            const u32 leaf_id = Descend(first, &path);
+            Leaf& leaf = leaves[leaf_id];
+            u32 read = CountBelow(leaf.begins, leaf.size, first);
+            u32 write = read;
+            for (; read < leaf.size && leaf.begins[read] <= last; ++read) {
+                if (predicate(Get({leaf_id, read}))) {
+                    continue;
+                }
+                if (write != read) {
+                    CopyEntries(leaf, write, leaf, read, 1);
+                }
+                ++write;
+            }
+            const u32 removed = read - write;
+            const bool more = read == leaf.size && leaf.next != Invalid &&
+                              leaves[leaf.next].begins[0] <= last;
+            const Key next_first = more ? leaves[leaf.next].begins[0] : Key{};
+            if (removed != 0) {
+                CopyEntries(leaf, write, leaf, read, leaf.size - read);
+                leaf.size -= removed;
+                count -= removed;
+                RebalanceLeaf(leaf_id, path);
+            }
+            if (!more) {
+                return;
+            }
+            first = next_first;
+        }
+    }
+
+    /// Replaces the contents of the tree with sorted, disjoint intervals, packing the leaves.
+    void Assign(std::span<const Interval> intervals) {
+        Clear();
+        if (intervals.empty()) {
+            return;
+        }
+        count = intervals.size();
+        const size_t num_leaves = DivCeil(intervals.size(), size_t{LeafCapacity});
+        for (size_t i = 0; i < num_leaves; ++i) {
+            const u32 leaf_id = AllocateLeaf();
+            Leaf& leaf = leaves[leaf_id];
+            // Spread the intervals evenly so the last leaf is not left nearly empty.
+            const size_t begin = i * intervals.size() / num_leaves;
+            const size_t end = (i + 1) * intervals.size() / num_leaves;
+            for (size_t j = begin; j < end; ++j) {
+                SetEntry(leaf, static_cast<u32>(j - begin), intervals[j]);
+            }
+            leaf.size = static_cast<u32>(end - begin);
+            leaf.prev = i == 0 ? Invalid : leaf_id - 1;
+            leaf.next = i + 1 == num_leaves ? Invalid : leaf_id + 1;
+        }
+        // The pools were cleared, so every level is allocated as a contiguous range of ids.
+        first_leaf = 0;
+        u32 level_first = 0;
+        size_t level_size = num_leaves;
+        while (level_size > 1) {
+            const u32 parent_first = static_cast<u32>(inners.size());
+            const size_t num_parents = DivCeil(level_size, size_t{InnerFanout});
+            for (size_t i = 0; i < num_parents; ++i) {
+                const u32 inner_id = AllocateInner();
+                Inner& inner = inners[inner_id];
+                const size_t begin = i * level_size / num_parents;
+                const size_t end = (i + 1) * level_size / num_parents;
+                for (size_t j = begin; j < end; ++j) {
+                    const u32 child = level_first + static_cast<u32>(j);
+                    inner.children[j - begin] = child;
+                    if (j != begin) {
+                        inner.keys[j - begin - 1] = LowestKey(child, height);
+                    }
+                }
+                inner.size = static_cast<u32>(end - begin);
+            }
+            level_first = parent_first;
+            level_size = num_parents;
+            ++height;
+        }
+        root = level_first;
+    }
+
+private:
+    static constexpr u32 Invalid = std::numeric_limits<u32>::max();
+    static constexpr u32 MaxHeight = 16;
+
+    using ValueArray =
+        std::conditional_t<std::is_void_v<Value>, NoValue, std::array<MappedType, LeafCapacity>>;
+
+    struct alignas(64) Leaf {
+        std::array<Key, LeafCapacity> begins;
+        std::array<Key, LeafCapacity> ends;
+        [[no_unique_address]] ValueArray values;
+        u32 size;
+        u32 prev;
+        u32 next;
+    };
+
+    struct alignas(64) Inner {
+        /// keys[i] is a lower bound of the subtree in children[i + 1] and above the one before it.
+        std::array<Key, InnerFanout - 1> keys;
+        std::array<u32, InnerFanout> children;
+        u32 size;
+    };
+
+    /// Inner nodes and the child taken in each of them, from the root down.
+    struct Path {
+        std::array<u32, MaxHeight> nodes;
+        std::array<u32, MaxHeight> slots;
+    };
+
+    /// Number of keys not above the address, a branchless count is faster than a binary search on
+    /// arrays this small.
+    template <size_t N>
+    static u32 CountNotAbove(const std::array<Key, N>& keys, u32 size, Key address) noexcept {
+        u32 result = 0;
+        for (u32 i = 0; i < N; ++i) {
+            result += (keys[i] <= address) & (i < size);
+        }
+        return result;
+    }
+
+    template <size_t N>
+    static u32 CountBelow(const std::array<Key, N>& keys, u32 size, Key address) noexcept {
+        u32 result = 0;
+        for (u32 i = 0; i < N; ++i) {
+            result += (keys[i] < address) & (i < size);
+        }
+        return result;
+    }
+
+    static void SetEntry(Leaf& leaf, u32 index, const Interval& interval) noexcept {
+        leaf.begins[index] = interval.begin;
+        leaf.ends[index] = interval.end;
+        if constexpr (!std::is_void_v<Value>) {
+            leaf.values[index] = interval.value;
+        }
+    }
+
+    /// Copies entries towards lower or equal indices, or between different leaves.
+    static void CopyEntries(Leaf& dst, u32 dst_index, const Leaf& src, u32 src_index,
+                            u32 amount) noexcept {
+        std::copy_n(src.begins.begin() + src_index, amount, dst.begins.begin() + dst_index);
+        std::copy_n(src.ends.begin() + src_index, amount, dst.ends.begin() + dst_index);
+        if constexpr (!std::is_void_v<Value>) {
+            std::copy_n(src.values.begin() + src_index, amount, dst.values.begin() + dst_index);
+        }
+    }
+
+    static void InsertEntry(Leaf& leaf, u32 index, const Interval& interval) noexcept {
+        const auto shift = [&](auto& array) {
+            std::copy_backward(array.begin() + index, array.begin() + leaf.size,
+                               array.begin() + leaf.size + 1);
+        };
+        shift(leaf.begins);
+        shift(leaf.ends);
+        if constexpr (!std::is_void_v<Value>) {
+            shift(leaf.values);
+        }
+        SetEntry(leaf, index, interval);
+        ++leaf.size;
+    }
+
+    u32 Descend(Key address, Path* path) const noexcept {
+        u32 node = root;
+        for (u32 depth = 0; depth < height; ++depth) {
+            const Inner& inner = inners[node];
+            const u32 slot = CountNotAbove(inner.keys, inner.size - 1, address);
+            if (path) {
+                path->nodes[depth] = node;
+                path->slots[depth] = slot;
+            }
+            node = inner.children[slot];
+        }
+        return node;
+    }
+
+    Key LowestKey(u32 node, u32 depth) const noexcept {
+        for (; depth > 0; --depth) {
+            node = inners[node].children[0];
+        }
+        return leaves[node].begins[0];
+    }
+
+    u32 AllocateLeaf() {
+        u32 id;
+        if (free_leaves.empty()) {
+            id = static_cast<u32>(leaves.size());
+            leaves.emplace_back();
+        } else {
+            id = free_leaves.back();
+            free_leaves.pop_back();
+        }
+        Leaf& leaf = leaves[id];
+        leaf.size = 0;
+        leaf.prev = Invalid;
+        leaf.next = Invalid;
+        return id;
+    }
+
+    u32 AllocateInner() {
+        u32 id;
+        if (free_inners.empty()) {
+            id = static_cast<u32>(inners.size());
+            inners.emplace_back();
+        } else {
+            id = free_inners.back();
+            free_inners.pop_back();
+        }
+        inners[id].size = 0;
+        return id;
+    }
+
+    void FreeLeaf(u32 leaf_id) {
+        Leaf& leaf = leaves[leaf_id];
+        if (leaf.prev != Invalid) {
+            leaves[leaf.prev].next = leaf.next;
+        } else {
+            first_leaf = leaf.next;
+        }
+        if (leaf.next != Invalid) {
+            leaves[leaf.next].prev = leaf.prev;
+        }
+        free_leaves.push_back(leaf_id);
+    }
+
+    /// Adds a child after the one the path took at the given depth, splitting nodes up the path.
+    void InsertChild(const Path& path, u32 depth, Key key, u32 child) {
+        while (depth > 0) {
+            const u32 parent_id = path.nodes[depth - 1];
+            const u32 slot = path.slots[depth - 1] + 1;
+            if (inners[parent_id].size < InnerFanout) {
+                Inner& parent = inners[parent_id];
+                std::copy_backward(parent.keys.begin() + slot - 1,
+                                   parent.keys.begin() + parent.size - 1,
+                                   parent.keys.begin() + parent.size);
+                std::copy_backward(parent.children.begin() + slot,
+                                   parent.children.begin() + parent.size,
+                                   parent.children.begin() + parent.size + 1);
+                parent.keys[slot - 1] = key;
+                parent.children[slot] = child;
+                ++parent.size;
+                return;
+            }
+            const u32 right_id = AllocateInner();
+            Inner& parent = inners[parent_id];
+            Inner& right = inners[right_id];
+
+            std::array<Key, InnerFanout> keys;
+            std::array<u32, InnerFanout + 1> children;
+            std::copy_n(parent.keys.begin(), slot - 1, keys.begin());
+            keys[slot - 1] = key;
+            std::copy(parent.keys.begin() + slot - 1, parent.keys.end(), keys.begin() + slot);
+            std::copy_n(parent.children.begin(), slot, children.begin());
+            children[slot] = child;
+            std::copy(parent.children.begin() + slot, parent.children.end(),
+                      children.begin() + slot + 1);
+
+            constexpr u32 LeftSize = (InnerFanout + 1) / 2;
+            constexpr u32 RightSize = InnerFanout + 1 - LeftSize;
+            std::copy_n(keys.begin(), LeftSize - 1, parent.keys.begin());
+            std::copy_n(children.begin(), LeftSize, parent.children.begin());
+            parent.size = LeftSize;
+            std::copy_n(keys.begin() + LeftSize, RightSize - 1, right.keys.begin());
+            std::copy_n(children.begin() + LeftSize, RightSize, right.children.begin());
+            right.size = RightSize;
+
+            key = keys[LeftSize - 1];
+            child = right_id;
+            --depth;
+        }
+        // The root was split, grow the tree by one level.
+        const u32 new_root = AllocateInner();
+        Inner& inner = inners[new_root];
+        inner.keys[0] = key;
+        inner.children[0] = root;
+        inner.children[1] = child;
+        inner.size = 2;
+        root = new_root;
+        ++height;
+        ASSERT(height < MaxHeight);
+    }
+
+    /// Removes a child and the separator bounding it from the node at depth - 1 on the path.
+    void RemoveChild(const Path& path, u32 depth, u32 slot) {
+        const u32 parent_id = path.nodes[depth - 1];
+        Inner& parent = inners[parent_id];
+        if (parent.size > 1) {
+            const u32 key_index = slot == 0 ? 0 : slot - 1;
+            std::copy(parent.keys.begin() + key_index + 1, parent.keys.begin() + parent.size - 1,
+                      parent.keys.begin() + key_index);
+        }
+        std::copy(parent.children.begin() + slot + 1, parent.children.begin() + parent.size,
+                  parent.children.begin() + slot);
+        --parent.size;
+
+        if (depth == 1) {
+            if (parent.size == 1) {
+                root = parent.children[0];
+                free_inners.push_back(parent_id);
+                --height;
+            }
+            return;
+        }
+        if (parent.size >= InnerFanout / 4) {
+            return;
+        }
+        const u32 grandparent_id = path.nodes[depth - 2];
+        const u32 parent_slot = path.slots[depth - 2];
+        if (parent.size == 0) {
+            free_inners.push_back(parent_id);
+            RemoveChild(path, depth - 1, parent_slot);
+            return;
+        }
+        const Inner& grandparent = inners[grandparent_id];
+        if (parent_slot + 1 < grandparent.size) {
+            const u32 right_id = grandparent.children[parent_slot + 1];
+            if (parent.size + inners[right_id].size <= InnerFanout) {
+                MergeInner(parent_id, right_id, grandparent.keys[parent_slot]);
+                RemoveChild(path, depth - 1, parent_slot + 1);
+                return;
+            }
+        }
+        if (parent_slot > 0) {
+            const u32 left_id = grandparent.children[parent_slot - 1];
+            if (parent.size + inners[left_id].size <= InnerFanout) {
+                MergeInner(left_id, parent_id, grandparent.keys[parent_slot - 1]);
+                RemoveChild(path, depth - 1, parent_slot);
+            }
+        }
+    }
+
+    void MergeInner(u32 left_id, u32 right_id, Key separator) {
+        Inner& left = inners[left_id];
+        const Inner& right = inners[right_id];
+        left.keys[left.size - 1] = separator;
+        std::copy_n(right.keys.begin(), right.size - 1, left.keys.begin() + left.size);
+        std::copy_n(right.children.begin(), right.size, left.children.begin() + left.size);
+        left.size += right.size;
+        free_inners.push_back(right_id);
+    }
+
+    void RebalanceLeaf(u32 leaf_id, const Path& path) {
+        const Leaf& leaf = leaves[leaf_id];
+        if (height == 0) {
+            if (leaf.size == 0) {
+                Clear();
+            }
+            return;
+        }
+        if (leaf.size >= LeafCapacity / 4) {
+            return;
+        }
+        const u32 slot = path.slots[height - 1];
+        if (leaf.size == 0) {
+            FreeLeaf(leaf_id);
+            RemoveChild(path, height, slot);
+            return;
+        }
+        const Inner& parent = inners[path.nodes[height - 1]];
+        if (slot + 1 < parent.size) {
+            const u32 right_id = parent.children[slot + 1];
+            if (leaf.size + leaves[right_id].size <= LeafCapacity) {
+                MergeLeaves(leaf_id, right_id);
+                RemoveChild(path, height, slot + 1);
+                return;
+            }
+        }
+        if (slot > 0) {
+            const u32 left_id = parent.children[slot - 1];
+            if (leaf.size + leaves[left_id].size <= LeafCapacity) {
+                MergeLeaves(left_id, leaf_id);
+                RemoveChild(path, height, slot);
+            }
+        }
+    }
+
+    void MergeLeaves(u32 left_id, u32 right_id) {
+        Leaf& left = leaves[left_id];
+        const Leaf& right = leaves[right_id];
+        CopyEntries(left, left.size, right, 0, right.size);
+        left.size += right.size;
+        FreeLeaf(right_id);
+    }
+
+    std::vector<Leaf> leaves;
+    std::vector<Inner> inners;
+    std::vector<u32> free_leaves;
+    std::vector<u32> free_inners;
+    u32 root = Invalid;
+    u32 first_leaf = Invalid;
+    u32 height = 0;
+    size_t count = 0;
+};
+
+} // namespace Common
@@ -4,11 +4,16 @@
 // SPDX-FileCopyrightText: 2014 Citra Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <array>
 #include <atomic>
 #include <chrono>
 #include <climits>
+#include <optional>
 #include <regex>
+#include <span>
 #include <thread>
+#include <unordered_map>
+#include <vector>
 
 #include <boost/algorithm/string/replace.hpp>
 #include <fmt/ranges.h>
@@ -26,6 +31,7 @@
 #include "common/thread.h"
 
 #include "common/logging/backend.h"
+#include "common/logging/deferred.h"
 #include "common/logging/log.h"
 #include "common/logging/log_entry.h"
 #include "common/logging/text_formatter.h"
@@ -162,6 +168,86 @@ private:
     bool enabled = true;
 };
 
+/// @brief Writes deferred records verbatim to a compact binary log, see eden-log-decoder
+struct BinaryFileBackend final {
+    explicit BinaryFileBackend(const std::filesystem::path& filename) {
+        auto old_filename = filename;
+        old_filename += ".old";
+
+        void(FS::RemoveFile(old_filename));
+        void(FS::RenameFile(filename, old_filename));
+
+        file = std::make_unique<FS::IOFile>(filename, FS::FileAccessMode::Write, FS::FileType::BinaryFile);
+        const Deferred::Binary::FileHeader header{
+            .magic = Deferred::Binary::Magic,
+            .version = Deferred::Binary::Version,
+            .reserved = 0,
+        };
+        bytes_written += file->WriteObject(header) ? sizeof(header) : 0;
+    }
+
+    void Write(const Deferred::RecordHeader& record, std::chrono::microseconds timestamp) {
+        if (!enabled)
+            return;
+
+        chunk.clear();
+        const u32 file_id = Intern(TrimSourcePath(record.filename), {});
+        const u32 function_id = Intern(record.function, {});
+        const u32 format_id = Intern(record.format, record.format_size);
+        const auto args = Deferred::RecordArgs(record);
+
+        Append(Deferred::Binary::ChunkKind::Message);
+        Append(u64(timestamp.count()));
+        Append(record.log_class);
+        Append(record.log_level);
+        Append(record.num_args);
+        Append(record.line_num);
+        Append(file_id);
+        Append(function_id);
+        Append(format_id);
+        Append(u32(args.size()));
+        chunk.insert(chunk.end(), args.begin(), args.end());
+        bytes_written += file->WriteSpan(std::span<const u8>(chunk));
+
+        using namespace Common::Literals;
+        const auto write_limit = Settings::values.extended_logging.GetValue() ? 1_GiB : 100_MiB;
+        if (bytes_written > write_limit) {
+            enabled = false;
+            file->Flush();
+        }
+    }
+
+    void Flush() {
+        file->Flush();
+    }
+
+private:
+    template <typename T>
+    void Append(const T& value) {
+        const auto* const bytes = reinterpret_cast<const u8*>(&value);
+        chunk.insert(chunk.end(), bytes, bytes + sizeof(T));
+    }
+
+    /// Emits a string definition the first time a static string is seen and returns its id.
+    u32 Intern(const char* string, std::optional<u32> size) {
+        const auto [it, inserted] = string_ids.try_emplace(string, u32(string_ids.size()));
+        if (inserted) {
+            const std::string_view view = size ? std::string_view{string, *size} : std::string_view{string};
+            Append(Deferred::Binary::ChunkKind::String);
+            Append(it->second);
+            Append(u32(view.size()));
+            chunk.insert(chunk.end(), view.begin(), view.end());
+        }
+        return it->second;
+    }
+
+    std::unique_ptr<FS::IOFile> file;
+    std::unordered_map<const char*, u32> string_ids;
+    std::vector<u8> chunk;
+    std::size_t bytes_written = 0;
+    bool enabled = true;
+};
+
 #ifdef _WIN32
 /// @brief Backend that writes to Visual Studio's output window
 struct DebuggerBackend final : public Backend {
@@ -189,6 +275,12 @@ struct LogcatBackend : public Backend {
 
 bool initialization_in_progress_suppress_logging = true;
 
+/// How long the deferred drain thread sleeps when every thread ring is empty.
+constexpr auto DeferredPollInterval = std::chrono::milliseconds{2};
+
+/// How many entries move through the message queue in a single push or pop.
+constexpr std::size_t EntryBatchSize = 32;
+
 /// @brief Static state as a singleton.
 class Impl {
 public:
@@ -209,6 +301,8 @@ public:
         Filter filter;
         filter.ParseFilterString(Settings::values.log_filter.GetValue());
         instance = std::unique_ptr<Impl, decltype(&Deleter)>(new Impl(log_dir / LOG_FILE, filter), Deleter);
+        if (Settings::values.log_binary.GetValue())
+            instance->binary_backend = std::make_unique<BinaryFileBackend>(log_dir / BINARY_LOG_FILE);
         initialization_in_progress_suppress_logging = false;
     }
 
@@ -251,27 +345,83 @@ private:
     ~Impl() = default;
 
     void StartBackendThread() {
+        if (Settings::values.log_deferred.GetValue() || binary_backend)
+            StartDeferredThread();
         backend_thread = std::jthread([this](std::stop_token stop_token) {
             Common::SetCurrentThreadName("Logger");
-            Entry entry;
-            const auto write_logs = [this, &entry]() {
+            std::array<Entry, EntryBatchSize> entries;
+            const auto write_logs = [this](const Entry& entry) {
                 ForEachBackend([&entry](Backend& backend) {
                     backend.Write(entry);
                 });
             };
             do {
-                message_queue.PopWait(entry, stop_token);
-                write_logs();
+                const std::size_t count = message_queue.PopRangeWait(entries, stop_token);
+                for (std::size_t i = 0; i < count; ++i)
+                    write_logs(entries[i]);
             } while (!stop_token.stop_requested());
             // Drain the logging queue. Only writes out up to MAX_LOGS_TO_WRITE to prevent a
             // case where a system is repeatedly spamming logs even on close.
             int max_logs_to_write = filter.IsDebug() ? INT_MAX : 100;
+            Entry entry;
             while (max_logs_to_write-- && message_queue.TryPop(entry))
-                write_logs();
+                write_logs(entry);
+        });
+    }
+
+    void StartDeferredThread() {
+        Deferred::SetEnabled(true);
+        deferred_thread = std::jthread([this](std::stop_token stop_token) {
+            Common::SetCurrentThreadName("LoggerDeferred");
+            while (!stop_token.stop_requested()) {
+                if (DrainDeferredRecords() == 0)
+                    std::this_thread::sleep_for(DeferredPollInterval);
+            }
+            // Deferred mode is off by now, but threads may still be committing records.
+            Deferred::WaitForWriters();
+            DrainDeferredRecords();
         });
     }
 
+    /// Formats or writes out every record pending in the thread rings
+    std::size_t DrainDeferredRecords() {
+        // Formatted records are handed to the backend thread in batches.
+        std::array<Entry, EntryBatchSize> entries;
+        std::size_t num_entries = 0;
+        const std::size_t drained =
+            Deferred::DrainRecords([&](const Deferred::RecordHeader& record) {
+                const auto timestamp = Deferred::RecordTimestamp(record, time_origin);
+                if (binary_backend) {
+                    binary_backend->Write(record, timestamp);
+                    return;
+                }
+                entries[num_entries++] = Entry{
+                    .timestamp = timestamp,
+                    .log_class = record.log_class,
+                    .log_level = record.log_level,
+                    .filename = TrimSourcePath(record.filename),
+                    .line_num = record.line_num,
+                    .function = record.function,
+                    .message = Deferred::FormatArgs({record.format, record.format_size},
+                                                    Deferred::RecordArgs(record), record.num_args),
+                };
+                if (num_entries == entries.size()) {
+                    message_queue.PushRangeWait(entries);
+                    num_entries = 0;
+                }
+            });
+        message_queue.PushRangeWait(std::span{entries}.first(num_entries));
+        return drained;
+    }
+
     void StopBackendThread() {
+        // Records still in flight are formatted into the queue before the backend thread drains it.
+        Deferred::SetEnabled(false);
+        deferred_thread.request_stop();
+        if (deferred_thread.joinable())
+            deferred_thread.join();
+        if (binary_backend)
+            binary_backend->Flush();
         backend_thread.request_stop();
         if (backend_thread.joinable())
             backend_thread.join();
@@ -321,12 +471,23 @@ private:
     LogcatBackend lc_backend{};
 #endif
 
+    std::unique_ptr<BinaryFileBackend> binary_backend;
+
     MPSCQueue<Entry> message_queue{};
     std::chrono::steady_clock::time_point time_origin{std::chrono::steady_clock::now()};
     std::jthread backend_thread;
+    std::jthread deferred_thread;
 };
 } // namespace
 
+Deferred::ThreadRing* Deferred::detail::AcquireRing(Class log_class, Level log_level) noexcept {
+    if (initialization_in_progress_suppress_logging)
+        return nullptr;
+    if (!Impl::Instance().CanPushEntry(log_class, log_level))
+        return nullptr;
+    return &GetThreadRing();
+}
+
 void Initialize() {
     Impl::Initialize();
 }
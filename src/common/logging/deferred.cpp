@@ -0,0 +1,182 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <fmt/args.h>
+#include <fmt/format.h>
+
+#include "common/logging/deferred.h"
+
+namespace Common::Log::Deferred {
+
+namespace {
+
+/// Rings of every thread that has logged in deferred mode. Rings of exited threads are kept
+/// alive by the registry until the logger has drained them.
+class RingRegistry {
+public:
+    std::shared_ptr<ThreadRing> Register() {
+        auto ring = std::make_shared<ThreadRing>();
+        std::scoped_lock lock{mutex};
+        rings.push_back(ring);
+        return ring;
+    }
+
+    std::size_t Drain(const std::function<void(const RecordHeader&)>& func) {
+        std::scoped_lock lock{mutex};
+        std::size_t count = 0;
+        for (auto it = rings.begin(); it != rings.end();) {
+            count += (*it)->Drain(func);
+            // The registry holds the last reference once the owning thread has exited.
+            if (it->use_count() == 1 && (*it)->IsEmpty()) {
+                it = rings.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        return count;
+    }
+
+    void WaitForWriters() {
+        std::scoped_lock lock{mutex};
+        for (const auto& ring : rings) {
+            while (ring->IsWriting()) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+private:
+    std::mutex mutex;
+    std::vector<std::shared_ptr<ThreadRing>> rings;
+};
+
+RingRegistry& Registry() {
+    static RingRegistry registry;
+    return registry;
+}
+
+template <typename T>
+bool ReadValue(std::span<const u8>& args, T& value) {
+    if (args.size() < sizeof(T)) {
+        return false;
+    }
+    std::memcpy(&value, args.data(), sizeof(T));
+    args = args.subspan(sizeof(T));
+    return true;
+}
+
+} // Anonymous namespace
+
+std::size_t ThreadRing::Drain(const std::function<void(const RecordHeader&)>& func) {
+    const u64 write = write_index.load(std::memory_order::acquire);
+    u64 read = read_index.load(std::memory_order::relaxed);
+    std::size_t count = 0;
+    while (read != write) {
+        const auto* const header =
+            reinterpret_cast<const RecordHeader*>(buffer.data() + read % Capacity);
+        if (header->kind == RecordKind::Message) {
+            func(*header);
+            ++count;
+        }
+        read += header->size;
+    }
+    read_index.store(read, std::memory_order::release);
+    return count;
+}
+
+namespace detail {
+
+ThreadRing& GetThreadRing() {
+    thread_local const std::shared_ptr<ThreadRing> ring = Registry().Register();
+    return *ring;
+}
+
+} // namespace detail
+
+void SetEnabled(bool enabled) {
+    // Pairs with the recheck in LogMessage.
+    detail::enabled.store(enabled, std::memory_order::seq_cst);
+}
+
+void WaitForWriters() {
+    Registry().WaitForWriters();
+}
+
+std::size_t DrainRecords(const std::function<void(const RecordHeader&)>& func) {
+    return Registry().Drain(func);
+}
+
+std::span<const u8> RecordArgs(const RecordHeader& header) {
+    const u8* const begin = reinterpret_cast<const u8*>(&header) + sizeof(RecordHeader);
+    return {begin, header.size - sizeof(RecordHeader)};
+}
+
+std::string FormatArgs(std::string_view format, std::span<const u8> args, std::size_t num_args) {
+    fmt::dynamic_format_arg_store<fmt::format_context> store;
+    store.reserve(num_args, 0);
+    for (std::size_t i = 0; i < num_args; ++i) {
+        u8 type{};
+        u64 raw{};
+        if (!ReadValue(args, type)) {
+            return fmt::format("<truncated log arguments> {}", format);
+        }
+        if (static_cast<ArgType>(type) == ArgType::String) {
+            u32 size{};
+            if (!ReadValue(args, size) || args.size() < size) {
+                return fmt::format("<truncated log arguments> {}", format);
+            }
+            store.push_back(std::string(reinterpret_cast<const char*>(args.data()), size));
+            args = args.subspan(size);
+            continue;
+        }
+        if (!ReadValue(args, raw)) {
+            return fmt::format("<truncated log arguments> {}", format);
+        }
+        switch (static_cast<ArgType>(type)) {
+        case ArgType::Bool:
+            store.push_back(raw != 0);
+            break;
+        case ArgType::Char:
+            store.push_back(static_cast<char>(raw));
+            break;
+        case ArgType::Signed:
+            store.push_back(static_cast<s64>(raw));
+            break;
+        case ArgType::Unsigned:
+            store.push_back(raw);
+            break;
+        case ArgType::Double: {
+            double value;
+            std::memcpy(&value, &raw, sizeof(value));
+            store.push_back(value);
+            break;
+        }
+        case ArgType::Pointer:
+            store.push_back(reinterpret_cast<const void*>(static_cast<uintptr_t>(raw)));
+            break;
+        default:
+            return fmt::format("<invalid log argument type {}> {}", type, format);
+        }
+    }
+    try {
+        return fmt::vformat(format, store);
+    } catch (const fmt::format_error& e) {
+        return fmt::format("<log format error: {}> {}", e.what(), format);
+    }
+}
+
+std::chrono::microseconds RecordTimestamp(const RecordHeader& header,
+                                          std::chrono::steady_clock::time_point origin) {
+    using std::chrono::duration_cast;
+    using std::chrono::microseconds;
+    using std::chrono::steady_clock;
+    const steady_clock::time_point time{steady_clock::duration{header.timestamp}};
+    return duration_cast<microseconds>(time - origin);
+}
+
+} // namespace Common::Log::Deferred
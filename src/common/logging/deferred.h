@@ -0,0 +1,350 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <functional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include <fmt/format.h>
+
+#include "common/common_types.h"
+#include "common/logging/types.h"
+
+namespace Common::Log::Deferred {
+
+/**
+ * Deferred logging moves the cost of fmt formatting off the calling thread. The hot path only
+ * copies the format string pointer, a timestamp and the raw arguments into a per-thread ring, and
+ * the logger drains the rings from a background thread where the messages are either formatted
+ * into regular entries or written verbatim to a compact binary log (see `eden-log-decoder`).
+ *
+ * Only arguments with a trivially serializable representation are supported. Messages with any
+ * other argument type, including enums with their own fmt::formatter, transparently fall back to
+ * immediate formatting.
+ */
+
+/// Tag written in front of every serialized argument.
+enum class ArgType : u8 {
+    Bool,
+    Char,
+    Signed,
+    Unsigned,
+    Double,
+    Pointer,
+    String,
+};
+
+enum class RecordKind : u8 {
+    Message,
+    Padding,
+};
+
+/// Fixed-size header of a record in a thread ring, followed by `num_args` serialized arguments.
+struct RecordHeader {
+    u32 size;
+    RecordKind kind;
+    Class log_class;
+    Level log_level;
+    u8 num_args;
+    u32 line_num;
+    u32 format_size;
+    s64 timestamp;
+    const char* filename;
+    const char* function;
+    const char* format;
+};
+
+/// Records are kept 8-byte aligned so headers can be read in place.
+constexpr std::size_t RecordAlignment = 8;
+
+/// Longest string argument that is copied verbatim, longer strings are truncated.
+constexpr std::size_t MaxStringArgSize = 1024;
+
+/// Appended to string arguments that were truncated.
+constexpr std::string_view TruncationMarker = "…";
+
+/// Single-producer single-consumer byte ring owned by one logging thread.
+class ThreadRing {
+public:
+    static constexpr std::size_t Capacity = 0x10000;
+
+    /// Reserves `size` contiguous bytes for a new record, returns nullptr when the ring is full.
+    u8* Reserve(std::size_t size) noexcept {
+        const u64 write = write_index.load(std::memory_order::relaxed);
+        const std::size_t offset = write % Capacity;
+        const std::size_t tail_room = Capacity - offset;
+        const std::size_t padding = size > tail_room ? tail_room : 0;
+        if (write + padding + size - read_index.load(std::memory_order::acquire) > Capacity) {
+            return nullptr;
+        }
+        if (padding != 0) {
+            RecordHeader* const header = reinterpret_cast<RecordHeader*>(buffer.data() + offset);
+            header->size = static_cast<u32>(padding);
+            header->kind = RecordKind::Padding;
+        }
+        pending_padding = padding;
+        return buffer.data() + (write + padding) % Capacity;
+    }
+
+    /// Publishes the record previously returned by Reserve.
+    void Commit(std::size_t size) noexcept {
+        const u64 write = write_index.load(std::memory_order::relaxed);
+        write_index.store(write + pending_padding + size, std::memory_order::release);
+    }
+
+    /// Marks the owning thread as writing a record, so that the logger can wait for it to finish
+    /// before its final drain.
+    void BeginWrite() noexcept {
+        writing.store(true, std::memory_order::seq_cst);
+    }
+
+    void EndWrite() noexcept {
+        writing.store(false, std::memory_order::release);
+    }
+
+    bool IsWriting() const noexcept {
+        return writing.load(std::memory_order::acquire);
+    }
+
+    /// Invokes `func` on every published record, returns the number of records consumed.
+    std::size_t Drain(const std::function<void(const RecordHeader&)>& func);
+
+    bool IsEmpty() const noexcept {
+        return read_index.load(std::memory_order::relaxed) ==
+               write_index.load(std::memory_order::acquire);
+    }
+
+private:
+    alignas(64) std::atomic<u64> write_index{0};
+    std::size_t pending_padding{0};
+    std::atomic_bool writing{false};
+    alignas(64) std::atomic<u64> read_index{0};
+    alignas(64) std::array<u8, Capacity> buffer{};
+};
+
+namespace detail {
+
+inline std::atomic_bool enabled{false};
+
+template <typename T>
+using Decay = std::remove_cvref_t<T>;
+
+template <typename T>
+constexpr bool IsStringArg =
+    std::is_same_v<Decay<T>, std::string> || std::is_same_v<Decay<T>, std::string_view> ||
+    std::is_same_v<std::decay_t<T>, const char*> || std::is_same_v<std::decay_t<T>, char*>;
+
+/// Enums are stored as their underlying value, unless they have a formatter that prints them
+/// differently. The primary fmt::formatter template is not constructible, and the generic enum
+/// formatter in common/logging/formatter.h prints the underlying value.
+template <typename T>
+constexpr bool IsPlainEnum =
+    std::is_enum_v<Decay<T>> &&
+    (!std::is_default_constructible_v<fmt::formatter<Decay<T>>> ||
+     requires { requires fmt::formatter<Decay<T>>::formats_underlying_value; });
+
+template <typename T>
+constexpr bool IsEncodable =
+    std::is_arithmetic_v<Decay<T>> || IsPlainEnum<T> || IsStringArg<T> ||
+    std::is_same_v<Decay<T>, const void*> || std::is_same_v<Decay<T>, void*>;
+
+constexpr std::size_t AlignUp(std::size_t size) {
+    return (size + RecordAlignment - 1) & ~(RecordAlignment - 1);
+}
+
+template <typename T>
+std::string_view AsStringView(const T& value) {
+    using V = Decay<T>;
+    if constexpr (std::is_array_v<V>) {
+        // Character arrays need not be null terminated within their extent.
+        return std::string_view{value, strnlen(value, std::extent_v<V>)};
+    } else if constexpr (std::is_pointer_v<V>) {
+        return value ? std::string_view{value} : std::string_view{"(null)"};
+    } else {
+        return value;
+    }
+}
+
+/// Size of a string argument once encoded, including the marker if it is truncated.
+constexpr std::size_t EncodedStringSize(std::string_view view) {
+    return view.size() > MaxStringArgSize ? MaxStringArgSize + TruncationMarker.size()
+                                          : view.size();
+}
+
+template <typename T>
+std::size_t EncodedSize(const T& value) {
+    if constexpr (IsStringArg<T>) {
+        return sizeof(ArgType) + sizeof(u32) + EncodedStringSize(AsStringView(value));
+    } else {
+        return sizeof(ArgType) + sizeof(u64);
+    }
+}
+
+template <typename T>
+u8* Encode(u8* out, const T& value) {
+    const auto put = [&out](ArgType type, const void* data, std::size_t size) {
+        *out++ = static_cast<u8>(type);
+        std::memcpy(out, data, size);
+        out += size;
+    };
+    using V = Decay<T>;
+    if constexpr (IsStringArg<T>) {
+        const std::string_view view = AsStringView(value);
+        const u32 size = static_cast<u32>(EncodedStringSize(view));
+        put(ArgType::String, &size, sizeof(size));
+        if (view.size() > MaxStringArgSize) {
+            std::memcpy(out, view.data(), MaxStringArgSize);
+            std::memcpy(out + MaxStringArgSize, TruncationMarker.data(), TruncationMarker.size());
+        } else {
+            std::memcpy(out, view.data(), view.size());
+        }
+        out += size;
+    } else if constexpr (std::is_same_v<V, bool>) {
+        const u64 raw = value ? 1 : 0;
+        put(ArgType::Bool, &raw, sizeof(raw));
+    } else if constexpr (std::is_same_v<V, char>) {
+        const u64 raw = static_cast<u8>(value);
+        put(ArgType::Char, &raw, sizeof(raw));
+    } else if constexpr (std::is_floating_point_v<V>) {
+        const double raw = static_cast<double>(value);
+        put(ArgType::Double, &raw, sizeof(raw));
+    } else if constexpr (std::is_pointer_v<V>) {
+        const u64 raw = reinterpret_cast<uintptr_t>(value);
+        put(ArgType::Pointer, &raw, sizeof(raw));
+    } else if constexpr (std::is_enum_v<V>) {
+        out = Encode(out, static_cast<std::underlying_type_t<V>>(value));
+    } else if constexpr (std::is_signed_v<V>) {
+        const s64 raw = value;
+        put(ArgType::Signed, &raw, sizeof(raw));
+    } else {
+        const u64 raw = value;
+        put(ArgType::Unsigned, &raw, sizeof(raw));
+    }
+    return out;
+}
+
+/// Returns the calling thread's ring, registering it with the logger on first use.
+ThreadRing& GetThreadRing();
+
+/// Returns the calling thread's ring if the message passes the global filter, nullptr otherwise.
+ThreadRing* AcquireRing(Class log_class, Level log_level) noexcept;
+
+} // namespace detail
+
+/// Whether a message with the given argument types can take the deferred path.
+template <typename... Args>
+constexpr bool CanDefer = (detail::IsEncodable<Args> && ...);
+
+/// Whether the logger is currently running in deferred mode.
+inline bool IsEnabled() noexcept {
+    return detail::enabled.load(std::memory_order::relaxed);
+}
+
+/// Switches the hot path between deferred and immediate formatting.
+void SetEnabled(bool enabled);
+
+/**
+ * Records a message into the calling thread's ring.
+ * The format string, filename and function must have static storage duration.
+ * @returns false when the message has to go through immediate formatting instead.
+ */
+template <typename... Args>
+bool LogMessage(Class log_class, Level log_level, const char* filename, unsigned int line_num,
+                const char* function, std::string_view format, const Args&... args) {
+    // Warnings and errors are rare and must reach the log even if the process dies right after.
+    if (log_level >= Level::Warning) {
+        return false;
+    }
+    ThreadRing* const ring = detail::AcquireRing(log_class, log_level);
+    if (!ring) {
+        // Filtered out, report as handled so nothing is formatted.
+        return true;
+    }
+    const std::size_t size =
+        detail::AlignUp(sizeof(RecordHeader) + (std::size_t{0} + ... + detail::EncodedSize(args)));
+    if (size > ThreadRing::Capacity / 4) {
+        return false;
+    }
+    // Recheck after marking the write, as the logger may have stopped deferring since the caller
+    // checked and only waits for writes it can see.
+    ring->BeginWrite();
+    if (!detail::enabled.load(std::memory_order::seq_cst)) {
+        ring->EndWrite();
+        return false;
+    }
+    u8* const data = ring->Reserve(size);
+    if (!data) {
+        ring->EndWrite();
+        return false;
+    }
+    RecordHeader* const header = reinterpret_cast<RecordHeader*>(data);
+    header->size = static_cast<u32>(size);
+    header->kind = RecordKind::Message;
+    header->log_class = log_class;
+    header->log_level = log_level;
+    header->num_args = static_cast<u8>(sizeof...(Args));
+    header->line_num = line_num;
+    header->format_size = static_cast<u32>(format.size());
+    header->timestamp = std::chrono::steady_clock::now().time_since_epoch().count();
+    header->filename = filename;
+    header->function = function;
+    header->format = format.data();
+    [[maybe_unused]] u8* out = data + sizeof(RecordHeader);
+    ((out = detail::Encode(out, args)), ...);
+    ring->Commit(size);
+    ring->EndWrite();
+    return true;
+}
+
+/// Waits until no thread is in the middle of writing a record. Records written afterwards see
+/// deferred mode disabled and are formatted immediately.
+void WaitForWriters();
+
+/// Invokes `func` on every pending record of every thread ring, returns the number of records.
+std::size_t DrainRecords(const std::function<void(const RecordHeader&)>& func);
+
+/// Returns the serialized arguments that follow a record header.
+std::span<const u8> RecordArgs(const RecordHeader& header);
+
+/**
+ * Formats a message from its format string and serialized arguments.
+ * Malformed argument data yields a diagnostic string instead of throwing.
+ */
+std::string FormatArgs(std::string_view format, std::span<const u8> args, std::size_t num_args);
+
+/// Converts a record timestamp into a duration relative to `origin`.
+std::chrono::microseconds RecordTimestamp(const RecordHeader& header,
+                                          std::chrono::steady_clock::time_point origin);
+
+namespace Binary {
+
+/// Layout of the binary log written when `binary_logging` is enabled.
+constexpr std::array<char, 8> Magic{'E', 'D', 'E', 'N', 'B', 'L', 'O', 'G'};
+constexpr u32 Version = 1;
+
+struct FileHeader {
+    std::array<char, 8> magic;
+    u32 version;
+    u32 reserved;
+};
+static_assert(sizeof(FileHeader) == 16);
+
+enum class ChunkKind : u8 {
+    /// Interns a string: u32 id, u32 size, followed by the string bytes.
+    String,
+    /// A message: u64 timestamp (us), u8 class, u8 level, u8 num_args, u32 line, u32 file id,
+    /// u32 function id, u32 format id, u32 args size, followed by the serialized arguments.
+    Message,
+};
+
+} // namespace Binary
+
+} // namespace Common::Log::Deferred
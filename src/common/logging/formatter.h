@@ -16,6 +16,9 @@
 template <typename T>
 struct fmt::formatter<T, std::enable_if_t<std::is_enum_v<T>, char>>
     : formatter<std::underlying_type_t<T>> {
+    /// Lets deferred logging store these enums as their underlying value.
+    static constexpr bool formats_underlying_value = true;
+
     template <typename FormatContext>
     auto format(const T& value, FormatContext& ctx) const -> decltype(ctx.out()) {
         return fmt::formatter<std::underlying_type_t<T>>::format(
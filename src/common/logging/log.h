@@ -11,6 +11,7 @@
 
 #include <fmt/ranges.h>
 
+#include "common/logging/deferred.h"
 #include "common/logging/formatter.h"
 #include "common/logging/types.h"
 
@@ -24,6 +25,15 @@ void FmtLogMessageImpl(Class log_class, Level log_level, const char* filename,
 template <typename... Args>
 void FmtLogMessage(Class log_class, Level log_level, const char* filename, unsigned int line_num,
                    const char* function, fmt::format_string<Args...> format, const Args&... args) {
+    if constexpr (Deferred::CanDefer<Args...>) {
+        if (Deferred::IsEnabled()) {
+            const fmt::string_view view = format;
+            if (Deferred::LogMessage(log_class, log_level, filename, line_num, function,
+                                     std::string_view{view.data(), view.size()}, args...)) {
+                return;
+            }
+        }
+    }
     FmtLogMessageImpl(log_class, log_level, filename, line_num, function, format,
                       fmt::make_format_args(args...));
 }
@@ -23,6 +23,11 @@ public:
 
     void Add(AddressType base_address, size_t size);
     void Subtract(AddressType base_address, size_t size);
+
+    /// Adds or removes all ranges of another set, merging both sets in one pass when it is large.
+    void Add(const RangeSet& other);
+    void Subtract(const RangeSet& other);
+
     void Clear();
     bool Empty() const;
 
@@ -219,6 +219,7 @@ struct Values {
                                             Specialization::Default};
 
     // Memory
+    Setting<HugePages, true> huge_pages{linkage, HugePages::Off, "huge_pages", Category::Core};
 #ifdef HAS_NCE
     SwitchableSetting<bool> lru_cache_enabled{linkage, false, "use_lru_cache", Category::System};
 #endif
@@ -241,6 +242,10 @@ struct Values {
     SwitchableSetting<CpuAccuracy, true> cpu_accuracy{linkage, CpuAccuracy::Auto,
                                                       "cpu_accuracy", Category::Cpu};
     SwitchableSetting<bool> vtable_bouncing{linkage, true, "vtable_bouncing", Category::Cpu};
+    SwitchableSetting<bool> use_jit_translation_cache{linkage, false, "use_jit_translation_cache",
+                                                      Category::Cpu};
+    SwitchableSetting<bool> use_speculative_jit_compilation{
+        linkage, false, "use_speculative_jit_compilation", Category::Cpu};
     SwitchableSetting<bool> use_fast_cpu_time{linkage,
                                               false,
                                               "use_fast_cpu_time",
@@ -285,6 +290,14 @@ struct Values {
                                              Category::CpuDebug};
     Setting<bool> cpuopt_const_prop{linkage, true, "cpuopt_const_prop", Category::CpuDebug};
     Setting<bool> cpuopt_misc_ir{linkage, true, "cpuopt_misc_ir", Category::CpuDebug};
+    Setting<bool> cpuopt_trace_formation{linkage, false, "cpuopt_trace_formation",
+                                         Category::CpuDebug};
+    Setting<bool> cpuopt_tiered_compilation{linkage, false, "cpuopt_tiered_compilation",
+                                            Category::CpuDebug};
+    Setting<bool> cpuopt_live_interval_regalloc{linkage, false, "cpuopt_live_interval_regalloc",
+                                                Category::CpuDebug};
+    Setting<bool> cpuopt_memory_forwarding{linkage, false, "cpuopt_memory_forwarding",
+                                           Category::CpuDebug};
     Setting<bool> cpuopt_reduce_misalign_checks{linkage, true, "cpuopt_reduce_misalign_checks",
                                                 Category::CpuDebug};
     SwitchableSetting<bool> cpuopt_fastmem{linkage, true, "cpuopt_fastmem", Category::CpuDebug};
@@ -711,6 +724,8 @@ struct Values {
     Setting<bool> extended_logging{
                                    linkage, false, "extended_logging", Category::Debugging, Specialization::Default, false};
     Setting<bool> use_debug_asserts{linkage, false, "use_debug_asserts", Category::Debugging};
+    Setting<bool> enable_tracing{linkage, false, "enable_tracing", Category::Debugging};
+    Setting<bool> enable_call_stats{linkage, false, "enable_call_stats", Category::Debugging};
     Setting<bool> use_auto_stub{
                                 linkage, false, "use_auto_stub", Category::Debugging};
     Setting<bool> enable_all_controllers{linkage, false, "enable_all_controllers",
@@ -733,6 +748,8 @@ struct Values {
     Setting<std::string> serial_unit{linkage, std::string(), "serial_unit", Category::Miscellaneous};
     Setting<std::string> log_filter{linkage, "*:Info", "log_filter", Category::Miscellaneous};
     Setting<bool> log_flush_line{linkage, false, "flush_line", Category::Miscellaneous, Specialization::Default, true, true};
+    Setting<bool> log_deferred{linkage, false, "deferred_logging", Category::Miscellaneous};
+    Setting<bool> log_binary{linkage, false, "binary_logging", Category::Miscellaneous};
     Setting<bool> censor_username{linkage, true, "censor_username", Category::Miscellaneous};
     Setting<bool> first_launch{linkage, true, "first_launch", Category::Miscellaneous};
 
@@ -151,6 +151,7 @@ ENUM(AppletMode, HLE, LLE);
 ENUM(SpirvOptimizeMode, Never, OnLoad, Always);
 ENUM(GpuOverclock, Low, Medium, High)
 ENUM(TemperatureUnits, Celsius, Fahrenheit)
+ENUM(HugePages, Off, Transparent, HugeTlb)
 
 template <typename Type>
 inline std::string_view CanonicalizeEnum(Type id) {
@@ -0,0 +1,264 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <algorithm>
+#include <thread>
+
+#include <fmt/format.h>
+
+#include "common/task_scheduler.h"
+#include "common/thread.h"
+
+namespace Common {
+
+namespace {
+
+/// Scheduler and worker index of the calling thread, if it is a worker.
+thread_local TaskScheduler* current_scheduler{};
+thread_local std::size_t current_worker{};
+
+std::size_t DefaultWorkerCount() {
+    const std::size_t max_core_threads =
+        (std::max)(static_cast<std::size_t>(std::thread::hardware_concurrency()), std::size_t{2}) -
+        1;
+#ifdef ANDROID
+    // Leave at least a few cores free in android
+    constexpr std::size_t free_cores = 3;
+    if (max_core_threads <= free_cores) {
+        return 1;
+    }
+    return max_core_threads - free_cores;
+#else
+    return max_core_threads;
+#endif
+}
+
+} // Anonymous namespace
+
+bool TaskScheduler::WorkStealingDeque::Push(TaskNode* node) noexcept {
+    const s64 b = bottom.load(std::memory_order::relaxed);
+    const s64 t = top.load(std::memory_order::acquire);
+    if (b - t >= Capacity) {
+        return false;
+    }
+    buffer[static_cast<std::size_t>(b % Capacity)].store(node, std::memory_order::relaxed);
+    std::atomic_thread_fence(std::memory_order::release);
+    bottom.store(b + 1, std::memory_order::relaxed);
+    return true;
+}
+
+TaskScheduler::TaskNode* TaskScheduler::WorkStealingDeque::Pop() noexcept {
+    const s64 b = bottom.load(std::memory_order::relaxed) - 1;
+    bottom.store(b, std::memory_order::relaxed);
+    std::atomic_thread_fence(std::memory_order::seq_cst);
+    s64 t = top.load(std::memory_order::relaxed);
+    if (t > b) {
+        // Empty, restore the bottom.
+        bottom.store(b + 1, std::memory_order::relaxed);
+        return nullptr;
+    }
+    TaskNode* node = buffer[static_cast<std::size_t>(b % Capacity)].load(std::memory_order::relaxed);
+    if (t == b) {
+        // Last element, race against thieves for it.
+        if (!top.compare_exchange_strong(t, t + 1, std::memory_order::seq_cst,
+                                         std::memory_order::relaxed)) {
+            node = nullptr;
+        }
+        bottom.store(b + 1, std::memory_order::relaxed);
+    }
+    return node;
+}
+
+TaskScheduler::TaskNode* TaskScheduler::WorkStealingDeque::Steal() noexcept {
+    s64 t = top.load(std::memory_order::acquire);
+    std::atomic_thread_fence(std::memory_order::seq_cst);
+    const s64 b = bottom.load(std::memory_order::acquire);
+    if (t >= b) {
+        return nullptr;
+    }
+    TaskNode* const node =
+        buffer[static_cast<std::size_t>(t % Capacity)].load(std::memory_order::relaxed);
+    if (!top.compare_exchange_strong(t, t + 1, std::memory_order::seq_cst,
+                                     std::memory_order::relaxed)) {
+        return nullptr;
+    }
+    return node;
+}
+
+TaskScheduler::TaskScheduler(std::size_t num_workers, std::string name)
+    : thread_name{std::move(name)} {
+    num_workers = (std::max)(num_workers, std::size_t{1});
+    workers.reserve(num_workers);
+    for (std::size_t i = 0; i < num_workers; ++i) {
+        workers.push_back(std::make_unique<Worker>());
+    }
+    // Start the threads only once every deque exists, workers steal from each other.
+    for (std::size_t i = 0; i < num_workers; ++i) {
+        workers[i]->thread = std::jthread(
+            [this, i](std::stop_token stop_token) { WorkerLoop(i, stop_token); });
+    }
+}
+
+TaskScheduler::~TaskScheduler() {
+    for (auto& worker : workers) {
+        worker->thread.request_stop();
+    }
+    for (auto& worker : workers) {
+        if (worker->thread.joinable()) {
+            worker->thread.join();
+        }
+    }
+    // Drop whatever was not picked up before shutdown.
+    for (auto& worker : workers) {
+        for (auto& deque : worker->deques) {
+            while (TaskNode* const node = deque.Pop()) {
+                delete node;
+            }
+        }
+    }
+    for (auto& queue : injection_queues) {
+        for (TaskNode* const node : queue) {
+            delete node;
+        }
+    }
+}
+
+void TaskScheduler::Schedule(Task task, TaskPriority priority) {
+    Push(new TaskNode{std::move(task)}, priority);
+}
+
+void TaskScheduler::Push(TaskNode* node, TaskPriority priority) {
+    const auto priority_index = static_cast<std::size_t>(priority);
+    num_queued.fetch_add(1, std::memory_order::seq_cst);
+    if (current_scheduler != this ||
+        !workers[current_worker]->deques[priority_index].Push(node)) {
+        std::scoped_lock lock{injection_mutex};
+        injection_queues[priority_index].push_back(node);
+    }
+    if (num_sleeping.load(std::memory_order::seq_cst) != 0) {
+        std::scoped_lock lock{sleep_mutex};
+        sleep_cv.notify_one();
+    }
+}
+
+TaskScheduler::TaskNode* TaskScheduler::FindTask(std::size_t index) {
+    const std::size_t num_workers = workers.size();
+    for (std::size_t priority = 0; priority < injection_queues.size(); ++priority) {
+        if (TaskNode* const node = workers[index]->deques[priority].Pop()) {
+            return node;
+        }
+        {
+            std::scoped_lock lock{injection_mutex};
+            auto& queue = injection_queues[priority];
+            if (!queue.empty()) {
+                TaskNode* const node = queue.front();
+                queue.pop_front();
+                return node;
+            }
+        }
+        for (std::size_t offset = 1; offset < num_workers; ++offset) {
+            Worker& victim = *workers[(index + offset) % num_workers];
+            if (TaskNode* const node = victim.deques[priority].Steal()) {
+                return node;
+            }
+        }
+    }
+    return nullptr;
+}
+
+void TaskScheduler::WorkerLoop(std::size_t index, std::stop_token stop_token) {
+    Common::SetCurrentThreadName(fmt::format("{}:{}", thread_name, index).c_str());
+    current_scheduler = this;
+    current_worker = index;
+    while (!stop_token.stop_requested()) {
+        if (TaskNode* const node = FindTask(index)) {
+            num_queued.fetch_sub(1, std::memory_order::relaxed);
+            node->func();
+            delete node;
+            continue;
+        }
+        std::unique_lock lock{sleep_mutex};
+        num_sleeping.fetch_add(1, std::memory_order::seq_cst);
+        sleep_cv.wait(lock, stop_token,
+                      [this] { return num_queued.load(std::memory_order::seq_cst) != 0; });
+        num_sleeping.fetch_sub(1, std::memory_order::relaxed);
+    }
+    current_scheduler = nullptr;
+}
+
+TaskScheduler& GetTaskScheduler() {
+    static TaskScheduler scheduler{DefaultWorkerCount(), "TaskWorker"};
+    return scheduler;
+}
+
+TaskGroup::TaskGroup(TaskPriority priority, std::size_t max_concurrency, TaskScheduler& scheduler)
+    : state{std::make_shared<State>(scheduler, priority,
+                                    (std::max)(max_concurrency, std::size_t{1}))} {}
+
+TaskGroup::~TaskGroup() {
+    Cancel();
+    std::unique_lock lock{state->mutex};
+    state->cv.wait(lock, [this] { return state->active == 0; });
+}
+
+void TaskGroup::QueueWork(Task task) {
+    std::scoped_lock lock{state->mutex};
+    state->pending.push_back(std::move(task));
+    state->ScheduleRunnersLocked(state);
+}
+
+void TaskGroup::Wait(std::stop_token stop_token) {
+    std::stop_callback callback(stop_token, [this] { Cancel(); });
+    std::unique_lock lock{state->mutex};
+    while (true) {
+        // Help out instead of blocking, this keeps nested waits from starving the workers.
+        if (state->RunOne(lock)) {
+            continue;
+        }
+        if (state->pending.empty() && state->active == 0) {
+            return;
+        }
+        state->cv.wait(lock);
+    }
+}
+
+void TaskGroup::Cancel() {
+    std::deque<Task> dropped;
+    {
+        std::scoped_lock lock{state->mutex};
+        dropped.swap(state->pending);
+        state->cv.notify_all();
+    }
+}
+
+void TaskGroup::State::ScheduleRunnersLocked(const std::shared_ptr<State>& self) {
+    while (active + scheduled < max_concurrency && scheduled < pending.size()) {
+        ++scheduled;
+        scheduler.Schedule([self] { self->RunnerEntry(); }, priority);
+    }
+}
+
+void TaskGroup::State::RunnerEntry() {
+    std::unique_lock lock{mutex};
+    --scheduled;
+    while (RunOne(lock)) {
+    }
+}
+
+bool TaskGroup::State::RunOne(std::unique_lock<std::mutex>& lock) {
+    if (pending.empty() || active >= max_concurrency) {
+        return false;
+    }
+    Task task = std::move(pending.front());
+    pending.pop_front();
+    ++active;
+    lock.unlock();
+    task();
+    task = Task{};
+    lock.lock();
+    --active;
+    cv.notify_all();
+    return true;
+}
+
+} // namespace Common
@@ -0,0 +1,167 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "common/common_types.h"
+#include "common/polyfill_thread.h"
+#include "common/unique_function.h"
+
+namespace Common {
+
+/// Tasks of a higher priority are always picked before lower priority ones.
+enum class TaskPriority : u8 {
+    High,   ///< Something is blocked on the result, e.g. texture transcoding on the GPU thread.
+    Normal, ///< Background work with visible latency, e.g. pipeline compilation.
+    Low,    ///< Work nobody waits on, e.g. disk cache serialization.
+    Count,
+};
+
+/**
+ * Pool of worker threads shared by every subsystem that has parallel work.
+ *
+ * Each worker owns one work-stealing deque per priority. Tasks scheduled from a worker go to its
+ * own deque and are popped in LIFO order, tasks scheduled from any other thread go to a shared
+ * injection queue. Idle workers steal from the other workers in FIFO order before sleeping.
+ */
+class TaskScheduler {
+public:
+    using Task = UniqueFunction<void>;
+
+    explicit TaskScheduler(std::size_t num_workers, std::string name);
+    ~TaskScheduler();
+
+    TaskScheduler(const TaskScheduler&) = delete;
+    TaskScheduler& operator=(const TaskScheduler&) = delete;
+
+    TaskScheduler(TaskScheduler&&) = delete;
+    TaskScheduler& operator=(TaskScheduler&&) = delete;
+
+    /// Queues a task to be executed on any worker.
+    void Schedule(Task task, TaskPriority priority = TaskPriority::Normal);
+
+    [[nodiscard]] std::size_t NumWorkers() const noexcept {
+        return workers.size();
+    }
+
+private:
+    struct TaskNode {
+        Task func;
+    };
+
+    /// Chase-Lev deque. The owner pushes and pops at the bottom, thieves steal from the top.
+    class WorkStealingDeque {
+    public:
+        static constexpr s64 Capacity = 1024;
+
+        bool Push(TaskNode* node) noexcept;
+        TaskNode* Pop() noexcept;
+        TaskNode* Steal() noexcept;
+
+    private:
+        alignas(64) std::atomic<s64> top{0};
+        alignas(64) std::atomic<s64> bottom{0};
+        std::array<std::atomic<TaskNode*>, Capacity> buffer{};
+    };
+
+    struct Worker {
+        std::array<WorkStealingDeque, static_cast<std::size_t>(TaskPriority::Count)> deques;
+        std::jthread thread;
+    };
+
+    void WorkerLoop(std::size_t index, std::stop_token stop_token);
+    TaskNode* FindTask(std::size_t index);
+    void Push(TaskNode* node, TaskPriority priority);
+
+    std::vector<std::unique_ptr<Worker>> workers;
+    std::string thread_name;
+
+    std::mutex injection_mutex;
+    std::array<std::deque<TaskNode*>, static_cast<std::size_t>(TaskPriority::Count)>
+        injection_queues;
+
+    /// Number of tasks that have been scheduled but not picked up by a worker yet.
+    std::atomic<std::size_t> num_queued{0};
+    std::atomic<std::size_t> num_sleeping{0};
+    std::mutex sleep_mutex;
+    std::condition_variable_any sleep_cv;
+};
+
+/// Returns the scheduler shared by the whole process, sized to the host's core count.
+TaskScheduler& GetTaskScheduler();
+
+/**
+ * Group of related tasks that can be waited on as a whole.
+ *
+ * Tasks are kept in the group and handed to the scheduler through at most `max_concurrency`
+ * runners, so a group with a concurrency of one executes its tasks in submission order without
+ * ever occupying more than one worker. Waiting on a group executes its pending tasks on the
+ * waiting thread, which makes nested waits from inside a task safe.
+ *
+ * Destroying a group drops its pending tasks and blocks until running tasks have finished.
+ */
+class TaskGroup {
+public:
+    using Task = UniqueFunction<void>;
+
+    static constexpr std::size_t Unbounded = std::numeric_limits<std::size_t>::max();
+
+    explicit TaskGroup(TaskPriority priority = TaskPriority::Normal,
+                       std::size_t max_concurrency = Unbounded,
+                       TaskScheduler& scheduler = GetTaskScheduler());
+    ~TaskGroup();
+
+    TaskGroup(const TaskGroup&) = delete;
+    TaskGroup& operator=(const TaskGroup&) = delete;
+
+    TaskGroup(TaskGroup&&) = delete;
+    TaskGroup& operator=(TaskGroup&&) = delete;
+
+    void QueueWork(Task task);
+
+    /// Blocks until every queued task has executed. Pending tasks are dropped when a stop is
+    /// requested through the token.
+    void Wait(std::stop_token stop_token = {});
+
+    /// Drops every task that has not started yet.
+    void Cancel();
+
+private:
+    /// Shared with the runners so a runner that starts after the group is gone finds no work.
+    struct State {
+        explicit State(TaskScheduler& scheduler_, TaskPriority priority_,
+                       std::size_t max_concurrency_)
+            : scheduler{scheduler_}, priority{priority_}, max_concurrency{max_concurrency_} {}
+
+        TaskScheduler& scheduler;
+        const TaskPriority priority;
+        const std::size_t max_concurrency;
+
+        std::mutex mutex;
+        std::condition_variable cv;
+        std::deque<Task> pending;
+        /// Tasks currently executing.
+        std::size_t active{};
+        /// Runners handed to the scheduler that have not started yet.
+        std::size_t scheduled{};
+
+        void ScheduleRunnersLocked(const std::shared_ptr<State>& self);
+        void RunnerEntry();
+        bool RunOne(std::unique_lock<std::mutex>& lock);
+    };
+
+    std::shared_ptr<State> state;
+};
+
+} // namespace Common
@@ -9,6 +9,7 @@
 #include "common/error.h"
 #include "common/logging/log.h"
 #include "common/thread.h"
+#include "common/tracing.h"
 #ifdef __APPLE__
 #include <mach/mach.h>
 #elif defined(__HAIKU__)
@@ -81,6 +82,9 @@ void SetCurrentThreadPriority(ThreadPriority new_priority) {
 
 // Sets the debugger-visible name of the current thread.
 void SetCurrentThreadName(const char* name) {
+#ifdef YUZU_TRACING
+    Tracing::SetThreadName(name);
+#endif
     static auto pf = (decltype(&SetThreadDescription))(void*)GetProcAddress(GetModuleHandle(TEXT("KernelBase.dll")), "SetThreadDescription");
     if (pf)
         pf(GetCurrentThread(), UTF8ToUTF16W(name).data()); // Windows 10+
@@ -90,6 +94,9 @@ void SetCurrentThreadName(const char* name) {
 
 // MinGW with the POSIX threading model does not support pthread_setname_np
 void SetCurrentThreadName(const char* name) {
+#ifdef YUZU_TRACING
+    Tracing::SetThreadName(name);
+#endif
     // See for reference
     // https://gitlab.freedesktop.org/mesa/mesa/-/blame/main/src/util/u_thread.c?ref_type=heads#L75
 #ifdef __APPLE__
@@ -0,0 +1,33 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <thread>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(__x86_64__)
+#include <xmmintrin.h>
+#endif
+
+namespace Common {
+
+/// Hints to the CPU that the calling thread is in a spin-wait loop.
+inline void ThreadPause() noexcept {
+#if defined(_M_AMD64) || defined(__x86_64__)
+    _mm_pause();
+#elif defined(_M_ARM64)
+    __yield();
+#elif defined(__aarch64__)
+    asm volatile("yield");
+#endif
+}
+
+/// Spinning cannot succeed when the thread being waited on has no other core to run on.
+[[nodiscard]] inline bool CanSpinWait() noexcept {
+    static const bool can_spin = std::thread::hardware_concurrency() > 1;
+    return can_spin;
+}
+
+} // namespace Common
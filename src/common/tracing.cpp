@@ -0,0 +1,365 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <array>
+#include <chrono>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "common/fs/file.h"
+#include "common/fs/fs.h"
+#include "common/logging/log.h"
+#include "common/polyfill_thread.h"
+#include "common/tracing.h"
+
+namespace Common::Tracing {
+
+namespace detail {
+std::atomic<bool> enabled{false};
+} // namespace detail
+
+namespace {
+
+/// How often recorded events are moved from the thread buffers to the file.
+constexpr std::chrono::milliseconds FlushInterval{100};
+
+enum class Phase : u8 {
+    Complete,
+    Instant,
+    Counter,
+    FlowBegin,
+    FlowEnd,
+};
+
+struct Record {
+    const char* category;
+    const char* name;
+    const char* arg_name;
+    u64 timestamp;
+    u64 duration;
+    s64 value;
+    Phase phase;
+};
+
+struct ThreadBuffer {
+    explicit ThreadBuffer(u32 tid_, std::string name_) : name{std::move(name_)}, tid{tid_} {}
+
+    std::mutex mutex;
+    std::vector<Record> records;
+    std::string name;
+    const u32 tid;
+    bool exited = false;
+};
+
+std::atomic<s64> session_start{0};
+
+s64 SteadyNow() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+void AppendEscaped(fmt::memory_buffer& out, std::string_view string) {
+    for (const char c : string) {
+        switch (c) {
+        case '"':
+            out.append(std::string_view{"\\\""});
+            break;
+        case '\\':
+            out.append(std::string_view{"\\\\"});
+            break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20) {
+                fmt::format_to(std::back_inserter(out), "\\u{:04x}", static_cast<int>(c));
+            } else {
+                out.push_back(c);
+            }
+            break;
+        }
+    }
+}
+
+/// Chrome traces use microseconds, keep the nanosecond precision as decimals.
+void AppendMicroseconds(fmt::memory_buffer& out, u64 ns) {
+    fmt::format_to(std::back_inserter(out), "{}.{:03}", ns / 1000, ns % 1000);
+}
+
+class Tracer {
+public:
+    static Tracer& Instance() {
+        static Tracer instance;
+        return instance;
+    }
+
+    std::shared_ptr<ThreadBuffer> RegisterThread(std::string name) {
+        std::scoped_lock lock{mutex};
+        auto buffer = std::make_shared<ThreadBuffer>(next_tid++, std::move(name));
+        buffers.push_back(buffer);
+        return buffer;
+    }
+
+    void Start(const std::filesystem::path& path) {
+        std::scoped_lock lock{mutex};
+        if (file) {
+            return;
+        }
+        void(FS::CreateParentDirs(path));
+        file = std::make_unique<FS::IOFile>(path, FS::FileAccessMode::Write, FS::FileType::TextFile);
+        if (!file->IsOpen()) {
+            LOG_ERROR(Common, "Could not open trace file {}", path.string());
+            file.reset();
+            return;
+        }
+        PruneExited();
+        for (const auto& buffer : buffers) {
+            std::scoped_lock buffer_lock{buffer->mutex};
+            buffer->records.clear();
+        }
+        first_event = true;
+        WriteRaw("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n");
+        WriteMetadata("process_name", 0, "eden");
+
+        session_start.store(SteadyNow(), std::memory_order::relaxed);
+        detail::enabled.store(true, std::memory_order::release);
+        flush_thread = std::jthread([this](std::stop_token stop_token) { FlushLoop(stop_token); });
+        LOG_INFO(Common, "Recording trace to {}", path.string());
+    }
+
+    void Stop() {
+        detail::enabled.store(false, std::memory_order::release);
+        {
+            std::scoped_lock lock{mutex};
+            if (!file) {
+                return;
+            }
+        }
+        flush_thread.request_stop();
+        if (flush_thread.joinable()) {
+            flush_thread.join();
+        }
+
+        std::scoped_lock lock{mutex};
+        FlushLocked();
+        for (const auto& buffer : buffers) {
+            std::scoped_lock buffer_lock{buffer->mutex};
+            WriteThreadName(*buffer);
+        }
+        WriteRaw("\n]}\n");
+        file.reset();
+        PruneExited();
+    }
+
+private:
+    void FlushLoop(std::stop_token stop_token) {
+        while (Common::StoppableTimedWait(stop_token, FlushInterval)) {
+            std::scoped_lock lock{mutex};
+            FlushLocked();
+        }
+    }
+
+    void FlushLocked() {
+        std::vector<Record> records;
+        for (auto it = buffers.begin(); it != buffers.end();) {
+            ThreadBuffer& buffer = **it;
+            bool remove = false;
+            {
+                std::scoped_lock buffer_lock{buffer.mutex};
+                records.swap(buffer.records);
+                if (buffer.exited) {
+                    // The thread is gone, its track name will not be written at Stop.
+                    WriteThreadName(buffer);
+                    remove = true;
+                }
+            }
+            for (const Record& record : records) {
+                WriteRecord(buffer.tid, record);
+            }
+            records.clear();
+            it = remove ? buffers.erase(it) : std::next(it);
+        }
+        WriteRaw({});
+    }
+
+    /// Drops the buffers of threads that ended while no trace was being flushed.
+    void PruneExited() {
+        std::erase_if(buffers, [](const std::shared_ptr<ThreadBuffer>& buffer) {
+            std::scoped_lock buffer_lock{buffer->mutex};
+            return buffer->exited;
+        });
+    }
+
+    void BeginEvent() {
+        if (!first_event) {
+            out.append(std::string_view{",\n"});
+        }
+        first_event = false;
+    }
+
+    void WriteRecord(u32 tid, const Record& record) {
+        static constexpr std::array<std::string_view, 5> phases{"X", "i", "C", "s", "f"};
+        BeginEvent();
+        fmt::format_to(std::back_inserter(out), "{{\"ph\":\"{}\",\"cat\":\"",
+                       phases[static_cast<size_t>(record.phase)]);
+        AppendEscaped(out, record.category);
+        out.append(std::string_view{"\",\"name\":\""});
+        AppendEscaped(out, record.name);
+        fmt::format_to(std::back_inserter(out), "\",\"pid\":1,\"tid\":{},\"ts\":", tid);
+        AppendMicroseconds(out, record.timestamp);
+        switch (record.phase) {
+        case Phase::Complete:
+            out.append(std::string_view{",\"dur\":"});
+            AppendMicroseconds(out, record.duration);
+            if (record.arg_name) {
+                out.append(std::string_view{",\"args\":{\""});
+                AppendEscaped(out, record.arg_name);
+                fmt::format_to(std::back_inserter(out), "\":{}}}", record.value);
+            }
+            break;
+        case Phase::Instant:
+            out.append(std::string_view{",\"s\":\"t\""});
+            break;
+        case Phase::Counter:
+            fmt::format_to(std::back_inserter(out), ",\"args\":{{\"value\":{}}}", record.value);
+            break;
+        case Phase::FlowBegin:
+            fmt::format_to(std::back_inserter(out), ",\"id\":{}", record.value);
+            break;
+        case Phase::FlowEnd:
+            fmt::format_to(std::back_inserter(out), ",\"bp\":\"e\",\"id\":{}", record.value);
+            break;
+        }
+        out.push_back('}');
+    }
+
+    void WriteThreadName(const ThreadBuffer& buffer) {
+        if (!buffer.name.empty()) {
+            WriteMetadata("thread_name", buffer.tid, buffer.name);
+        }
+    }
+
+    void WriteMetadata(std::string_view kind, u32 tid, std::string_view name) {
+        BeginEvent();
+        fmt::format_to(std::back_inserter(out),
+                       "{{\"ph\":\"M\",\"name\":\"{}\",\"pid\":1,\"tid\":{},\"args\":{{\"name\":\"",
+                       kind, tid);
+        AppendEscaped(out, name);
+        out.append(std::string_view{"\"}}"});
+    }
+
+    void WriteRaw(std::string_view string) {
+        out.append(string);
+        if (file) {
+            void(file->WriteString(std::span<const char>{out.data(), out.size()}));
+        }
+        out.clear();
+    }
+
+    std::mutex mutex;
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+    u32 next_tid = 1;
+    std::unique_ptr<FS::IOFile> file;
+    fmt::memory_buffer out;
+    bool first_event = true;
+    std::jthread flush_thread;
+};
+
+/// Owns the calling thread's buffer and marks it as exited once the thread ends. The buffer is only
+/// created by the first recorded event, so named threads that never trace do not register one.
+struct ThreadHandle {
+    ~ThreadHandle() {
+        if (buffer) {
+            std::scoped_lock lock{buffer->mutex};
+            buffer->exited = true;
+        }
+    }
+
+    std::shared_ptr<ThreadBuffer> buffer;
+    std::string name;
+};
+
+ThreadHandle& GetThreadHandle() {
+    thread_local ThreadHandle handle;
+    return handle;
+}
+
+ThreadBuffer& GetThreadBuffer() {
+    ThreadHandle& handle = GetThreadHandle();
+    if (!handle.buffer) [[unlikely]] {
+        handle.buffer = Tracer::Instance().RegisterThread(handle.name);
+    }
+    return *handle.buffer;
+}
+
+void Push(const Record& record) {
+    ThreadBuffer& buffer = GetThreadBuffer();
+    std::scoped_lock lock{buffer.mutex};
+    buffer.records.push_back(record);
+}
+
+} // Anonymous namespace
+
+namespace detail {
+
+u64 Now() {
+    return static_cast<u64>(SteadyNow() - session_start.load(std::memory_order::relaxed));
+}
+
+void RecordComplete(const char* category, const char* name, u64 start, u64 end,
+                    const char* arg_name, s64 arg) {
+    Push({category, name, arg_name, start, end - start, arg, Phase::Complete});
+}
+
+} // namespace detail
+
+void Start(const std::filesystem::path& path) {
+    Tracer::Instance().Start(path);
+}
+
+void Stop() {
+    Tracer::Instance().Stop();
+}
+
+void SetThreadName(std::string_view name) {
+    ThreadHandle& handle = GetThreadHandle();
+    handle.name = name;
+    if (handle.buffer) {
+        std::scoped_lock lock{handle.buffer->mutex};
+        handle.buffer->name = name;
+    }
+}
+
+const char* InternString(std::string_view string) {
+    static std::mutex mutex;
+    static std::set<std::string, std::less<>> strings;
+    std::scoped_lock lock{mutex};
+    auto it = strings.find(string);
+    if (it == strings.end()) {
+        it = strings.emplace(string).first;
+    }
+    return it->c_str();
+}
+
+void Instant(const char* category, const char* name) {
+    Push({category, name, nullptr, detail::Now(), 0, 0, Phase::Instant});
+}
+
+void Counter(const char* category, const char* name, s64 value) {
+    Push({category, name, nullptr, detail::Now(), 0, value, Phase::Counter});
+}
+
+void FlowBegin(const char* category, const char* name, u64 id) {
+    Push({category, name, nullptr, detail::Now(), 0, static_cast<s64>(id), Phase::FlowBegin});
+}
+
+void FlowEnd(const char* category, const char* name, u64 id) {
+    Push({category, name, nullptr, detail::Now(), 0, static_cast<s64>(id), Phase::FlowEnd});
+}
+
+} // namespace Common::Tracing
@@ -0,0 +1,137 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <atomic>
+#include <filesystem>
+#include <string_view>
+
+#include "common/common_funcs.h"
+#include "common/common_types.h"
+
+/**
+ * Timeline tracing of host threads, written in the Chrome JSON trace event format which both
+ * chrome://tracing and ui.perfetto.dev open.
+ *
+ * Instrumentation goes through the TRACE_* macros, which compile to nothing unless the build has
+ * YUZU_TRACING defined. When compiled in, recording is switched at runtime with Start and Stop and
+ * costs a single relaxed load while stopped.
+ *
+ * Category and name strings are stored by pointer and must outlive the trace session, use string
+ * literals or InternString.
+ */
+namespace Common::Tracing {
+
+namespace detail {
+
+extern std::atomic<bool> enabled;
+
+/// Nanoseconds since the start of the session.
+[[nodiscard]] u64 Now();
+
+void RecordComplete(const char* category, const char* name, u64 start, u64 end,
+                    const char* arg_name, s64 arg);
+
+} // namespace detail
+
+/// Starts recording, the trace is streamed to the given file until Stop is called.
+void Start(const std::filesystem::path& path);
+
+/// Stops recording and finishes the trace file.
+void Stop();
+
+[[nodiscard]] inline bool IsEnabled() {
+    return detail::enabled.load(std::memory_order::relaxed);
+}
+
+/// Names the trace track of the calling thread, called from Common::SetCurrentThreadName.
+void SetThreadName(std::string_view name);
+
+/// Returns a copy of the string that lives until the process exits.
+[[nodiscard]] const char* InternString(std::string_view string);
+
+void Instant(const char* category, const char* name);
+void Counter(const char* category, const char* name, s64 value);
+
+/// Flow events draw an arrow from the zone enclosing FlowBegin to the one enclosing FlowEnd.
+void FlowBegin(const char* category, const char* name, u64 id);
+void FlowEnd(const char* category, const char* name, u64 id);
+
+/// Records the time between its construction and destruction as a slice on the thread's track.
+class ScopedZone {
+public:
+    explicit ScopedZone(const char* category_, const char* name_, const char* arg_name_ = nullptr,
+                        s64 arg_ = 0)
+        : category{category_}, name{name_}, arg_name{arg_name_}, arg{arg_} {
+        if (IsEnabled()) [[unlikely]] {
+            start = detail::Now();
+        }
+    }
+
+    ~ScopedZone() {
+        if (start != NotStarted) [[unlikely]] {
+            detail::RecordComplete(category, name, start, detail::Now(), arg_name, arg);
+        }
+    }
+
+    ScopedZone(const ScopedZone&) = delete;
+    ScopedZone& operator=(const ScopedZone&) = delete;
+
+private:
+    static constexpr u64 NotStarted = ~u64{0};
+
+    const char* category;
+    const char* name;
+    const char* arg_name;
+    s64 arg;
+    u64 start = NotStarted;
+};
+
+} // namespace Common::Tracing
+
+#ifdef YUZU_TRACING
+
+#define TRACE_ZONE(category, name)                                                                 \
+    const ::Common::Tracing::ScopedZone CONCAT2(trace_zone_, __LINE__) {                           \
+        category, name                                                                             \
+    }
+#define TRACE_ZONE_ARG(category, name, arg_name, arg)                                              \
+    const ::Common::Tracing::ScopedZone CONCAT2(trace_zone_, __LINE__) {                           \
+        category, name, arg_name, static_cast<s64>(arg)                                            \
+    }
+#define TRACE_INSTANT(category, name)                                                              \
+    do {                                                                                           \
+        if (::Common::Tracing::IsEnabled()) {                                                      \
+            ::Common::Tracing::Instant(category, name);                                            \
+        }                                                                                          \
+    } while (false)
+#define TRACE_COUNTER(category, name, value)                                                       \
+    do {                                                                                           \
+        if (::Common::Tracing::IsEnabled()) {                                                      \
+            ::Common::Tracing::Counter(category, name, static_cast<s64>(value));                   \
+        }                                                                                          \
+    } while (false)
+#define TRACE_FLOW_BEGIN(category, name, id)                                                       \
+    do {                                                                                           \
+        if (::Common::Tracing::IsEnabled()) {                                                      \
+            ::Common::Tracing::FlowBegin(category, name, id);                                      \
+        }                                                                                          \
+    } while (false)
+#define TRACE_FLOW_END(category, name, id)                                                         \
+    do {                                                                                           \
+        if (::Common::Tracing::IsEnabled()) {                                                      \
+            ::Common::Tracing::FlowEnd(category, name, id);                                        \
+        }                                                                                          \
+    } while (false)
+
+#else
+
+#define TRACE_ZONE(category, name) static_cast<void>(0)
+#define TRACE_ZONE_ARG(category, name, arg_name, arg) static_cast<void>(0)
+#define TRACE_INSTANT(category, name) static_cast<void>(0)
+#define TRACE_COUNTER(category, name, value) static_cast<void>(0)
+#define TRACE_FLOW_BEGIN(category, name, id) static_cast<void>(0)
+#define TRACE_FLOW_END(category, name, id) static_cast<void>(0)
+
+#endif
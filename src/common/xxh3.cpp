@@ -0,0 +1,517 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+// XXH3 64-bit hash, by Yann Collet (https://github.com/Cyan4973/xxHash), BSD-2-Clause.
+
+#include <bit>
+#include <cstring>
+
+#if defined(ARCHITECTURE_x86_64)
+#include <immintrin.h>
+#include "common/x64/cpu_detect.h"
+#elif defined(ARCHITECTURE_arm64)
+#include <arm_neon.h>
+#endif
+
+#include "common/uint128.h"
+#include "common/xxh3.h"
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#define XXH3_TARGET_AVX2
+#else
+#define XXH3_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+
+namespace Common {
+
+namespace {
+
+constexpr u64 PRIME32_1 = 0x9E3779B1U;
+constexpr u64 PRIME32_2 = 0x85EBCA77U;
+constexpr u64 PRIME32_3 = 0xC2B2AE3DU;
+constexpr u64 PRIME64_1 = 0x9E3779B185EBCA87ULL;
+constexpr u64 PRIME64_2 = 0xC2B2AE3D27D4EB4FULL;
+constexpr u64 PRIME64_3 = 0x165667B19E3779F9ULL;
+constexpr u64 PRIME64_4 = 0x85EBCA77C2B2AE63ULL;
+constexpr u64 PRIME64_5 = 0x27D4EB2F165667C5ULL;
+constexpr u64 PRIME_MX1 = 0x165667919E3779F9ULL;
+constexpr u64 PRIME_MX2 = 0x9FB21C651E98DF25ULL;
+
+constexpr size_t STRIPE_LEN = 64;
+constexpr size_t SECRET_CONSUME_RATE = 8;
+constexpr size_t SECRET_SIZE = XXH3Hasher::SecretSize;
+constexpr size_t SECRET_SIZE_MIN = 136;
+constexpr size_t SECRET_LASTACC_START = 7;
+constexpr size_t SECRET_MERGEACCS_START = 11;
+constexpr size_t MIDSIZE_MAX = 240;
+constexpr size_t MIDSIZE_STARTOFFSET = 3;
+constexpr size_t MIDSIZE_LASTOFFSET = 17;
+constexpr size_t STRIPES_PER_BLOCK = (SECRET_SIZE - STRIPE_LEN) / SECRET_CONSUME_RATE;
+
+alignas(64) constexpr std::array<u8, SECRET_SIZE> DefaultSecret{
+    0xb8, 0xfe, 0x6c, 0x39, 0x23, 0xa4, 0x4b, 0xbe, 0x7c, 0x01, 0x81, 0x2c, 0xf7, 0x21, 0xad, 0x1c,
+    0xde, 0xd4, 0x6d, 0xe9, 0x83, 0x90, 0x97, 0xdb, 0x72, 0x40, 0xa4, 0xa4, 0xb7, 0xb3, 0x67, 0x1f,
+    0xcb, 0x79, 0xe6, 0x4e, 0xcc, 0xc0, 0xe5, 0x78, 0x82, 0x5a, 0xd0, 0x7d, 0xcc, 0xff, 0x72, 0x21,
+    0xb8, 0x08, 0x46, 0x74, 0xf7, 0x43, 0x24, 0x8e, 0xe0, 0x35, 0x90, 0xe6, 0x81, 0x3a, 0x26, 0x4c,
+    0x3c, 0x28, 0x52, 0xbb, 0x91, 0xc3, 0x00, 0xcb, 0x88, 0xd0, 0x65, 0x8b, 0x1b, 0x53, 0x2e, 0xa3,
+    0x71, 0x64, 0x48, 0x97, 0xa2, 0x0d, 0xf9, 0x4e, 0x38, 0x19, 0xef, 0x46, 0xa9, 0xde, 0xac, 0xd8,
+    0xa8, 0xfa, 0x76, 0x3f, 0xe3, 0x9c, 0x34, 0x3f, 0xf9, 0xdc, 0xbb, 0xc7, 0xc7, 0x0b, 0x4f, 0x1d,
+    0x8a, 0x51, 0xe0, 0x4b, 0xcd, 0xb4, 0x59, 0x31, 0xc8, 0x9f, 0x7e, 0xc9, 0xd9, 0x78, 0x73, 0x64,
+    0xea, 0xc5, 0xac, 0x83, 0x34, 0xd3, 0xeb, 0xc3, 0xc5, 0x81, 0xa0, 0xff, 0xfa, 0x13, 0x63, 0xeb,
+    0x17, 0x0d, 0xdd, 0x51, 0xb7, 0xf0, 0xda, 0x49, 0xd3, 0x16, 0x55, 0x26, 0x29, 0xd4, 0x68, 0x9e,
+    0x2b, 0x16, 0xbe, 0x58, 0x7d, 0x47, 0xa1, 0xfc, 0x8f, 0xf8, 0xb8, 0xd1, 0x7a, 0xd0, 0x31, 0xce,
+    0x45, 0xcb, 0x3a, 0x8f, 0x95, 0x16, 0x04, 0x28, 0xaf, 0xd7, 0xfb, 0xca, 0xbb, 0x4b, 0x40, 0x7e,
+};
+
+constexpr std::array<u64, 8> InitialAcc{
+    PRIME32_3, PRIME64_1, PRIME64_2, PRIME64_3, PRIME64_4, PRIME32_2, PRIME64_5, PRIME32_1,
+};
+
+inline u32 Read32(const u8* p) {
+    u32 value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+inline u64 Read64(const u8* p) {
+    u64 value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+inline void Write64(u8* p, u64 value) {
+    std::memcpy(p, &value, sizeof(value));
+}
+
+inline u32 Swap32(u32 x) {
+    return ((x << 24) & 0xff000000U) | ((x << 8) & 0x00ff0000U) | ((x >> 8) & 0x0000ff00U) |
+           ((x >> 24) & 0x000000ffU);
+}
+
+inline u64 Swap64(u64 x) {
+    return (static_cast<u64>(Swap32(static_cast<u32>(x))) << 32) |
+           Swap32(static_cast<u32>(x >> 32));
+}
+
+inline u64 Mul128Fold64(u64 lhs, u64 rhs) {
+    const u128 product = Multiply64Into128(lhs, rhs);
+    return product[0] ^ product[1];
+}
+
+inline u64 XXH64Avalanche(u64 h) {
+    h ^= h >> 33;
+    h *= PRIME64_2;
+    h ^= h >> 29;
+    h *= PRIME64_3;
+    h ^= h >> 32;
+    return h;
+}
+
+inline u64 Avalanche(u64 h) {
+    h ^= h >> 37;
+    h *= PRIME_MX1;
+    h ^= h >> 32;
+    return h;
+}
+
+inline u64 RRMXMX(u64 h, u64 len) {
+    h ^= std::rotl(h, 49) ^ std::rotl(h, 24);
+    h *= PRIME_MX2;
+    h ^= (h >> 35) + len;
+    h *= PRIME_MX2;
+    return h ^ (h >> 28);
+}
+
+inline u64 Mix16B(const u8* input, const u8* secret, u64 seed) {
+    const u64 input_lo = Read64(input);
+    const u64 input_hi = Read64(input + 8);
+    return Mul128Fold64(input_lo ^ (Read64(secret) + seed), input_hi ^ (Read64(secret + 8) - seed));
+}
+
+u64 Len1To3(const u8* input, size_t len, const u8* secret, u64 seed) {
+    const u8 c1 = input[0];
+    const u8 c2 = input[len >> 1];
+    const u8 c3 = input[len - 1];
+    const u32 combined = (static_cast<u32>(c1) << 16) | (static_cast<u32>(c2) << 24) |
+                         (static_cast<u32>(c3) << 0) | (static_cast<u32>(len) << 8);
+    const u64 bitflip = (Read32(secret) ^ Read32(secret + 4)) + seed;
+    return XXH64Avalanche(static_cast<u64>(combined) ^ bitflip);
+}
+
+u64 Len4To8(const u8* input, size_t len, const u8* secret, u64 seed) {
+    seed ^= static_cast<u64>(Swap32(static_cast<u32>(seed))) << 32;
+    const u32 input1 = Read32(input);
+    const u32 input2 = Read32(input + len - 4);
+    const u64 bitflip = (Read64(secret + 8) ^ Read64(secret + 16)) - seed;
+    const u64 input64 = input2 + (static_cast<u64>(input1) << 32);
+    return RRMXMX(input64 ^ bitflip, len);
+}
+
+u64 Len9To16(const u8* input, size_t len, const u8* secret, u64 seed) {
+    const u64 bitflip1 = (Read64(secret + 24) ^ Read64(secret + 32)) + seed;
+    const u64 bitflip2 = (Read64(secret + 40) ^ Read64(secret + 48)) - seed;
+    const u64 input_lo = Read64(input) ^ bitflip1;
+    const u64 input_hi = Read64(input + len - 8) ^ bitflip2;
+    const u64 acc = len + Swap64(input_lo) + input_hi + Mul128Fold64(input_lo, input_hi);
+    return Avalanche(acc);
+}
+
+u64 Len0To16(const u8* input, size_t len, const u8* secret, u64 seed) {
+    if (len > 8) {
+        return Len9To16(input, len, secret, seed);
+    }
+    if (len >= 4) {
+        return Len4To8(input, len, secret, seed);
+    }
+    if (len > 0) {
+        return Len1To3(input, len, secret, seed);
+    }
+    return XXH64Avalanche(seed ^ (Read64(secret + 56) ^ Read64(secret + 64)));
+}
+
+u64 Len17To128(const u8* input, size_t len, const u8* secret, u64 seed) {
+    u64 acc = len * PRIME64_1;
+    if (len > 32) {
+        if (len > 64) {
+            if (len > 96) {
+                acc += Mix16B(input + 48, secret + 96, seed);
+                acc += Mix16B(input + len - 64, secret + 112, seed);
+            }
+            acc += Mix16B(input + 32, secret + 64, seed);
+            acc += Mix16B(input + len - 48, secret + 80, seed);
+        }
+        acc += Mix16B(input + 16, secret + 32, seed);
+        acc += Mix16B(input + len - 32, secret + 48, seed);
+    }
+    acc += Mix16B(input + 0, secret + 0, seed);
+    acc += Mix16B(input + len - 16, secret + 16, seed);
+    return Avalanche(acc);
+}
+
+u64 Len129To240(const u8* input, size_t len, const u8* secret, u64 seed) {
+    u64 acc = len * PRIME64_1;
+    const size_t num_rounds = len / 16;
+    for (size_t i = 0; i < 8; ++i) {
+        acc += Mix16B(input + 16 * i, secret + 16 * i, seed);
+    }
+    acc = Avalanche(acc);
+    for (size_t i = 8; i < num_rounds; ++i) {
+        acc += Mix16B(input + 16 * i, secret + 16 * (i - 8) + MIDSIZE_STARTOFFSET, seed);
+    }
+    acc += Mix16B(input + len - 16, secret + SECRET_SIZE_MIN - MIDSIZE_LASTOFFSET, seed);
+    return Avalanche(acc);
+}
+
+u64 HashShort(const u8* input, size_t len, const u8* secret, u64 seed) {
+    if (len <= 16) {
+        return Len0To16(input, len, secret, seed);
+    }
+    if (len <= 128) {
+        return Len17To128(input, len, secret, seed);
+    }
+    return Len129To240(input, len, secret, seed);
+}
+
+// Stripe kernels. Accumulate folds `num_stripes` consecutive 64 byte stripes into the
+// accumulators, advancing through the secret by 8 bytes per stripe. Scramble mixes the
+// accumulators at the end of every block.
+
+using AccumulateFn = void (*)(u64* acc, const u8* input, const u8* secret, size_t num_stripes);
+using ScrambleFn = void (*)(u64* acc, const u8* secret);
+
+void AccumulateScalar(u64* acc, const u8* input, const u8* secret, size_t num_stripes) {
+    for (size_t n = 0; n < num_stripes; ++n) {
+        const u8* const stripe = input + n * STRIPE_LEN;
+        const u8* const key = secret + n * SECRET_CONSUME_RATE;
+        for (size_t i = 0; i < 8; ++i) {
+            const u64 data_val = Read64(stripe + 8 * i);
+            const u64 data_key = data_val ^ Read64(key + 8 * i);
+            acc[i ^ 1] += data_val;
+            acc[i] += static_cast<u32>(data_key) * (data_key >> 32);
+        }
+    }
+}
+
+void ScrambleScalar(u64* acc, const u8* secret) {
+    for (size_t i = 0; i < 8; ++i) {
+        u64 acc64 = acc[i];
+        acc64 ^= acc64 >> 47;
+        acc64 ^= Read64(secret + 8 * i);
+        acc64 *= PRIME32_1;
+        acc[i] = acc64;
+    }
+}
+
+#if defined(ARCHITECTURE_x86_64)
+
+void AccumulateSSE2(u64* acc, const u8* input, const u8* secret, size_t num_stripes) {
+    __m128i* const xacc = reinterpret_cast<__m128i*>(acc);
+    for (size_t n = 0; n < num_stripes; ++n) {
+        const u8* const stripe = input + n * STRIPE_LEN;
+        const u8* const key = secret + n * SECRET_CONSUME_RATE;
+        for (size_t i = 0; i < 4; ++i) {
+            const __m128i data_vec =
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(stripe) + i);
+            const __m128i key_vec = _mm_loadu_si128(reinterpret_cast<const __m128i*>(key) + i);
+            const __m128i data_key = _mm_xor_si128(data_vec, key_vec);
+            const __m128i data_key_lo = _mm_shuffle_epi32(data_key, _MM_SHUFFLE(0, 3, 0, 1));
+            const __m128i product = _mm_mul_epu32(data_key, data_key_lo);
+            const __m128i data_swap = _mm_shuffle_epi32(data_vec, _MM_SHUFFLE(1, 0, 3, 2));
+            const __m128i sum = _mm_add_epi64(_mm_load_si128(xacc + i), data_swap);
+            _mm_store_si128(xacc + i, _mm_add_epi64(product, sum));
+        }
+    }
+}
+
+void ScrambleSSE2(u64* acc, const u8* secret) {
+    __m128i* const xacc = reinterpret_cast<__m128i*>(acc);
+    const __m128i prime32 = _mm_set1_epi32(static_cast<int>(PRIME32_1));
+    for (size_t i = 0; i < 4; ++i) {
+        const __m128i acc_vec = _mm_load_si128(xacc + i);
+        const __m128i data_vec = _mm_xor_si128(acc_vec, _mm_srli_epi64(acc_vec, 47));
+        const __m128i key_vec = _mm_loadu_si128(reinterpret_cast<const __m128i*>(secret) + i);
+        const __m128i data_key = _mm_xor_si128(data_vec, key_vec);
+        const __m128i data_key_hi = _mm_shuffle_epi32(data_key, _MM_SHUFFLE(0, 3, 0, 1));
+        const __m128i prod_lo = _mm_mul_epu32(data_key, prime32);
+        const __m128i prod_hi = _mm_mul_epu32(data_key_hi, prime32);
+        _mm_store_si128(xacc + i, _mm_add_epi64(prod_lo, _mm_slli_epi64(prod_hi, 32)));
+    }
+}
+
+XXH3_TARGET_AVX2 void AccumulateAVX2(u64* acc, const u8* input, const u8* secret,
+                                     size_t num_stripes) {
+    __m256i* const xacc = reinterpret_cast<__m256i*>(acc);
+    for (size_t n = 0; n < num_stripes; ++n) {
+        const u8* const stripe = input + n * STRIPE_LEN;
+        const u8* const key = secret + n * SECRET_CONSUME_RATE;
+        for (size_t i = 0; i < 2; ++i) {
+            const __m256i data_vec =
+                _mm256_loadu_si256(reinterpret_cast<const __m256i*>(stripe) + i);
+            const __m256i key_vec = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(key) + i);
+            const __m256i data_key = _mm256_xor_si256(data_vec, key_vec);
+            const __m256i data_key_lo = _mm256_shuffle_epi32(data_key, _MM_SHUFFLE(0, 3, 0, 1));
+            const __m256i product = _mm256_mul_epu32(data_key, data_key_lo);
+            const __m256i data_swap = _mm256_shuffle_epi32(data_vec, _MM_SHUFFLE(1, 0, 3, 2));
+            const __m256i sum = _mm256_add_epi64(_mm256_load_si256(xacc + i), data_swap);
+            _mm256_store_si256(xacc + i, _mm256_add_epi64(product, sum));
+        }
+    }
+}
+
+XXH3_TARGET_AVX2 void ScrambleAVX2(u64* acc, const u8* secret) {
+    __m256i* const xacc = reinterpret_cast<__m256i*>(acc);
+    const __m256i prime32 = _mm256_set1_epi32(static_cast<int>(PRIME32_1));
+    for (size_t i = 0; i < 2; ++i) {
+        const __m256i acc_vec = _mm256_load_si256(xacc + i);
+        const __m256i data_vec = _mm256_xor_si256(acc_vec, _mm256_srli_epi64(acc_vec, 47));
+        const __m256i key_vec = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(secret) + i);
+        const __m256i data_key = _mm256_xor_si256(data_vec, key_vec);
+        const __m256i data_key_hi = _mm256_shuffle_epi32(data_key, _MM_SHUFFLE(0, 3, 0, 1));
+        const __m256i prod_lo = _mm256_mul_epu32(data_key, prime32);
+        const __m256i prod_hi = _mm256_mul_epu32(data_key_hi, prime32);
+        _mm256_store_si256(xacc + i, _mm256_add_epi64(prod_lo, _mm256_slli_epi64(prod_hi, 32)));
+    }
+}
+
+#elif defined(ARCHITECTURE_arm64)
+
+void AccumulateNEON(u64* acc, const u8* input, const u8* secret, size_t num_stripes) {
+    for (size_t n = 0; n < num_stripes; ++n) {
+        const u8* const stripe = input + n * STRIPE_LEN;
+        const u8* const key = secret + n * SECRET_CONSUME_RATE;
+        for (size_t i = 0; i < 4; ++i) {
+            const uint64x2_t data_vec = vreinterpretq_u64_u8(vld1q_u8(stripe + 16 * i));
+            const uint64x2_t key_vec = vreinterpretq_u64_u8(vld1q_u8(key + 16 * i));
+            const uint64x2_t data_key = veorq_u64(data_vec, key_vec);
+            const uint32x2_t data_key_lo = vmovn_u64(data_key);
+            const uint32x2_t data_key_hi = vshrn_n_u64(data_key, 32);
+            const uint64x2_t data_swap = vextq_u64(data_vec, data_vec, 1);
+            uint64x2_t sum = vaddq_u64(vld1q_u64(acc + 2 * i), data_swap);
+            sum = vmlal_u32(sum, data_key_lo, data_key_hi);
+            vst1q_u64(acc + 2 * i, sum);
+        }
+    }
+}
+
+void ScrambleNEON(u64* acc, const u8* secret) {
+    const uint32x2_t prime = vdup_n_u32(static_cast<u32>(PRIME32_1));
+    for (size_t i = 0; i < 4; ++i) {
+        uint64x2_t acc_vec = vld1q_u64(acc + 2 * i);
+        acc_vec = veorq_u64(acc_vec, vshrq_n_u64(acc_vec, 47));
+        acc_vec = veorq_u64(acc_vec, vreinterpretq_u64_u8(vld1q_u8(secret + 16 * i)));
+        const uint32x2_t data_key_lo = vmovn_u64(acc_vec);
+        const uint32x2_t data_key_hi = vshrn_n_u64(acc_vec, 32);
+        const uint64x2_t prod_hi = vshlq_n_u64(vmull_u32(data_key_hi, prime), 32);
+        vst1q_u64(acc + 2 * i, vmlal_u32(prod_hi, data_key_lo, prime));
+    }
+}
+
+#endif
+
+struct Kernel {
+    AccumulateFn accumulate;
+    ScrambleFn scramble;
+    const char* name;
+};
+
+const Kernel& GetKernel() {
+    static const Kernel kernel = [] {
+#if defined(ARCHITECTURE_x86_64)
+        if (GetCPUCaps().avx2) {
+            return Kernel{AccumulateAVX2, ScrambleAVX2, "AVX2"};
+        }
+        return Kernel{AccumulateSSE2, ScrambleSSE2, "SSE2"};
+#elif defined(ARCHITECTURE_arm64)
+        return Kernel{AccumulateNEON, ScrambleNEON, "NEON"};
+#else
+        return Kernel{AccumulateScalar, ScrambleScalar, "Scalar"};
+#endif
+    }();
+    return kernel;
+}
+
+void InitCustomSecret(u8* custom_secret, u64 seed) {
+    for (size_t i = 0; i < SECRET_SIZE / 16; ++i) {
+        Write64(custom_secret + 16 * i, Read64(DefaultSecret.data() + 16 * i) + seed);
+        Write64(custom_secret + 16 * i + 8, Read64(DefaultSecret.data() + 16 * i + 8) - seed);
+    }
+}
+
+u64 MergeAccs(const u64* acc, const u8* secret, u64 start) {
+    u64 result = start;
+    for (size_t i = 0; i < 4; ++i) {
+        result += Mul128Fold64(acc[2 * i] ^ Read64(secret + 16 * i),
+                               acc[2 * i + 1] ^ Read64(secret + 16 * i + 8));
+    }
+    return Avalanche(result);
+}
+
+u64 HashLong(const u8* input, size_t len, const u8* secret) {
+    const Kernel& kernel = GetKernel();
+    alignas(64) std::array<u64, 8> acc = InitialAcc;
+    constexpr size_t block_len = STRIPE_LEN * STRIPES_PER_BLOCK;
+    const size_t num_blocks = (len - 1) / block_len;
+    for (size_t n = 0; n < num_blocks; ++n) {
+        kernel.accumulate(acc.data(), input + n * block_len, secret, STRIPES_PER_BLOCK);
+        kernel.scramble(acc.data(), secret + SECRET_SIZE - STRIPE_LEN);
+    }
+    const size_t num_stripes = ((len - 1) - (block_len * num_blocks)) / STRIPE_LEN;
+    kernel.accumulate(acc.data(), input + num_blocks * block_len, secret, num_stripes);
+    kernel.accumulate(acc.data(), input + len - STRIPE_LEN,
+                      secret + SECRET_SIZE - STRIPE_LEN - SECRET_LASTACC_START, 1);
+    return MergeAccs(acc.data(), secret + SECRET_MERGEACCS_START, len * PRIME64_1);
+}
+
+} // Anonymous namespace
+
+u64 XXH3Hash64(const void* data, size_t len) {
+    return XXH3Hash64WithSeed(data, len, 0);
+}
+
+u64 XXH3Hash64WithSeed(const void* data, size_t len, u64 seed) {
+    const u8* const input = static_cast<const u8*>(data);
+    if (len <= MIDSIZE_MAX) {
+        return HashShort(input, len, DefaultSecret.data(), seed);
+    }
+    if (seed == 0) {
+        return HashLong(input, len, DefaultSecret.data());
+    }
+    alignas(64) std::array<u8, SECRET_SIZE> custom_secret;
+    InitCustomSecret(custom_secret.data(), seed);
+    return HashLong(input, len, custom_secret.data());
+}
+
+const char* XXH3KernelName() {
+    return GetKernel().name;
+}
+
+XXH3Hasher::XXH3Hasher(u64 seed_) {
+    Reset(seed_);
+}
+
+void XXH3Hasher::Reset(u64 seed_) {
+    seed = seed_;
+    acc = InitialAcc;
+    buffered_size = 0;
+    stripes_in_block = 0;
+    total_len = 0;
+    if (seed == 0) {
+        secret = DefaultSecret;
+    } else {
+        InitCustomSecret(secret.data(), seed);
+    }
+}
+
+void XXH3Hasher::ConsumeStripes(std::array<u64, 8>& acc_, size_t& stripes_in_block_,
+                                const u8* input, size_t num_stripes) const {
+    const Kernel& kernel = GetKernel();
+    while (num_stripes > 0) {
+        const size_t count = (std::min)(num_stripes, STRIPES_PER_BLOCK - stripes_in_block_);
+        kernel.accumulate(acc_.data(), input, secret.data() + stripes_in_block_ * SECRET_CONSUME_RATE,
+                          count);
+        input += count * STRIPE_LEN;
+        num_stripes -= count;
+        stripes_in_block_ += count;
+        if (stripes_in_block_ == STRIPES_PER_BLOCK) {
+            kernel.scramble(acc_.data(), secret.data() + SECRET_SIZE - STRIPE_LEN);
+            stripes_in_block_ = 0;
+        }
+    }
+}
+
+void XXH3Hasher::Update(const void* data, size_t len) {
+    const u8* input = static_cast<const u8*>(data);
+    total_len += len;
+    if (buffered_size + len <= BufferSize) {
+        std::memcpy(buffer.data() + buffered_size, input, len);
+        buffered_size += len;
+        return;
+    }
+    // Always keep the last stripe buffered, Digest needs it.
+    constexpr size_t buffer_stripes = BufferSize / STRIPE_LEN;
+    if (buffered_size > 0) {
+        const size_t fill = BufferSize - buffered_size;
+        std::memcpy(buffer.data() + buffered_size, input, fill);
+        input += fill;
+        len -= fill;
+        ConsumeStripes(acc, stripes_in_block, buffer.data(), buffer_stripes);
+        buffered_size = 0;
+    }
+    if (len > BufferSize) {
+        const size_t num_stripes = (len - 1) / STRIPE_LEN;
+        ConsumeStripes(acc, stripes_in_block, input, num_stripes);
+        input += num_stripes * STRIPE_LEN;
+        len -= num_stripes * STRIPE_LEN;
+        // Keep the bytes preceding the tail around for a possible partial last stripe.
+        std::memcpy(buffer.data() + BufferSize - STRIPE_LEN, input - STRIPE_LEN, STRIPE_LEN);
+    }
+    std::memcpy(buffer.data(), input, len);
+    buffered_size = len;
+}
+
+u64 XXH3Hasher::Digest() const {
+    if (total_len <= MIDSIZE_MAX) {
+        return HashShort(buffer.data(), buffered_size, DefaultSecret.data(), seed);
+    }
+    const Kernel& kernel = GetKernel();
+    alignas(64) std::array<u64, 8> final_acc = acc;
+    size_t final_stripes_in_block = stripes_in_block;
+    if (buffered_size >= STRIPE_LEN) {
+        const size_t num_stripes = (buffered_size - 1) / STRIPE_LEN;
+        ConsumeStripes(final_acc, final_stripes_in_block, buffer.data(), num_stripes);
+        kernel.accumulate(final_acc.data(), buffer.data() + buffered_size - STRIPE_LEN,
+                          secret.data() + SECRET_SIZE - STRIPE_LEN - SECRET_LASTACC_START, 1);
+    } else {
+        // The last stripe straddles the previously consumed data and the buffered tail.
+        std::array<u8, STRIPE_LEN> last_stripe;
+        const size_t catchup = STRIPE_LEN - buffered_size;
+        std::memcpy(last_stripe.data(), buffer.data() + BufferSize - catchup, catchup);
+        std::memcpy(last_stripe.data() + catchup, buffer.data(), buffered_size);
+        kernel.accumulate(final_acc.data(), last_stripe.data(),
+                          secret.data() + SECRET_SIZE - STRIPE_LEN - SECRET_LASTACC_START, 1);
+    }
+    return MergeAccs(final_acc.data(), secret.data() + SECRET_MERGEACCS_START,
+                     total_len * PRIME64_1);
+}
+
+} // namespace Common
@@ -0,0 +1,72 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+// XXH3 64-bit hash, by Yann Collet (https://github.com/Cyan4973/xxHash), BSD-2-Clause.
+//
+// The implementation produces the same values as the reference XXH3_64bits family. Inputs of
+// more than 240 bytes go through vectorized stripe accumulation that is picked at runtime:
+// AVX2 or SSE2 on x86_64 hosts and NEON on arm64 hosts, with a portable scalar fallback.
+//
+// Like CityHash, XXH3 is not suitable for cryptography.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <span>
+
+#include "common/common_types.h"
+
+namespace Common {
+
+// Hash function for a byte array.
+[[nodiscard]] u64 XXH3Hash64(const void* data, size_t len);
+
+// Hash function for a byte array.  For convenience, a 64-bit seed is also
+// hashed into the result.
+[[nodiscard]] u64 XXH3Hash64WithSeed(const void* data, size_t len, u64 seed);
+
+template <typename T>
+[[nodiscard]] u64 XXH3Hash64(std::span<T> data) {
+    return XXH3Hash64(data.data(), data.size_bytes());
+}
+
+/// Name of the stripe accumulation kernel selected for this host, for logging purposes.
+[[nodiscard]] const char* XXH3KernelName();
+
+/// Incremental version of XXH3Hash64WithSeed, for data that is not contiguous in memory.
+class XXH3Hasher {
+public:
+    explicit XXH3Hasher(u64 seed = 0);
+
+    /// Restarts hashing with the given seed.
+    void Reset(u64 seed = 0);
+
+    /// Hashes more input, which behaves as if appended to the previous input.
+    void Update(const void* data, size_t len);
+
+    template <typename T>
+    void Update(std::span<T> data) {
+        Update(data.data(), data.size_bytes());
+    }
+
+    /// Returns the hash of all input so far. Hashing can continue afterwards.
+    [[nodiscard]] u64 Digest() const;
+
+    static constexpr size_t SecretSize = 192;
+    static constexpr size_t BufferSize = 256;
+
+private:
+    void ConsumeStripes(std::array<u64, 8>& acc, size_t& stripes_in_block, const u8* input,
+                        size_t num_stripes) const;
+
+    alignas(64) std::array<u64, 8> acc{};
+    alignas(64) std::array<u8, SecretSize> secret{};
+    alignas(64) std::array<u8, BufferSize> buffer{};
+    size_t buffered_size{};
+    size_t stripes_in_block{};
+    u64 total_len{};
+    u64 seed{};
+};
+
+} // namespace Common
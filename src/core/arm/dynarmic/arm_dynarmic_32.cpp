@@ -4,6 +4,8 @@
 // SPDX-FileCopyrightText: Copyright 2020 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <chrono>
+
 #include "common/settings.h"
 #include "core/arm/dynarmic/arm_dynarmic.h"
 #include "core/arm/dynarmic/arm_dynarmic_32.h"
@@ -252,6 +254,9 @@ std::shared_ptr<Dynarmic::A32::Jit> ArmDynarmic32::MakeJit(Common::PageTable* pa
         if (!Settings::values.cpuopt_misc_ir) {
             config.optimizations &= ~Dynarmic::OptimizationFlag::MiscIROpt;
         }
+        if (Settings::values.cpuopt_live_interval_regalloc) {
+            config.optimizations |= Dynarmic::OptimizationFlag::LiveIntervalRegAlloc;
+        }
         if (!Settings::values.cpuopt_reduce_misalign_checks) {
             config.only_detect_misalignment_via_page_table_on_page_boundary = false;
         }
@@ -392,7 +397,16 @@ ArmDynarmic32::ArmDynarmic32(System& system, bool uses_wall_clock, Kernel::KProc
     m_jit = MakeJit(&page_table_impl);
 }
 
-ArmDynarmic32::~ArmDynarmic32() = default;
+ArmDynarmic32::~ArmDynarmic32() {
+    const auto stats = m_jit->GetCodeCacheStatistics();
+    if (stats.region_evictions != 0 || stats.full_clears != 0) {
+        LOG_INFO(Core_ARM,
+                 "Core {} JIT code cache: {} region evictions dropping {} blocks, {} full clears, "
+                 "{} ms spent",
+                 m_core_index, stats.region_evictions, stats.evicted_blocks, stats.full_clears,
+                 std::chrono::duration_cast<std::chrono::milliseconds>(stats.eviction_time).count());
+    }
+}
 
 void ArmDynarmic32::SetTpidrroEl0(u64 value) {
     m_cp15->uro = static_cast<u32>(value);
@@ -4,10 +4,13 @@
 // SPDX-FileCopyrightText: Copyright 2018 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <chrono>
+
 #include "common/settings.h"
 #include "core/arm/dynarmic/arm_dynarmic.h"
 #include "core/arm/dynarmic/arm_dynarmic_64.h"
 #include "core/arm/dynarmic/dynarmic_exclusive_monitor.h"
+#include "core/arm/dynarmic/dynarmic_translation_cache.h"
 #include "core/core_timing.h"
 #include "core/hle/kernel/k_process.h"
 
@@ -50,6 +53,10 @@ public:
         }
         return m_memory.Read32(vaddr);
     }
+    std::optional<u32> MemoryReadCodeSpeculative(u64 vaddr) override {
+        // Called from the JIT's compile thread, which must not touch rasterizer state.
+        return m_memory.ReadPlain32(vaddr);
+    }
 
     void MemoryWrite8(u64 vaddr, u8 value) override {
         if (CheckMemoryAccess(vaddr, 1, Kernel::DebugWatchpointType::Write)) {
@@ -255,6 +262,16 @@ std::shared_ptr<Dynarmic::A64::Jit> ArmDynarmic64::MakeJit(Common::PageTable* pa
     config.processor_id = std::uint8_t(m_core_index);
     config.global_monitor = &m_exclusive_monitor.monitor;
 
+    // Persistent translation cache
+    if (page_table) {
+        config.translation_cache = m_translation_cache;
+    }
+
+    // Background translation of upcoming blocks
+    if (page_table) {
+        config.speculative_compilation = Settings::values.use_speculative_jit_compilation.GetValue();
+    }
+
     // System registers
     config.tpidrro_el0 = &m_cb->m_tpidrro_el0;
     config.tpidr_el0 = &m_cb->m_tpidr_el0;
@@ -311,6 +328,18 @@ std::shared_ptr<Dynarmic::A64::Jit> ArmDynarmic64::MakeJit(Common::PageTable* pa
         if (!Settings::values.cpuopt_misc_ir) {
             config.optimizations &= ~Dynarmic::OptimizationFlag::MiscIROpt;
         }
+        if (Settings::values.cpuopt_trace_formation) {
+            config.optimizations |= Dynarmic::OptimizationFlag::TraceFormation;
+        }
+        if (Settings::values.cpuopt_tiered_compilation) {
+            config.optimizations |= Dynarmic::OptimizationFlag::TieredCompilation;
+        }
+        if (Settings::values.cpuopt_live_interval_regalloc) {
+            config.optimizations |= Dynarmic::OptimizationFlag::LiveIntervalRegAlloc;
+        }
+        if (Settings::values.cpuopt_memory_forwarding) {
+            config.optimizations |= Dynarmic::OptimizationFlag::MemoryForwarding;
+        }
         if (!Settings::values.cpuopt_reduce_misalign_checks) {
             config.only_detect_misalignment_via_page_table_on_page_boundary = false;
         }
@@ -413,15 +442,26 @@ void ArmDynarmic64::RewindBreakpointInstruction() {
 }
 
 ArmDynarmic64::ArmDynarmic64(System& system, bool uses_wall_clock, Kernel::KProcess* process,
-                             DynarmicExclusiveMonitor& exclusive_monitor, std::size_t core_index)
+                             DynarmicExclusiveMonitor& exclusive_monitor, std::size_t core_index,
+                             DynarmicTranslationCache* translation_cache)
     : ArmInterface{uses_wall_clock}, m_system{system}, m_exclusive_monitor{exclusive_monitor},
-      m_cb(std::make_unique<DynarmicCallbacks64>(*this, process)), m_core_index{core_index} {
+      m_cb(std::make_unique<DynarmicCallbacks64>(*this, process)), m_core_index{core_index},
+      m_translation_cache{translation_cache} {
     auto& page_table = process->GetPageTable().GetBasePageTable();
     auto& page_table_impl = page_table.GetImpl();
     m_jit = MakeJit(&page_table_impl, page_table.GetAddressSpaceWidth());
 }
 
-ArmDynarmic64::~ArmDynarmic64() = default;
+ArmDynarmic64::~ArmDynarmic64() {
+    const auto stats = m_jit->GetCodeCacheStatistics();
+    if (stats.region_evictions != 0 || stats.full_clears != 0) {
+        LOG_INFO(Core_ARM,
+                 "Core {} JIT code cache: {} region evictions dropping {} blocks, {} full clears, "
+                 "{} ms spent",
+                 m_core_index, stats.region_evictions, stats.evicted_blocks, stats.full_clears,
+                 std::chrono::duration_cast<std::chrono::milliseconds>(stats.eviction_time).count());
+    }
+}
 
 void ArmDynarmic64::SetTpidrroEl0(u64 value) {
     m_cb->m_tpidrro_el0 = value;
@@ -21,12 +21,14 @@ namespace Core {
 
 class DynarmicCallbacks64;
 class DynarmicExclusiveMonitor;
+class DynarmicTranslationCache;
 class System;
 
 class ArmDynarmic64 final : public ArmInterface {
 public:
     ArmDynarmic64(System& system, bool uses_wall_clock, Kernel::KProcess* process,
-                  DynarmicExclusiveMonitor& exclusive_monitor, std::size_t core_index);
+                  DynarmicExclusiveMonitor& exclusive_monitor, std::size_t core_index,
+                  DynarmicTranslationCache* translation_cache = nullptr);
     ~ArmDynarmic64() override;
 
     Architecture GetArchitecture() const override {
@@ -63,6 +65,7 @@ private:
                                                 std::size_t address_space_bits) const;
     std::unique_ptr<DynarmicCallbacks64> m_cb{};
     std::size_t m_core_index{};
+    DynarmicTranslationCache* m_translation_cache{};
 
     std::shared_ptr<Dynarmic::A64::Jit> m_jit{};
 
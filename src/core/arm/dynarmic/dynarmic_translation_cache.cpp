@@ -0,0 +1,188 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <array>
+#include <cstring>
+
+#include <fmt/format.h>
+
+#include "common/assert.h"
+#include "common/fs/fs.h"
+#include "common/fs/path_util.h"
+#include "common/literals.h"
+#include "common/logging/log.h"
+#include "common/scm_rev.h"
+#include "core/arm/dynarmic/dynarmic_translation_cache.h"
+
+namespace Core {
+
+using namespace Common::Literals;
+
+namespace {
+
+constexpr std::array<char, 8> MAGIC_NUMBER{'e', 'd', 'e', 'n', 'j', 'i', 't', 'c'};
+constexpr u32 CACHE_VERSION = 1;
+
+/// Blocks are a few kilobytes at most; anything bigger is damage.
+constexpr u32 MAX_ENTRY_SIZE = static_cast<u32>(1_MiB);
+
+/// Once the file reaches this size, new blocks are still cached in memory but not saved.
+constexpr u64 MAX_FILE_SIZE = 256_MiB;
+
+struct FileHeader {
+    std::array<char, 8> magic;
+    u32 version;
+    u32 reserved;
+    u64 build_hash;
+};
+static_assert(sizeof(FileHeader) == 24);
+
+struct EntryHeader {
+    u64 location;
+    u32 size;
+    u32 reserved;
+    u64 checksum;
+};
+static_assert(sizeof(EntryHeader) == 24);
+
+u64 BuildHash() {
+    // Serialized IR is only meaningful to the dynarmic build that produced it.
+    return Common::XXH3Hash64(Common::g_scm_rev, std::strlen(Common::g_scm_rev));
+}
+
+} // Anonymous namespace
+
+DynarmicTranslationCache::DynarmicTranslationCache(u64 program_id) : m_program_id{program_id} {}
+
+DynarmicTranslationCache::~DynarmicTranslationCache() {
+    if (m_is_open) {
+        LOG_INFO(Core_ARM, "JIT cache: {} blocks found, {} not found, {} blocks in {}", m_num_hits,
+                 m_num_misses, m_entries.size(), Common::FS::PathToUTF8String(m_path));
+    }
+}
+
+void DynarmicTranslationCache::AddModule(std::span<const u8> code) {
+    std::scoped_lock lk{m_mutex};
+    ASSERT(!m_is_open);
+    m_code_hasher.Update(code);
+}
+
+bool DynarmicTranslationCache::Load(u64 location, std::vector<u8>& data) {
+    std::scoped_lock lk{m_mutex};
+    if (!m_is_open) {
+        Open();
+    }
+    const auto it = m_entries.find(location);
+    if (it == m_entries.end()) {
+        ++m_num_misses;
+        return false;
+    }
+    ++m_num_hits;
+    data = it->second;
+    return true;
+}
+
+void DynarmicTranslationCache::Store(u64 location, const std::vector<u8>& data) {
+    if (data.size() > MAX_ENTRY_SIZE) {
+        return;
+    }
+    std::scoped_lock lk{m_mutex};
+    if (!m_is_open) {
+        Open();
+    }
+    m_entries.insert_or_assign(location, data);
+    AppendEntry(location, data);
+}
+
+void DynarmicTranslationCache::Open() {
+    m_is_open = true;
+
+    const auto base_dir{Common::FS::GetEdenPath(Common::FS::EdenPath::CacheDir) / "jit" /
+                        fmt::format("{:016x}", m_program_id)};
+    if (!Common::FS::CreateDirs(base_dir)) {
+        LOG_ERROR(Common_Filesystem, "Failed to create JIT cache directory");
+        return;
+    }
+    m_path = base_dir / fmt::format("{:016x}.bin", m_code_hasher.Digest());
+
+    if (ReadFile()) {
+        m_file.open(m_path, std::ios::binary | std::ios::app);
+    } else {
+        // Missing, stale or damaged; start over with whatever could be salvaged.
+        RewriteFile();
+    }
+    if (!m_file.is_open()) {
+        LOG_ERROR(Common_Filesystem, "Failed to open JIT cache file {}",
+                  Common::FS::PathToUTF8String(m_path));
+        return;
+    }
+    LOG_INFO(Core_ARM, "Loaded {} cached JIT blocks", m_entries.size());
+}
+
+bool DynarmicTranslationCache::ReadFile() {
+    std::ifstream file(m_path, std::ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    FileHeader header{};
+    file.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if (!file || header.magic != MAGIC_NUMBER || header.version != CACHE_VERSION ||
+        header.build_hash != BuildHash()) {
+        LOG_INFO(Common_Filesystem, "Discarding old JIT cache");
+        return false;
+    }
+    m_file_size = sizeof(header);
+
+    std::vector<u8> data;
+    while (file.peek() != std::ifstream::traits_type::eof()) {
+        EntryHeader entry{};
+        file.read(reinterpret_cast<char*>(&entry), sizeof(entry));
+        if (!file || entry.size > MAX_ENTRY_SIZE) {
+            return false;
+        }
+        data.resize(entry.size);
+        file.read(reinterpret_cast<char*>(data.data()), entry.size);
+        if (!file || Common::XXH3Hash64(data.data(), data.size()) != entry.checksum) {
+            return false;
+        }
+        m_entries.insert_or_assign(entry.location, data);
+        m_file_size += sizeof(entry) + entry.size;
+    }
+    return true;
+}
+
+void DynarmicTranslationCache::RewriteFile() {
+    m_file.open(m_path, std::ios::binary | std::ios::trunc);
+    if (!m_file.is_open()) {
+        return;
+    }
+    const FileHeader header{
+        .magic = MAGIC_NUMBER,
+        .version = CACHE_VERSION,
+        .reserved = 0,
+        .build_hash = BuildHash(),
+    };
+    m_file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    m_file_size = sizeof(header);
+    for (const auto& [location, data] : m_entries) {
+        AppendEntry(location, data);
+    }
+}
+
+void DynarmicTranslationCache::AppendEntry(u64 location, std::span<const u8> data) {
+    if (!m_file.is_open() || m_file_size + sizeof(EntryHeader) + data.size() > MAX_FILE_SIZE) {
+        return;
+    }
+    const EntryHeader entry{
+        .location = location,
+        .size = static_cast<u32>(data.size()),
+        .reserved = 0,
+        .checksum = Common::XXH3Hash64(data.data(), data.size()),
+    };
+    m_file.write(reinterpret_cast<const char*>(&entry), sizeof(entry));
+    m_file.write(reinterpret_cast<const char*>(data.data()), data.size());
+    m_file_size += sizeof(entry) + data.size();
+}
+
+} // namespace Core
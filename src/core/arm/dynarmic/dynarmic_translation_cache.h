@@ -0,0 +1,56 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+#include <dynarmic/interface/A64/config.h>
+#include "common/common_types.h"
+#include "common/xxh3.h"
+
+namespace Core {
+
+/// Persists the translated blocks of one 64-bit process across boots.
+/// The cache file lives at <cache dir>/jit/<program id>/<code hash>.bin, where the code hash
+/// covers the code segments of every module loaded into the process, so title updates and
+/// code mods get a file of their own. The JIT validates each entry against guest memory
+/// before using it, which also covers code that is patched at runtime.
+class DynarmicTranslationCache final : public Dynarmic::A64::TranslationCache {
+public:
+    explicit DynarmicTranslationCache(u64 program_id);
+    ~DynarmicTranslationCache() override;
+
+    /// Adds the code segment of a loaded module to the code hash.
+    /// Must not be called once the process has started running.
+    void AddModule(std::span<const u8> code);
+
+    bool Load(u64 location, std::vector<u8>& data) override;
+    void Store(u64 location, const std::vector<u8>& data) override;
+
+private:
+    /// Reads the cache file and opens it for appending. Called with m_mutex held.
+    void Open();
+
+    bool ReadFile();
+    void RewriteFile();
+    void AppendEntry(u64 location, std::span<const u8> data);
+
+    std::mutex m_mutex;
+    const u64 m_program_id;
+    Common::XXH3Hasher m_code_hasher;
+    bool m_is_open{};
+    std::filesystem::path m_path;
+    std::ofstream m_file;
+    u64 m_file_size{};
+    std::unordered_map<u64, std::vector<u8>> m_entries;
+    size_t m_num_hits{};
+    size_t m_num_misses{};
+};
+
+} // namespace Core
@@ -0,0 +1,255 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <mutex>
+
+#include <fmt/format.h>
+#include <nlohmann/json.hpp>
+
+#include "common/fs/file.h"
+#include "common/fs/fs.h"
+#include "common/fs/path_util.h"
+#include "common/logging/log.h"
+#include "core/call_stats.h"
+#include "core/hle/kernel/svc.h"
+
+namespace Core {
+
+namespace {
+
+void SortByTotalTime(std::vector<CallStats::Entry>& entries) {
+    std::ranges::sort(entries, [](const auto& lhs, const auto& rhs) {
+        return lhs.total_ns > rhs.total_ns;
+    });
+}
+
+nlohmann::json ToJson(const CallStats::Entry& entry) {
+    nlohmann::json out{
+        {"name", entry.name},
+        {"id", entry.id},
+        {"count", entry.count},
+        {"total_ns", entry.total_ns},
+        {"mean_ns", entry.count != 0 ? entry.total_ns / entry.count : 0},
+        {"p50_ns", CallStats::Percentile(entry, 0.50)},
+        {"p99_ns", CallStats::Percentile(entry, 0.99)},
+        {"max_ns", entry.max_ns},
+        {"histogram", entry.histogram},
+    };
+    if (!entry.service.empty()) {
+        out["service"] = entry.service;
+    }
+    return out;
+}
+
+} // Anonymous namespace
+
+void CallStats::Histogram::Record(u64 ns) {
+    count.fetch_add(1, std::memory_order::relaxed);
+    total_ns.fetch_add(ns, std::memory_order::relaxed);
+    const size_t bucket = std::min<size_t>(std::bit_width(ns), NumBuckets - 1);
+    buckets[bucket].fetch_add(1, std::memory_order::relaxed);
+
+    u64 max = max_ns.load(std::memory_order::relaxed);
+    while (ns > max && !max_ns.compare_exchange_weak(max, ns, std::memory_order::relaxed)) {
+    }
+}
+
+void CallStats::Histogram::Reset() {
+    count.store(0, std::memory_order::relaxed);
+    total_ns.store(0, std::memory_order::relaxed);
+    max_ns.store(0, std::memory_order::relaxed);
+    for (auto& bucket : buckets) {
+        bucket.store(0, std::memory_order::relaxed);
+    }
+}
+
+CallStats::Entry CallStats::Histogram::Snapshot(std::string service, std::string name,
+                                                u32 id) const {
+    Entry entry{
+        .service = std::move(service),
+        .name = std::move(name),
+        .id = id,
+        .count = count.load(std::memory_order::relaxed),
+        .total_ns = total_ns.load(std::memory_order::relaxed),
+        .max_ns = max_ns.load(std::memory_order::relaxed),
+        .histogram = {},
+    };
+    for (size_t i = 0; i < NumBuckets; i++) {
+        entry.histogram[i] = buckets[i].load(std::memory_order::relaxed);
+    }
+    return entry;
+}
+
+CallStats::CallStats() = default;
+
+CallStats::~CallStats() = default;
+
+void CallStats::SetEnabled(bool enabled_) {
+    enabled.store(enabled_, std::memory_order::relaxed);
+}
+
+u64 CallStats::Now() {
+    // Offset so that a start time is never zero, which Begin returns while disabled.
+    return static_cast<u64>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                std::chrono::steady_clock::now().time_since_epoch())
+                                .count()) |
+           1;
+}
+
+void CallStats::EndSvc(u32 imm, u64 start) {
+    if (start == 0) {
+        return;
+    }
+    svcs[imm % svcs.size()].Record(Now() - start);
+}
+
+void CallStats::EndServiceCommand(std::string_view service, u32 command, const char* name,
+                                  u64 start) {
+    if (start == 0) {
+        return;
+    }
+    const u64 ns = Now() - start;
+
+    {
+        std::shared_lock lk{commands_mutex};
+        if (const auto it = commands.find(service); it != commands.end()) {
+            if (const auto command_it = it->second.find(command); command_it != it->second.end()) {
+                command_it->second.histogram.Record(ns);
+                return;
+            }
+        }
+    }
+
+    // First call of this command, add it.
+    std::unique_lock lk{commands_mutex};
+    auto it = commands.find(service);
+    if (it == commands.end()) {
+        it = commands.emplace(std::string(service), std::map<u32, CommandHistogram>{}).first;
+    }
+    auto& entry = it->second.try_emplace(command).first->second;
+    entry.name = name;
+    entry.histogram.Record(ns);
+}
+
+u64 CallStats::EndSchedulerLockWait(u64 start) {
+    if (start == 0) {
+        return 0;
+    }
+    const u64 now = Now();
+    scheduler_lock_wait.Record(now - start);
+    return now;
+}
+
+void CallStats::EndSchedulerLockHold(u64 start) {
+    if (start == 0) {
+        return;
+    }
+    scheduler_lock_hold.Record(Now() - start);
+}
+
+std::vector<CallStats::Entry> CallStats::GetSvcStats() const {
+    std::vector<Entry> entries;
+    for (u32 imm = 0; imm < svcs.size(); imm++) {
+        if (svcs[imm].count.load(std::memory_order::relaxed) == 0) {
+            continue;
+        }
+        const char* name = Kernel::Svc::GetSvcName(imm);
+        entries.push_back(
+            svcs[imm].Snapshot({}, name != nullptr ? name : fmt::format("{:#x}", imm), imm));
+    }
+    SortByTotalTime(entries);
+    return entries;
+}
+
+std::vector<CallStats::Entry> CallStats::GetServiceCommandStats() const {
+    std::vector<Entry> entries;
+    {
+        std::shared_lock lk{commands_mutex};
+        for (const auto& [service, service_commands] : commands) {
+            for (const auto& [command, entry] : service_commands) {
+                entries.push_back(entry.histogram.Snapshot(service, entry.name, command));
+            }
+        }
+    }
+    SortByTotalTime(entries);
+    return entries;
+}
+
+CallStats::LockStats CallStats::GetSchedulerLockStats() const {
+    return {
+        .wait = scheduler_lock_wait.Snapshot({}, "wait", 0),
+        .hold = scheduler_lock_hold.Snapshot({}, "hold", 0),
+    };
+}
+
+void CallStats::Reset() {
+    for (auto& svc : svcs) {
+        svc.Reset();
+    }
+    scheduler_lock_wait.Reset();
+    scheduler_lock_hold.Reset();
+    std::unique_lock lk{commands_mutex};
+    commands.clear();
+}
+
+void CallStats::WriteJson(const std::filesystem::path& path) const {
+    nlohmann::json svc_json = nlohmann::json::array();
+    for (const auto& entry : GetSvcStats()) {
+        svc_json.push_back(ToJson(entry));
+    }
+    nlohmann::json command_json = nlohmann::json::array();
+    for (const auto& entry : GetServiceCommandStats()) {
+        command_json.push_back(ToJson(entry));
+    }
+    const auto scheduler_lock = GetSchedulerLockStats();
+
+    std::vector<u64> bucket_bounds(NumBuckets);
+    for (size_t i = 0; i < NumBuckets; i++) {
+        bucket_bounds[i] = i + 1 < NumBuckets ? u64{1} << i : ~u64{0};
+    }
+
+    const nlohmann::json out{
+        {"bucket_upper_bounds_ns", bucket_bounds},
+        {"svcs", std::move(svc_json)},
+        {"service_commands", std::move(command_json)},
+        {"scheduler_lock",
+         {
+             {"wait", ToJson(scheduler_lock.wait)},
+             {"hold", ToJson(scheduler_lock.hold)},
+         }},
+    };
+
+    if (!Common::FS::CreateParentDirs(path)) {
+        LOG_ERROR(Core, "Failed to create path for '{}' to save call statistics",
+                  Common::FS::PathToUTF8String(path));
+        return;
+    }
+
+    std::ofstream file;
+    Common::FS::OpenFileStream(file, path, std::ios_base::out | std::ios_base::trunc);
+    file << std::setw(4) << out << std::endl;
+
+    LOG_INFO(Core, "Wrote call statistics to '{}'", Common::FS::PathToUTF8String(path));
+}
+
+u64 CallStats::Percentile(const Entry& entry, double percentile) {
+    if (entry.count == 0) {
+        return 0;
+    }
+    const u64 rank = static_cast<u64>(percentile * static_cast<double>(entry.count - 1)) + 1;
+    u64 seen = 0;
+    for (size_t i = 0; i < NumBuckets - 1; i++) {
+        seen += entry.histogram[i];
+        if (seen >= rank) {
+            return std::min(u64{1} << i, entry.max_ns);
+        }
+    }
+    return entry.max_ns;
+}
+
+} // namespace Core
@@ -0,0 +1,115 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <filesystem>
+#include <map>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "common/common_types.h"
+
+namespace Core {
+
+/**
+ * Counts and latency histograms of each supervisor call and each HLE service command, to find the
+ * calls that HLE time goes to, and of the time spent waiting for and holding the kernel scheduler
+ * lock. Recording is off unless enabled, and is a single relaxed load per call while off. All
+ * public functions of this class are thread-safe.
+ */
+class CallStats {
+public:
+    /// Latencies are bucketed by powers of two: bucket 0 holds 0 ns, bucket i holds latencies in
+    /// [2^(i-1), 2^i) ns, and the last bucket holds everything above.
+    static constexpr size_t NumBuckets = 32;
+
+    struct Entry {
+        std::string service; ///< Service name, empty for supervisor calls
+        std::string name;    ///< Name of the supervisor call or command
+        u32 id;              ///< Supervisor call number or command id
+        u64 count;
+        u64 total_ns;
+        u64 max_ns;
+        std::array<u64, NumBuckets> histogram;
+    };
+
+    struct LockStats {
+        Entry wait; ///< Time from starting to acquire the lock until it is owned
+        Entry hold; ///< Time from owning the lock until it is released
+    };
+
+    CallStats();
+    ~CallStats();
+
+    CallStats(const CallStats&) = delete;
+    CallStats& operator=(const CallStats&) = delete;
+
+    void SetEnabled(bool enabled_);
+
+    [[nodiscard]] bool IsEnabled() const {
+        return enabled.load(std::memory_order::relaxed);
+    }
+
+    /// Returns the start time of a call to pass to End*, or zero if recording is off.
+    [[nodiscard]] u64 Begin() const {
+        return IsEnabled() ? Now() : 0;
+    }
+
+    void EndSvc(u32 imm, u64 start);
+    void EndServiceCommand(std::string_view service, u32 command, const char* name, u64 start);
+
+    /// Records a wait for the scheduler lock, and returns the start time of the hold that follows
+    /// it to pass to EndSchedulerLockHold.
+    [[nodiscard]] u64 EndSchedulerLockWait(u64 start);
+    void EndSchedulerLockHold(u64 start);
+
+    /// Returns the calls made so far, those that took the most time in total first.
+    [[nodiscard]] std::vector<Entry> GetSvcStats() const;
+    [[nodiscard]] std::vector<Entry> GetServiceCommandStats() const;
+    [[nodiscard]] LockStats GetSchedulerLockStats() const;
+
+    /// Clears all counters.
+    void Reset();
+
+    /// Writes all tables with their histograms to a JSON file.
+    void WriteJson(const std::filesystem::path& path) const;
+
+    /// Returns an upper bound of the given percentile of the entry's latencies, in nanoseconds.
+    [[nodiscard]] static u64 Percentile(const Entry& entry, double percentile);
+
+private:
+    struct Histogram {
+        void Record(u64 ns);
+        void Reset();
+        [[nodiscard]] Entry Snapshot(std::string service, std::string name, u32 id) const;
+
+        std::atomic<u64> count{};
+        std::atomic<u64> total_ns{};
+        std::atomic<u64> max_ns{};
+        std::array<std::atomic<u64>, NumBuckets> buckets{};
+    };
+
+    struct CommandHistogram {
+        const char* name{};
+        Histogram histogram;
+    };
+
+    [[nodiscard]] static u64 Now();
+
+    std::atomic<bool> enabled{};
+
+    std::array<Histogram, 0x100> svcs{};
+
+    Histogram scheduler_lock_wait;
+    Histogram scheduler_lock_hold;
+
+    mutable std::shared_mutex commands_mutex;
+    std::map<std::string, std::map<u32, CommandHistogram>, std::less<>> commands;
+};
+
+} // namespace Core
@@ -8,12 +8,17 @@
 
 #include "game_settings.h"
 #include "audio_core/audio_core.h"
+#include "common/allocation_profiler.h"
 #include "common/fs/fs.h"
+#include "common/fs/fs_paths.h"
+#include "common/fs/path_util.h"
 #include "common/logging/log.h"
 #include "common/settings.h"
 #include "common/settings_enums.h"
 #include "common/string_util.h"
+#include "common/tracing.h"
 #include "core/arm/exclusive_monitor.h"
+#include "core/call_stats.h"
 #include "core/core.h"
 #include "core/core_timing.h"
 #include "core/cpu_manager.h"
@@ -283,6 +288,9 @@ struct System::Impl {
         is_powered_on = true;
         exit_locked = false;
         exit_requested = false;
+        UpdateTracing();
+        call_stats.Reset();
+        UpdateCallStats();
 
         if (Settings::values.enable_renderdoc_hotkey) {
             renderdoc_api = std::make_unique<Tools::RenderdocAPI>();
@@ -392,6 +400,23 @@ struct System::Impl {
         return status;
     }
 
+    /// Starts or stops recording a trace to match the setting while emulation is running.
+    void UpdateTracing() {
+#ifdef YUZU_TRACING
+        if (is_powered_on && Settings::values.enable_tracing.GetValue()) {
+            Common::Tracing::Start(Common::FS::GetEdenPath(Common::FS::EdenPath::LogDir) /
+                                   TRACE_FILE);
+        } else {
+            Common::Tracing::Stop();
+        }
+#endif
+    }
+
+    /// Starts or stops recording call statistics to match the setting while emulation is running.
+    void UpdateCallStats() {
+        call_stats.SetEnabled(is_powered_on && Settings::values.enable_call_stats.GetValue());
+    }
+
     void ShutdownMainProcess() {
         SetShuttingDown(true);
 
@@ -406,6 +431,13 @@ struct System::Impl {
             gpu_core->NotifyShutdown();
         }
 
+        if (device_memory->buffer.HugePageMode() != Settings::HugePages::Off) {
+            const auto usage = device_memory->buffer.GetHugePageUsage();
+            LOG_INFO(Core, "Huge pages covered {} MiB of guest memory and {} MiB of fastmem views",
+                     usage.backing_bytes >> 20, usage.virtual_bytes >> 20);
+        }
+        Common::AllocationProfiler::LogReport();
+
         stop_event.request_stop();
         core_timing.SyncPause(false);
         Network::CancelPendingSocketOperations();
@@ -427,6 +459,12 @@ struct System::Impl {
         kernel.Shutdown();
         stop_event = {};
         Network::RestartSocketOperations();
+        UpdateTracing();
+        if (call_stats.IsEnabled()) {
+            call_stats.WriteJson(Common::FS::GetEdenPath(Common::FS::EdenPath::LogDir) /
+                                 CALL_STATS_FILE);
+        }
+        UpdateCallStats();
 
         if (auto room_member = Network::GetRoomMember().lock()) {
             Network::GameInfo game_info{};
@@ -525,6 +563,7 @@ struct System::Impl {
 
     std::unique_ptr<Core::PerfStats> perf_stats;
     Core::SpeedLimiter speed_limiter;
+    Core::CallStats call_stats;
 
     bool is_multicore{};
     bool is_async_gpu{};
@@ -760,6 +799,14 @@ const Core::PerfStats& System::GetPerfStats() const {
     return *impl->perf_stats;
 }
 
+Core::CallStats& System::GetCallStats() {
+    return impl->call_stats;
+}
+
+const Core::CallStats& System::GetCallStats() const {
+    return impl->call_stats;
+}
+
 Core::SpeedLimiter& System::SpeedLimiter() {
     return impl->speed_limiter;
 }
@@ -1015,6 +1062,8 @@ void System::Exit() {
 
 void System::ApplySettings() {
     impl->RefreshTime(*this);
+    impl->UpdateTracing();
+    impl->UpdateCallStats();
 
     if (IsPoweredOn()) {
         Renderer().RefreshBaseSettings();
@@ -117,6 +117,7 @@ namespace Core {
 
 class CpuManager;
 class Debugger;
+class CallStats;
 class DeviceMemory;
 class ExclusiveMonitor;
 class GPUDirtyMemoryManager;
@@ -314,6 +315,12 @@ public:
     /// Provides a constant reference to the internal PerfStats instance.
     [[nodiscard]] const Core::PerfStats& GetPerfStats() const;
 
+    /// Provides a reference to the supervisor call and service command statistics.
+    [[nodiscard]] Core::CallStats& GetCallStats();
+
+    /// Provides a constant reference to the supervisor call and service command statistics.
+    [[nodiscard]] const Core::CallStats& GetCallStats() const;
+
     /// Provides a reference to the speed limiter;
     [[nodiscard]] Core::SpeedLimiter& SpeedLimiter();
 
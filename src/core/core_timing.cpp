@@ -7,7 +7,7 @@
 #include <algorithm>
 #include <mutex>
 #include <string>
-#include <tuple>
+#include <utility>
 
 #ifdef _WIN32
 #include "common/windows/timer_resolution.h"
@@ -17,7 +17,9 @@
 #include "common/x64/cpu_wait.h"
 #endif
 
+#include "common/allocation_profiler.h"
 #include "common/settings.h"
+#include "common/tracing.h"
 #include "core/core_timing.h"
 #include "core/hardware_properties.h"
 
@@ -29,28 +31,14 @@ std::shared_ptr<EventType> CreateEvent(std::string name, TimedCallback&& callbac
     return std::make_shared<EventType>(std::move(callback), std::move(name));
 }
 
-struct CoreTiming::Event {
-    s64 time;
-    u64 fifo_order;
-    std::weak_ptr<EventType> type;
-    s64 reschedule_time;
-    heap_t::handle_type handle{};
-
-    // Sort by time, unless the times are the same, in which case sort by
-    // the order added to the queue
-    friend bool operator>(const Event& left, const Event& right) {
-        return std::tie(left.time, left.fifo_order) > std::tie(right.time, right.fifo_order);
-    }
-
-    friend bool operator<(const Event& left, const Event& right) {
-        return std::tie(left.time, left.fifo_order) < std::tie(right.time, right.fifo_order);
-    }
-};
-
 CoreTiming::CoreTiming() : clock{Common::CreateOptimalClock()} {}
 
 CoreTiming::~CoreTiming() {
     Reset();
+    PendingEvent* pending = pending_events.exchange(nullptr, std::memory_order::acquire);
+    while (pending) {
+        delete std::exchange(pending, pending->next);
+    }
 }
 
 void CoreTiming::ThreadEntry(CoreTiming& instance) {
@@ -73,7 +61,8 @@ void CoreTiming::Initialize(std::function<void()>&& on_thread_init_) {
 
 void CoreTiming::ClearPendingEvents() {
     std::scoped_lock lock{advance_lock, basic_lock};
-    event_queue.clear();
+    DrainPendingEvents();
+    event_queue.Clear();
     event.Set();
 }
 
@@ -112,55 +101,57 @@ bool CoreTiming::IsRunning() const {
 
 bool CoreTiming::HasPendingEvents() const {
     std::scoped_lock lock{basic_lock};
-    return !(wait_set && event_queue.empty());
+    return !(wait_set && event_queue.Empty() &&
+             pending_events.load(std::memory_order::acquire) == nullptr);
 }
 
 void CoreTiming::ScheduleEvent(std::chrono::nanoseconds ns_into_future,
                                const std::shared_ptr<EventType>& event_type, bool absolute_time) {
-    {
-        std::scoped_lock scope{basic_lock};
-        const auto next_time{absolute_time ? ns_into_future : GetGlobalTimeNs() + ns_into_future};
-
-        auto h{event_queue.emplace(Event{next_time.count(), event_fifo_id++, event_type, 0})};
-        (*h).handle = h;
-    }
-
-    event.Set();
+    const auto next_time{absolute_time ? ns_into_future : GetGlobalTimeNs() + ns_into_future};
+    PushPendingEvent(next_time.count(), event_type, 0);
 }
 
 void CoreTiming::ScheduleLoopingEvent(std::chrono::nanoseconds start_time,
                                       std::chrono::nanoseconds resched_time,
                                       const std::shared_ptr<EventType>& event_type,
                                       bool absolute_time) {
-    {
-        std::scoped_lock scope{basic_lock};
-        const auto next_time{absolute_time ? start_time : GetGlobalTimeNs() + start_time};
+    const auto next_time{absolute_time ? start_time : GetGlobalTimeNs() + start_time};
+    PushPendingEvent(next_time.count(), event_type, resched_time.count());
+}
 
-        auto h{event_queue.emplace(
-            Event{next_time.count(), event_fifo_id++, event_type, resched_time.count()})};
-        (*h).handle = h;
+void CoreTiming::PushPendingEvent(s64 time, const std::shared_ptr<EventType>& event_type,
+                                  s64 reschedule_time) {
+    auto* const pending = new PendingEvent{
+        .event{time, event_fifo_id.fetch_add(1, std::memory_order::relaxed), event_type,
+               reschedule_time},
+        .type_key = event_type.get(),
+        .next = pending_events.load(std::memory_order::relaxed),
+    };
+    while (!pending_events.compare_exchange_weak(pending->next, pending,
+                                                 std::memory_order::seq_cst,
+                                                 std::memory_order::relaxed)) {
     }
+    // Pairs with the store in Advance, either the timer thread sees the new event or we see the
+    // time it is going to sleep until.
+    if (time < next_wakeup_time.load(std::memory_order::seq_cst)) {
+        event.Set();
+    }
+}
 
-    event.Set();
+void CoreTiming::DrainPendingEvents() {
+    PendingEvent* pending = pending_events.exchange(nullptr, std::memory_order::acquire);
+    while (pending) {
+        event_queue.Insert(std::move(pending->event), pending->type_key);
+        delete std::exchange(pending, pending->next);
+    }
 }
 
 void CoreTiming::UnscheduleEvent(const std::shared_ptr<EventType>& event_type,
                                  UnscheduleEventType type) {
     {
         std::scoped_lock lk{basic_lock};
-
-        std::vector<heap_t::handle_type> to_remove;
-        for (auto itr = event_queue.begin(); itr != event_queue.end(); itr++) {
-            const Event& e = *itr;
-            if (e.type.lock().get() == event_type.get()) {
-                to_remove.push_back(itr->handle);
-            }
-        }
-
-        for (auto& h : to_remove) {
-            event_queue.erase(h);
-        }
-
+        DrainPendingEvents();
+        event_queue.RemoveType(event_type.get());
         event_type->sequence_number++;
     }
 
@@ -221,18 +212,27 @@ u64 CoreTiming::GetGPUTicks() const {
 }
 
 std::optional<s64> CoreTiming::Advance() {
+    TRACE_ZONE("timing", "CoreTiming::Advance");
+    ALLOCATION_SCOPE(CoreTiming);
     std::scoped_lock lock{advance_lock, basic_lock};
+    DrainPendingEvents();
     global_timer = GetGlobalTimeNs().count();
 
-    while (!event_queue.empty() && event_queue.top().time <= global_timer) {
-        const Event& evt = event_queue.top();
+    while (true) {
+        while (const auto handle = event_queue.PopDue(global_timer)) {
+            // Copy the event out, callbacks can schedule events that grow the queue storage.
+            const TimingWheel::Event evt = event_queue.Get(*handle);
+            const auto event_type{evt.type.lock()};
+            if (!event_type) {
+                event_queue.Free(*handle);
+                continue;
+            }
 
-        if (const auto event_type{evt.type.lock()}) {
             const auto evt_time = evt.time;
             const auto evt_sequence_num = event_type->sequence_number;
 
             if (evt.reschedule_time == 0) {
-                event_queue.pop();
+                event_queue.Free(*handle);
 
                 basic_lock.unlock();
 
@@ -249,34 +249,41 @@ std::optional<s64> CoreTiming::Advance() {
                 basic_lock.lock();
 
                 if (evt_sequence_num != event_type->sequence_number) {
-                    // Heap handle is invalidated after external modification.
-                    continue;
-                }
-
-                const auto next_schedule_time{new_schedule_time.has_value()
-                                                  ? new_schedule_time.value().count()
-                                                  : evt.reschedule_time};
+                    // The event was unscheduled while its callback was running.
+                    event_queue.Free(*handle);
+                } else {
+                    const auto next_schedule_time{new_schedule_time.has_value()
+                                                      ? new_schedule_time.value().count()
+                                                      : evt.reschedule_time};
+
+                    // If this event was scheduled into a pause, its time now is going to be way
+                    // behind. Re-set this event to continue from the end of the pause.
+                    auto next_time{evt.time + next_schedule_time};
+                    if (evt.time < pause_end_time) {
+                        next_time = pause_end_time + next_schedule_time;
+                    }
 
-                // If this event was scheduled into a pause, its time now is going to be way
-                // behind. Re-set this event to continue from the end of the pause.
-                auto next_time{evt.time + next_schedule_time};
-                if (evt.time < pause_end_time) {
-                    next_time = pause_end_time + next_schedule_time;
+                    event_queue.Reinsert(*handle, next_time,
+                                         event_fifo_id.fetch_add(1, std::memory_order::relaxed),
+                                         next_schedule_time);
                 }
-
-                event_queue.update(evt.handle, Event{next_time, event_fifo_id++, evt.type,
-                                                     next_schedule_time, evt.handle});
             }
+
+            DrainPendingEvents();
+            global_timer = GetGlobalTimeNs().count();
         }
 
+        TRACE_COUNTER("timing", "Pending events", event_queue.Size());
+        const std::optional<s64> next_time = event_queue.NextTime();
+        next_wakeup_time.store(next_time.value_or(std::numeric_limits<s64>::max()),
+                               std::memory_order::seq_cst);
+        // Events published before the store above may not have signaled the timer thread.
+        if (pending_events.load(std::memory_order::seq_cst) == nullptr) {
+            return next_time;
+        }
+        DrainPendingEvents();
         global_timer = GetGlobalTimeNs().count();
     }
-
-    if (!event_queue.empty()) {
-        return event_queue.top().time;
-    } else {
-        return std::nullopt;
-    }
 }
 
 void CoreTiming::ThreadLoop() {
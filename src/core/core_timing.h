@@ -6,17 +6,17 @@
 #include <atomic>
 #include <chrono>
 #include <functional>
+#include <limits>
 #include <memory>
 #include <mutex>
 #include <optional>
 #include <string>
 #include <thread>
 
-#include <boost/heap/fibonacci_heap.hpp>
-
 #include "common/common_types.h"
 #include "common/thread.h"
 #include "common/wall_clock.h"
+#include "core/timing_wheel.h"
 
 namespace Core::Timing {
 
@@ -139,13 +139,25 @@ public:
 #endif
 
 private:
-    struct Event;
+    /// Event scheduled from any thread, waiting to be moved into the event queue.
+    struct PendingEvent {
+        TimingWheel::Event event;
+        const EventType* type_key;
+        PendingEvent* next;
+    };
 
     static void ThreadEntry(CoreTiming& instance);
     void ThreadLoop();
 
     void Reset();
 
+    /// Publishes an event without taking the event queue lock.
+    void PushPendingEvent(s64 time, const std::shared_ptr<EventType>& event_type,
+                          s64 reschedule_time);
+
+    /// Moves every published event into the event queue, basic_lock must be held.
+    void DrainPendingEvents();
+
     std::unique_ptr<Common::WallClock> clock;
 
     s64 global_timer = 0;
@@ -154,11 +166,13 @@ private:
     s64 timer_resolution_ns;
 #endif
 
-    using heap_t =
-        boost::heap::fibonacci_heap<CoreTiming::Event, boost::heap::compare<std::greater<>>>;
+    TimingWheel event_queue;
+    std::atomic<u64> event_fifo_id{0};
 
-    heap_t event_queue;
-    u64 event_fifo_id = 0;
+    /// Lock-free stack of events scheduled since the last drain.
+    std::atomic<PendingEvent*> pending_events{};
+    /// Time the timer thread sleeps until, new events scheduled later do not need to wake it up.
+    std::atomic<s64> next_wakeup_time{std::numeric_limits<s64>::max()};
 
     Common::Event event{};
     Common::Event pause_event{};
@@ -1,6 +1,7 @@
 // SPDX-FileCopyrightText: Copyright 2020 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include "common/settings.h"
 #include "core/device_memory.h"
 #include "hle/kernel/board/nintendo/nx/k_system_control.h"
 
@@ -12,9 +13,21 @@ constexpr size_t VirtualReserveSize = 1ULL << 38;
 constexpr size_t VirtualReserveSize = 1ULL << 39;
 #endif
 
+static Settings::HugePages GetHugePageMode() {
+    const auto mode = Settings::values.huge_pages.GetValue();
+#ifdef HAS_NCE
+    // NCE runs guest code directly in the fastmem arena, which explicit huge pages disable.
+    if (mode == Settings::HugePages::HugeTlb &&
+        Settings::values.cpu_backend.GetValue() == Settings::CpuBackend::Nce) {
+        return Settings::HugePages::Transparent;
+    }
+#endif
+    return mode;
+}
+
 DeviceMemory::DeviceMemory()
     : buffer{Kernel::Board::Nintendo::Nx::KSystemControl::Init::GetIntendedMemorySize(),
-             VirtualReserveSize} {}
+             VirtualReserveSize, GetHugePageMode()} {}
 
 DeviceMemory::~DeviceMemory() = default;
 
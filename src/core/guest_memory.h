@@ -7,6 +7,7 @@
 #include <memory>
 #include <optional>
 #include <span>
+#include <utility>
 #include <vector>
 
 #include "common/assert.h"
@@ -194,6 +195,12 @@ public:
                                Common::ScratchBuffer<T>* backup = nullptr)
         : GuestMemory<M, T, FLAGS>(memory, addr, size, backup) {}
 
+    // A moved-from object must not write back on destruction.
+    GuestMemoryScoped(GuestMemoryScoped&& rhs) noexcept : GuestMemory<M, T, FLAGS>(std::move(rhs)) {
+        rhs.m_size = 0;
+    }
+    GuestMemoryScoped& operator=(GuestMemoryScoped&& rhs) = delete;
+
     ~GuestMemoryScoped() {
         if constexpr (FLAGS & GuestMemoryFlags::Write) {
             if (this->size() == 0) [[unlikely]] {
@@ -213,7 +220,12 @@ public:
                 }
             } else if constexpr ((FLAGS & GuestMemoryFlags::Safe) ||
                                  (FLAGS & GuestMemoryFlags::Cached)) {
-                this->m_memory->InvalidateRegion(this->m_addr, this->size_bytes());
+                if constexpr (M::HAS_FLUSH_INVALIDATION) {
+                    this->m_memory->InvalidateRegion(this->m_addr, this->size_bytes());
+                } else {
+                    // Written in place, so notify the rasterizer as a block write would.
+                    this->m_memory->StoreDataCache(this->m_addr, this->size_bytes());
+                }
             }
         }
     }
@@ -9,6 +9,7 @@
 #include "common/settings.h"
 #include "core/arm/dynarmic/arm_dynarmic.h"
 #include "core/arm/dynarmic/dynarmic_exclusive_monitor.h"
+#include "core/arm/dynarmic/dynarmic_translation_cache.h"
 #include "core/core.h"
 #include "core/hle/kernel/k_process.h"
 #include "core/hle/kernel/k_scoped_resource_reservation.h"
@@ -183,6 +184,7 @@ void KProcess::Finalize() {
         interface.reset();
     }
     m_exclusive_monitor.reset();
+    m_translation_cache.reset();
 
     // Perform inherited finalization.
     KSynchronizationObject::Finalize();
@@ -1244,6 +1246,12 @@ void KProcess::LoadModule(CodeSet code_set, KProcessAddress base_addr) {
 
     this->GetMemory().WriteBlock(base_addr, code_set.memory.data(), code_set.memory.size());
 
+    if (m_translation_cache) {
+        const auto& code = code_set.CodeSegment();
+        m_translation_cache->AddModule(
+            std::span<const u8>{code_set.memory.data() + code.offset, code.size});
+    }
+
     ReprotectSegment(code_set.CodeSegment(), Svc::MemoryPermission::ReadExecute);
     ReprotectSegment(code_set.RODataSegment(), Svc::MemoryPermission::Read);
     ReprotectSegment(code_set.DataSegment(), Svc::MemoryPermission::ReadWrite);
@@ -1273,10 +1281,15 @@ void KProcess::InitializeInterfaces() {
     } else
 #endif
         if (this->Is64Bit()) {
+        if (this->IsApplication() && m_program_id != 0 &&
+            Settings::values.use_jit_translation_cache.GetValue()) {
+            m_translation_cache = std::make_unique<Core::DynarmicTranslationCache>(m_program_id);
+        }
         for (size_t i = 0; i < Core::Hardware::NUM_CPU_CORES; i++) {
             m_arm_interfaces[i] = std::make_unique<Core::ArmDynarmic64>(
                 m_kernel.System(), m_kernel.IsMulticore(), this,
-                static_cast<Core::DynarmicExclusiveMonitor&>(*m_exclusive_monitor), i);
+                static_cast<Core::DynarmicExclusiveMonitor&>(*m_exclusive_monitor), i,
+                m_translation_cache.get());
         }
     } else {
         for (size_t i = 0; i < Core::Hardware::NUM_CPU_CORES; i++) {
@@ -33,7 +33,9 @@ public:
         } else {
             // Otherwise, we want to disable scheduling and acquire the spinlock.
             SchedulerType::DisableScheduling(m_kernel);
+            const u64 wait_start = m_kernel.BeginSchedulerLockWait();
             m_spin_lock.Lock();
+            m_hold_start = m_kernel.EndSchedulerLockWait(wait_start);
 
             ASSERT(m_lock_count == 0);
             ASSERT(m_owner_thread == nullptr);
@@ -60,6 +62,7 @@ public:
                 SchedulerType::UpdateHighestPriorityThreads(m_kernel);
 
             // Note that we no longer hold the lock, and unlock the spinlock.
+            m_kernel.EndSchedulerLockHold(m_hold_start);
             m_owner_thread = nullptr;
             m_spin_lock.Unlock();
 
@@ -74,6 +77,7 @@ private:
     KernelCore& m_kernel;
     KAlignedSpinLock m_spin_lock{};
     s32 m_lock_count{};
+    u64 m_hold_start{};
     std::atomic<KThread*> m_owner_thread{};
 };
 
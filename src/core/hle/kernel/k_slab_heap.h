@@ -6,7 +6,9 @@
 
 #pragma once
 
+#include <array>
 #include <atomic>
+#include <mutex>
 
 #include "common/assert.h"
 #include "common/atomic_ops.h"
@@ -20,6 +22,13 @@ class KernelCore;
 
 namespace impl {
 
+/// Returns the index of the calling host thread, used to pick its slab heap object cache.
+inline size_t GetCurrentMagazineIndex() {
+    static std::atomic<size_t> s_next_index{};
+    thread_local const size_t s_index = s_next_index.fetch_add(1, std::memory_order::relaxed);
+    return s_index;
+}
+
 class KSlabHeapImpl {
     YUZU_NON_COPYABLE(KSlabHeapImpl);
     YUZU_NON_MOVEABLE(KSlabHeapImpl);
@@ -66,6 +75,37 @@ public:
         m_lock.unlock();
     }
 
+    /// Takes up to max_count objects, linked through their nodes, and stores how many were taken.
+    Node* AllocateBatch(size_t max_count, size_t& out_count) {
+        m_lock.lock();
+
+        Node* const first = m_head;
+        Node* last = nullptr;
+        size_t count = 0;
+        for (Node* cur = first; cur != nullptr && count < max_count; cur = cur->next) {
+            last = cur;
+            count++;
+        }
+        if (last != nullptr) {
+            m_head = last->next;
+            last->next = nullptr;
+        }
+
+        m_lock.unlock();
+        out_count = count;
+        return first;
+    }
+
+    /// Returns the objects linked from first to last.
+    void FreeBatch(Node* first, Node* last) {
+        m_lock.lock();
+
+        last->next = m_head;
+        m_head = first;
+
+        m_lock.unlock();
+    }
+
 private:
     std::atomic<Node*> m_head{};
     Common::SpinLock m_lock;
@@ -79,10 +119,24 @@ class KSlabHeapBase : protected impl::KSlabHeapImpl {
     YUZU_NON_MOVEABLE(KSlabHeapBase);
 
 private:
+    // Each host thread allocates from and frees to a small cache of objects in front of the shared
+    // free list, so that the IPC hot path does not bounce the list between cores. Threads beyond
+    // NumMagazines share caches, which is only slower, as each cache has its own lock.
+    static constexpr size_t NumMagazines = 16;
+    static constexpr size_t MagazineCapacity = 32;
+    static constexpr size_t MagazineBatchSize = MagazineCapacity / 2;
+
+    struct alignas(64) Magazine {
+        Common::SpinLock lock;
+        Node* head{};
+        size_t count{};
+    };
+
     size_t m_obj_size{};
     uintptr_t m_peak{};
     uintptr_t m_start{};
     uintptr_t m_end{};
+    std::array<Magazine, NumMagazines> m_magazines{};
 
 private:
     void UpdatePeakImpl(uintptr_t obj) {
@@ -96,6 +150,36 @@ private:
             !Common::AtomicCompareAndSwap(std::addressof(m_peak), alloc_peak, cur_peak, cur_peak));
     }
 
+    Magazine& GetMagazine() {
+        return m_magazines[impl::GetCurrentMagazineIndex() % NumMagazines];
+    }
+
+    void* AllocateFromAnyMagazine() {
+        // Lock every cache, so that no objects are moving between a cache and the free list and
+        // any object that is free is found. Callers rely on this to never fail an allocation their
+        // resource limit allowed.
+        for (auto& magazine : m_magazines) {
+            magazine.lock.lock();
+        }
+
+        void* obj = KSlabHeapImpl::Allocate();
+        for (auto& magazine : m_magazines) {
+            if (obj != nullptr) {
+                break;
+            }
+            if (Node* node = magazine.head; node != nullptr) {
+                magazine.head = node->next;
+                magazine.count--;
+                obj = node;
+            }
+        }
+
+        for (auto& magazine : m_magazines) {
+            magazine.lock.unlock();
+        }
+        return obj;
+    }
+
 public:
     constexpr KSlabHeapBase() = default;
 
@@ -137,16 +221,54 @@ public:
     }
 
     void* Allocate() {
-        void* obj = KSlabHeapImpl::Allocate();
+        {
+            Magazine& magazine = this->GetMagazine();
+            std::scoped_lock lk{magazine.lock};
 
-        return obj;
+            // Refill an empty cache from the free list.
+            if (magazine.head == nullptr) {
+                magazine.head = KSlabHeapImpl::AllocateBatch(MagazineBatchSize, magazine.count);
+            }
+
+            if (Node* node = magazine.head; node != nullptr) [[likely]] {
+                magazine.head = node->next;
+                magazine.count--;
+                return node;
+            }
+        }
+
+        // The free list is empty, take an object cached by another thread.
+        return this->AllocateFromAnyMagazine();
     }
 
     void Free(void* obj) {
         // Don't allow freeing an object that wasn't allocated from this heap.
         const bool contained = this->Contains(reinterpret_cast<uintptr_t>(obj));
         ASSERT(contained);
-        KSlabHeapImpl::Free(obj);
+
+        Magazine& magazine = this->GetMagazine();
+        std::scoped_lock lk{magazine.lock};
+
+        Node* node = static_cast<Node*>(obj);
+        node->next = magazine.head;
+        magazine.head = node;
+        if (++magazine.count <= MagazineCapacity) [[likely]] {
+            return;
+        }
+
+        // The cache is full, return its least recently freed objects to the free list.
+        Node* last_kept = magazine.head;
+        for (size_t i = 1; i < MagazineBatchSize; i++) {
+            last_kept = last_kept->next;
+        }
+        Node* const first = last_kept->next;
+        Node* last = first;
+        while (last->next != nullptr) {
+            last = last->next;
+        }
+        last_kept->next = nullptr;
+        magazine.count = MagazineBatchSize;
+        KSlabHeapImpl::FreeBatch(first, last);
     }
 
     size_t GetObjectIndex(const void* obj) const {
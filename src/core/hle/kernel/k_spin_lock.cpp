@@ -1,20 +1,45 @@
 // SPDX-FileCopyrightText: Copyright 2021 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include "common/thread_pause.h"
 #include "core/hle/kernel/k_spin_lock.h"
 
 namespace Kernel {
 
+namespace {
+
+// Kernel locks are mostly held for a few hundred nanoseconds, so a waiter spins for about that
+// long before it sleeps in the mutex, which costs a system call on both sides.
+constexpr int SpinCount = 128;
+
+} // Anonymous namespace
+
 void KSpinLock::Lock() {
+    if (Common::CanSpinWait()) {
+        for (int i = 0; i < SpinCount; i++) {
+            // Only attempt the acquire once the holder looks done, so waiters share the line.
+            if (!m_locked.load(std::memory_order_relaxed) && m_lock.try_lock()) {
+                m_locked.store(true, std::memory_order_relaxed);
+                return;
+            }
+            Common::ThreadPause();
+        }
+    }
     m_lock.lock();
+    m_locked.store(true, std::memory_order_relaxed);
 }
 
 void KSpinLock::Unlock() {
+    m_locked.store(false, std::memory_order_relaxed);
     m_lock.unlock();
 }
 
 bool KSpinLock::TryLock() {
-    return m_lock.try_lock();
+    if (!m_lock.try_lock()) {
+        return false;
+    }
+    m_locked.store(true, std::memory_order_relaxed);
+    return true;
 }
 
 } // namespace Kernel
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <mutex>
 
 #include "common/common_funcs.h"
@@ -23,6 +24,8 @@ public:
 
 private:
     std::mutex m_lock;
+    /// Set while the mutex is held, so waiters can spin on a plain load.
+    std::atomic<bool> m_locked{};
 };
 
 // TODO(bunnei): Alias for now, in case we want to implement these accurately in the future.
@@ -20,6 +20,7 @@
 #include "common/thread_worker.h"
 #include "core/arm/arm_interface.h"
 #include "core/arm/exclusive_monitor.h"
+#include "core/call_stats.h"
 #include "core/core.h"
 #include "core/core_timing.h"
 #include "core/cpu_manager.h"
@@ -1312,6 +1313,18 @@ const Core::System& KernelCore::System() const {
     return impl->system;
 }
 
+u64 KernelCore::BeginSchedulerLockWait() const {
+    return impl->system.GetCallStats().Begin();
+}
+
+u64 KernelCore::EndSchedulerLockWait(u64 start) {
+    return impl->system.GetCallStats().EndSchedulerLockWait(start);
+}
+
+void KernelCore::EndSchedulerLockHold(u64 start) {
+    impl->system.GetCallStats().EndSchedulerLockHold(start);
+}
+
 struct KernelCore::SlabHeapContainer {
     KSlabHeap<KClientSession> client_session;
     KSlabHeap<KEvent> event;
@@ -281,6 +281,12 @@ public:
     Core::System& System();
     const Core::System& System() const;
 
+    /// Records scheduler lock wait and hold times in the call statistics. The wait start is zero
+    /// while recording is off, and EndSchedulerLockWait returns the start of the hold.
+    u64 BeginSchedulerLockWait() const;
+    u64 EndSchedulerLockWait(u64 start);
+    void EndSchedulerLockHold(u64 start);
+
     /// Gets the slab heap for the specified kernel object type.
     template <typename T>
     KSlabHeap<T>& SlabHeap();
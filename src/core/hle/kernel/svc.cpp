@@ -8,7 +8,10 @@
 
 #include <type_traits>
 
+#include "common/allocation_profiler.h"
+#include "common/tracing.h"
 #include "core/arm/arm_interface.h"
+#include "core/call_stats.h"
 #include "core/core.h"
 #include "core/hle/kernel/k_process.h"
 #include "core/hle/kernel/svc.h"
@@ -2364,7 +2367,7 @@ static void Call32(Core::System& system, u32 imm, std::span<uint64_t, 8> args) {
     case SvcId::CallSecureMonitor: return SvcWrap_CallSecureMonitor64From32(system, args);
     case SvcId::MapInsecureMemory: return SvcWrap_MapInsecureMemory64From32(system, args);
     case SvcId::UnmapInsecureMemory: return SvcWrap_UnmapInsecureMemory64From32(system, args);
-    default: UNREACHABLE_MSG("Unhandled SVC {:#x}!", imm);
+    default: UNREACHABLE_MSG("Unhandled SVC {:#x}", imm);
     }
 }
 
@@ -2493,7 +2496,136 @@ static void Call64(Core::System& system, u32 imm, std::span<uint64_t, 8> args) {
     case SvcId::CallSecureMonitor: return SvcWrap_CallSecureMonitor64(system, args);
     case SvcId::MapInsecureMemory: return SvcWrap_MapInsecureMemory64(system, args);
     case SvcId::UnmapInsecureMemory: return SvcWrap_UnmapInsecureMemory64(system, args);
-    default: UNREACHABLE_MSG("Unhandled SVC {:#x}!", imm);
+    default: UNREACHABLE_MSG("Unhandled SVC {:#x}", imm);
+    }
+}
+
+const char* GetSvcName(u32 imm) {
+    switch (SvcId(imm)) {
+    case SvcId::SetHeapSize: return "SetHeapSize";
+    case SvcId::SetMemoryPermission: return "SetMemoryPermission";
+    case SvcId::SetMemoryAttribute: return "SetMemoryAttribute";
+    case SvcId::MapMemory: return "MapMemory";
+    case SvcId::UnmapMemory: return "UnmapMemory";
+    case SvcId::QueryMemory: return "QueryMemory";
+    case SvcId::ExitProcess: return "ExitProcess";
+    case SvcId::CreateThread: return "CreateThread";
+    case SvcId::StartThread: return "StartThread";
+    case SvcId::ExitThread: return "ExitThread";
+    case SvcId::SleepThread: return "SleepThread";
+    case SvcId::GetThreadPriority: return "GetThreadPriority";
+    case SvcId::SetThreadPriority: return "SetThreadPriority";
+    case SvcId::GetThreadCoreMask: return "GetThreadCoreMask";
+    case SvcId::SetThreadCoreMask: return "SetThreadCoreMask";
+    case SvcId::GetCurrentProcessorNumber: return "GetCurrentProcessorNumber";
+    case SvcId::SignalEvent: return "SignalEvent";
+    case SvcId::ClearEvent: return "ClearEvent";
+    case SvcId::MapSharedMemory: return "MapSharedMemory";
+    case SvcId::UnmapSharedMemory: return "UnmapSharedMemory";
+    case SvcId::CreateTransferMemory: return "CreateTransferMemory";
+    case SvcId::CloseHandle: return "CloseHandle";
+    case SvcId::ResetSignal: return "ResetSignal";
+    case SvcId::WaitSynchronization: return "WaitSynchronization";
+    case SvcId::CancelSynchronization: return "CancelSynchronization";
+    case SvcId::ArbitrateLock: return "ArbitrateLock";
+    case SvcId::ArbitrateUnlock: return "ArbitrateUnlock";
+    case SvcId::WaitProcessWideKeyAtomic: return "WaitProcessWideKeyAtomic";
+    case SvcId::SignalProcessWideKey: return "SignalProcessWideKey";
+    case SvcId::GetSystemTick: return "GetSystemTick";
+    case SvcId::ConnectToNamedPort: return "ConnectToNamedPort";
+    case SvcId::SendSyncRequestLight: return "SendSyncRequestLight";
+    case SvcId::SendSyncRequest: return "SendSyncRequest";
+    case SvcId::SendSyncRequestWithUserBuffer: return "SendSyncRequestWithUserBuffer";
+    case SvcId::SendAsyncRequestWithUserBuffer: return "SendAsyncRequestWithUserBuffer";
+    case SvcId::GetProcessId: return "GetProcessId";
+    case SvcId::GetThreadId: return "GetThreadId";
+    case SvcId::Break: return "Break";
+    case SvcId::OutputDebugString: return "OutputDebugString";
+    case SvcId::ReturnFromException: return "ReturnFromException";
+    case SvcId::GetInfo: return "GetInfo";
+    case SvcId::FlushEntireDataCache: return "FlushEntireDataCache";
+    case SvcId::FlushDataCache: return "FlushDataCache";
+    case SvcId::MapPhysicalMemory: return "MapPhysicalMemory";
+    case SvcId::UnmapPhysicalMemory: return "UnmapPhysicalMemory";
+    case SvcId::GetDebugFutureThreadInfo: return "GetDebugFutureThreadInfo";
+    case SvcId::GetLastThreadInfo: return "GetLastThreadInfo";
+    case SvcId::GetResourceLimitLimitValue: return "GetResourceLimitLimitValue";
+    case SvcId::GetResourceLimitCurrentValue: return "GetResourceLimitCurrentValue";
+    case SvcId::SetThreadActivity: return "SetThreadActivity";
+    case SvcId::GetThreadContext3: return "GetThreadContext3";
+    case SvcId::WaitForAddress: return "WaitForAddress";
+    case SvcId::SignalToAddress: return "SignalToAddress";
+    case SvcId::SynchronizePreemptionState: return "SynchronizePreemptionState";
+    case SvcId::GetResourceLimitPeakValue: return "GetResourceLimitPeakValue";
+    case SvcId::CreateIoPool: return "CreateIoPool";
+    case SvcId::CreateIoRegion: return "CreateIoRegion";
+    case SvcId::KernelDebug: return "KernelDebug";
+    case SvcId::ChangeKernelTraceState: return "ChangeKernelTraceState";
+    case SvcId::CreateSession: return "CreateSession";
+    case SvcId::AcceptSession: return "AcceptSession";
+    case SvcId::ReplyAndReceiveLight: return "ReplyAndReceiveLight";
+    case SvcId::ReplyAndReceive: return "ReplyAndReceive";
+    case SvcId::ReplyAndReceiveWithUserBuffer: return "ReplyAndReceiveWithUserBuffer";
+    case SvcId::CreateEvent: return "CreateEvent";
+    case SvcId::MapIoRegion: return "MapIoRegion";
+    case SvcId::UnmapIoRegion: return "UnmapIoRegion";
+    case SvcId::MapPhysicalMemoryUnsafe: return "MapPhysicalMemoryUnsafe";
+    case SvcId::UnmapPhysicalMemoryUnsafe: return "UnmapPhysicalMemoryUnsafe";
+    case SvcId::SetUnsafeLimit: return "SetUnsafeLimit";
+    case SvcId::CreateCodeMemory: return "CreateCodeMemory";
+    case SvcId::ControlCodeMemory: return "ControlCodeMemory";
+    case SvcId::SleepSystem: return "SleepSystem";
+    case SvcId::ReadWriteRegister: return "ReadWriteRegister";
+    case SvcId::SetProcessActivity: return "SetProcessActivity";
+    case SvcId::CreateSharedMemory: return "CreateSharedMemory";
+    case SvcId::MapTransferMemory: return "MapTransferMemory";
+    case SvcId::UnmapTransferMemory: return "UnmapTransferMemory";
+    case SvcId::CreateInterruptEvent: return "CreateInterruptEvent";
+    case SvcId::QueryPhysicalAddress: return "QueryPhysicalAddress";
+    case SvcId::QueryIoMapping: return "QueryIoMapping";
+    case SvcId::CreateDeviceAddressSpace: return "CreateDeviceAddressSpace";
+    case SvcId::AttachDeviceAddressSpace: return "AttachDeviceAddressSpace";
+    case SvcId::DetachDeviceAddressSpace: return "DetachDeviceAddressSpace";
+    case SvcId::MapDeviceAddressSpaceByForce: return "MapDeviceAddressSpaceByForce";
+    case SvcId::MapDeviceAddressSpaceAligned: return "MapDeviceAddressSpaceAligned";
+    case SvcId::UnmapDeviceAddressSpace: return "UnmapDeviceAddressSpace";
+    case SvcId::InvalidateProcessDataCache: return "InvalidateProcessDataCache";
+    case SvcId::StoreProcessDataCache: return "StoreProcessDataCache";
+    case SvcId::FlushProcessDataCache: return "FlushProcessDataCache";
+    case SvcId::DebugActiveProcess: return "DebugActiveProcess";
+    case SvcId::BreakDebugProcess: return "BreakDebugProcess";
+    case SvcId::TerminateDebugProcess: return "TerminateDebugProcess";
+    case SvcId::GetDebugEvent: return "GetDebugEvent";
+    case SvcId::ContinueDebugEvent: return "ContinueDebugEvent";
+    case SvcId::GetProcessList: return "GetProcessList";
+    case SvcId::GetThreadList: return "GetThreadList";
+    case SvcId::GetDebugThreadContext: return "GetDebugThreadContext";
+    case SvcId::SetDebugThreadContext: return "SetDebugThreadContext";
+    case SvcId::QueryDebugProcessMemory: return "QueryDebugProcessMemory";
+    case SvcId::ReadDebugProcessMemory: return "ReadDebugProcessMemory";
+    case SvcId::WriteDebugProcessMemory: return "WriteDebugProcessMemory";
+    case SvcId::SetHardwareBreakPoint: return "SetHardwareBreakPoint";
+    case SvcId::GetDebugThreadParam: return "GetDebugThreadParam";
+    case SvcId::GetSystemInfo: return "GetSystemInfo";
+    case SvcId::CreatePort: return "CreatePort";
+    case SvcId::ManageNamedPort: return "ManageNamedPort";
+    case SvcId::ConnectToPort: return "ConnectToPort";
+    case SvcId::SetProcessMemoryPermission: return "SetProcessMemoryPermission";
+    case SvcId::MapProcessMemory: return "MapProcessMemory";
+    case SvcId::UnmapProcessMemory: return "UnmapProcessMemory";
+    case SvcId::QueryProcessMemory: return "QueryProcessMemory";
+    case SvcId::MapProcessCodeMemory: return "MapProcessCodeMemory";
+    case SvcId::UnmapProcessCodeMemory: return "UnmapProcessCodeMemory";
+    case SvcId::CreateProcess: return "CreateProcess";
+    case SvcId::StartProcess: return "StartProcess";
+    case SvcId::TerminateProcess: return "TerminateProcess";
+    case SvcId::GetProcessInfo: return "GetProcessInfo";
+    case SvcId::CreateResourceLimit: return "CreateResourceLimit";
+    case SvcId::SetResourceLimitLimitValue: return "SetResourceLimitLimitValue";
+    case SvcId::CallSecureMonitor: return "CallSecureMonitor";
+    case SvcId::MapInsecureMemory: return "MapInsecureMemory";
+    case SvcId::UnmapInsecureMemory: return "UnmapInsecureMemory";
+    default: return nullptr;
     }
 }
 void Call(Core::System& system, u32 imm) {
@@ -2501,15 +2633,19 @@ void Call(Core::System& system, u32 imm) {
     auto& process = GetCurrentProcess(kernel);
     std::array<uint64_t, 8> args;
     kernel.CurrentPhysicalCore().SaveSvcArguments(process, args);
-    LOG_TRACE(Kernel_SVC, "{} [0]={:#x} [1]={:#x} [2]={:#x} [3]={:#x} [4]={:#x} [5]={:#x} [6]={:#x}",
-        imm, GetArg32(args, 0), GetArg32(args, 1), GetArg32(args, 2),
+    LOG_TRACE(Kernel_SVC, "#{:#x} [0]={:#x} [1]={:#x} [2]={:#x} [3]={:#x} [4]={:#x} [5]={:#x} [6]={:#x}",
+        imm,
+        GetArg32(args, 0), GetArg32(args, 1), GetArg32(args, 2),
         GetArg32(args, 3), GetArg32(args, 4), GetArg32(args, 5), GetArg32(args, 6));
-    //kernel.EnterSVCProfile();
+    TRACE_ZONE_ARG("kernel", "SVC", "id", imm);
+    ALLOCATION_SCOPE(Kernel);
+    auto& call_stats = system.GetCallStats();
+    const u64 call_start = call_stats.Begin();
     if (process.Is64Bit())
         Call64(system, imm, args);
     else
         Call32(system, imm, args);
-    //kernel.ExitSVCProfile();
+    call_stats.EndSvc(imm, call_start);
     kernel.CurrentPhysicalCore().LoadSvcArguments(process, args);
 }
 
@@ -531,6 +531,9 @@ void SvcWrap_SendSyncRequestLight64(Core::System& system, std::span<uint64_t, 8>
 void SvcWrap_CallSecureMonitor64From32(Core::System& system, std::span<uint64_t, 8> args);
 void SvcWrap_CallSecureMonitor64(Core::System& system, std::span<uint64_t, 8> args);
 
+// Returns the name of a supervisor call, or nullptr if there is none with that index.
+const char* GetSvcName(u32 imm);
+
 // Perform a supervisor call by index.
 void Call(Core::System& system, u32 imm);
 
@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include <optional>
+
 #include "common/div_ceil.h"
 
 #include "core/hle/service/cmif_types.h"
@@ -243,7 +245,12 @@ constexpr RequestLayout GetReplyOutLayout(bool is_domain) {
     return is_domain ? GetDomainReplyOutLayout<MethodArguments>() : GetNonDomainReplyOutLayout<MethodArguments>();
 }
 
-using OutTemporaryBuffers = std::array<Common::ScratchBuffer<u8>, 3>;
+struct OutTemporaryBuffers {
+    // Output buffers are mapped so that the service writes straight to guest memory, unless they
+    // overlap an input that the service may still be reading, in which case they are staged.
+    std::array<std::optional<HLERequestContext::WriteBufferMapping>, 3> mapped{};
+    std::array<Common::ScratchBuffer<u8>, 3> staged{};
+};
 
 template <typename MethodArguments, typename CallArguments, size_t PrevAlign = 1, size_t DataOffset = 0, size_t HandleIndex = 0, size_t InBufferIndex = 0, size_t OutBufferIndex = 0, bool RawDataFinished = false, size_t ArgIndex = 0>
 void ReadInArgument(bool is_domain, CallArguments& args, const u8* raw_data, HLERequestContext& ctx, OutTemporaryBuffers& temp) {
@@ -342,16 +349,34 @@ void ReadInArgument(bool is_domain, CallArguments& args, const u8* raw_data, HLE
         } else if constexpr (ArgumentTraits<ArgType>::Type == ArgumentType::OutBuffer) {
             using ElementType = typename ArgType::Type;
 
-            // Set up scratch buffer.
-            auto& buffer = temp[OutBufferIndex];
-            if (ctx.CanWriteBuffer(OutBufferIndex)) {
-                buffer.resize_destructive(ctx.GetWriteBufferSize(OutBufferIndex));
+            // Map the buffer, or set up a scratch buffer if it cannot be written directly.
+            auto& mapped = temp.mapped[OutBufferIndex];
+            auto& buffer = temp.staged[OutBufferIndex];
+            u8* data{};
+            size_t size_bytes{};
+            if (ctx.CanWriteBuffer(OutBufferIndex) && ctx.GetWriteBufferSize(OutBufferIndex) > 0 &&
+                !ctx.WriteBufferOverlapsReadBuffer(OutBufferIndex)) {
+                if constexpr (ArgType::Attr & BufferAttr_HipcAutoSelect) {
+                    mapped.emplace(ctx.MapWriteBuffer(OutBufferIndex));
+                } else if constexpr (ArgType::Attr & BufferAttr_HipcMapAlias) {
+                    mapped.emplace(ctx.MapWriteBufferB(OutBufferIndex));
+                } else /* if (ArgType::Attr & BufferAttr_HipcPointer) */ {
+                    mapped.emplace(ctx.MapWriteBufferC(OutBufferIndex));
+                }
+                data = mapped->data();
+                size_bytes = mapped->size_bytes();
             } else {
-                buffer.resize_destructive(0);
+                if (ctx.CanWriteBuffer(OutBufferIndex)) {
+                    buffer.resize_destructive(ctx.GetWriteBufferSize(OutBufferIndex));
+                } else {
+                    buffer.resize_destructive(0);
+                }
+                data = buffer.data();
+                size_bytes = buffer.size();
             }
 
-            ElementType* ptr = (ElementType*) buffer.data();
-            size_t size = buffer.size() / sizeof(ElementType);
+            ElementType* ptr = (ElementType*) data;
+            size_t size = size_bytes / sizeof(ElementType);
 
             std::get<ArgIndex>(args) = std::span(ptr, size);
 
@@ -416,10 +441,14 @@ void WriteOutArgument(bool is_domain, CallArguments& args, u8* raw_data, HLERequ
 
             return WriteOutArgument<MethodArguments, CallArguments, PrevAlign, DataOffset, OutBufferIndex + 1, RawDataFinished, ArgIndex + 1>(is_domain, args, raw_data, ctx, temp);
         } else if constexpr (ArgumentTraits<ArgType>::Type == ArgumentType::OutBuffer) {
-            auto& buffer = temp[OutBufferIndex];
+            auto& mapped = temp.mapped[OutBufferIndex];
+            auto& buffer = temp.staged[OutBufferIndex];
             const size_t size = buffer.size();
 
-            if (size > 0 && ctx.CanWriteBuffer(OutBufferIndex)) {
+            if (mapped) {
+                // Write back the mapping if it was not direct.
+                mapped.reset();
+            } else if (size > 0 && ctx.CanWriteBuffer(OutBufferIndex)) {
                 if constexpr (ArgType::Attr & BufferAttr_HipcAutoSelect) {
                     ctx.WriteBuffer(buffer.data(), size, OutBufferIndex);
                 } else if constexpr (ArgType::Attr & BufferAttr_HipcMapAlias) {
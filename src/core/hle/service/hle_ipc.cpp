@@ -450,6 +450,69 @@ std::size_t HLERequestContext::WriteBufferC(const void* buffer, std::size_t size
     return size;
 }
 
+HLERequestContext::WriteBufferMapping HLERequestContext::MapWriteBuffer(
+    std::size_t buffer_index) const {
+    const bool is_buffer_b{BufferDescriptorB().size() > buffer_index &&
+                           BufferDescriptorB()[buffer_index].Size()};
+    if (is_buffer_b) {
+        return MapWriteBufferB(buffer_index);
+    } else {
+        return MapWriteBufferC(buffer_index);
+    }
+}
+
+HLERequestContext::WriteBufferMapping HLERequestContext::MapWriteBufferB(
+    std::size_t buffer_index) const {
+    if (buffer_index >= BufferDescriptorB().size()) {
+        return WriteBufferMapping(memory, 0, 0);
+    }
+
+    return WriteBufferMapping(memory, BufferDescriptorB()[buffer_index].Address(),
+                              BufferDescriptorB()[buffer_index].Size(),
+                              buffer_index < write_buffer_data_b.size()
+                                  ? &write_buffer_data_b[buffer_index]
+                                  : nullptr);
+}
+
+HLERequestContext::WriteBufferMapping HLERequestContext::MapWriteBufferC(
+    std::size_t buffer_index) const {
+    if (buffer_index >= BufferDescriptorC().size()) {
+        return WriteBufferMapping(memory, 0, 0);
+    }
+
+    return WriteBufferMapping(memory, BufferDescriptorC()[buffer_index].Address(),
+                              BufferDescriptorC()[buffer_index].Size(),
+                              buffer_index < write_buffer_data_c.size()
+                                  ? &write_buffer_data_c[buffer_index]
+                                  : nullptr);
+}
+
+bool HLERequestContext::WriteBufferOverlapsReadBuffer(std::size_t buffer_index) const {
+    const bool is_buffer_b{BufferDescriptorB().size() > buffer_index &&
+                           BufferDescriptorB()[buffer_index].Size()};
+    VAddr address{};
+    u64 size{};
+    if (is_buffer_b) {
+        address = BufferDescriptorB()[buffer_index].Address();
+        size = BufferDescriptorB()[buffer_index].Size();
+    } else if (BufferDescriptorC().size() > buffer_index) {
+        address = BufferDescriptorC()[buffer_index].Address();
+        size = BufferDescriptorC()[buffer_index].Size();
+    }
+    if (size == 0) {
+        return false;
+    }
+
+    const auto overlaps = [&](VAddr other_address, u64 other_size) {
+        return other_size != 0 && address < other_address + other_size &&
+               other_address < address + size;
+    };
+    return std::ranges::any_of(BufferDescriptorA(),
+                               [&](const auto& a) { return overlaps(a.Address(), a.Size()); }) ||
+           std::ranges::any_of(BufferDescriptorX(),
+                               [&](const auto& x) { return overlaps(x.Address(), x.Size()); });
+}
+
 std::size_t HLERequestContext::GetReadBufferSize(std::size_t buffer_index) const {
     const bool is_buffer_a{BufferDescriptorA().size() > buffer_index &&
                            BufferDescriptorA()[buffer_index].Size()};
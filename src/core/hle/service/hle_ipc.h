@@ -16,6 +16,7 @@
 #include "common/common_types.h"
 #include "common/concepts.h"
 #include "common/swap.h"
+#include "core/guest_memory.h"
 #include "core/hle/ipc.h"
 #include "core/hle/kernel/k_handle_table.h"
 #include "core/hle/kernel/svc_common.h"
@@ -281,6 +282,25 @@ public:
     std::size_t WriteBufferC(const void* buffer, std::size_t size,
                              std::size_t buffer_index = 0) const;
 
+    /// Output buffer mapped for writing. Writes go directly to guest memory when the buffer is
+    /// contiguous in host memory, otherwise they are written back when the mapping is destroyed.
+    using WriteBufferMapping =
+        Core::Memory::GuestMemoryScoped<Core::Memory::Memory, u8,
+                                        Core::Memory::GuestMemoryFlags::SafeWrite>;
+
+    /// Helper function to map an output buffer using the appropriate buffer descriptor
+    [[nodiscard]] WriteBufferMapping MapWriteBuffer(std::size_t buffer_index = 0) const;
+
+    /// Helper function to map buffer B
+    [[nodiscard]] WriteBufferMapping MapWriteBufferB(std::size_t buffer_index = 0) const;
+
+    /// Helper function to map buffer C
+    [[nodiscard]] WriteBufferMapping MapWriteBufferC(std::size_t buffer_index = 0) const;
+
+    /// Helper function to test whether the output buffer at buffer_index overlaps an input buffer,
+    /// in which case writing to its mapping may change the input while it is still being read
+    [[nodiscard]] bool WriteBufferOverlapsReadBuffer(std::size_t buffer_index = 0) const;
+
     /* Helper function to write a buffer using the appropriate buffer descriptor
      *
      * @tparam T an arbitrary container that satisfies the
@@ -431,6 +451,8 @@ private:
 
     mutable std::array<Common::ScratchBuffer<u8>, 3> read_buffer_data_a{};
     mutable std::array<Common::ScratchBuffer<u8>, 3> read_buffer_data_x{};
+    mutable std::array<Common::ScratchBuffer<u8>, 3> write_buffer_data_b{};
+    mutable std::array<Common::ScratchBuffer<u8>, 3> write_buffer_data_c{};
 };
 
 } // namespace Service
@@ -68,12 +68,17 @@ void NVDRV::Ioctl1(HLERequestContext& ctx) {
     }
 
     // Check device
-    output_buffer.resize_destructive(ctx.GetWriteBufferSize(0));
     const auto input_buffer = ctx.ReadBuffer(0);
 
-    const auto nv_result = nvdrv->Ioctl1(fd, command, input_buffer, output_buffer);
+    // Ioctls read all of their input before writing output, so output can go directly to the
+    // guest even if it aliases the input.
+    NvResult nv_result{};
     if (command.is_out != 0) {
-        ctx.WriteBuffer(output_buffer);
+        auto output = ctx.MapWriteBuffer(0);
+        nv_result = nvdrv->Ioctl1(fd, command, input_buffer, {output.data(), output.size()});
+    } else {
+        output_buffer.resize_destructive(ctx.GetWriteBufferSize(0));
+        nv_result = nvdrv->Ioctl1(fd, command, input_buffer, output_buffer);
     }
 
     IPC::ResponseBuilder rb{ctx, 3};
@@ -95,12 +100,16 @@ void NVDRV::Ioctl2(HLERequestContext& ctx) {
 
     const auto input_buffer = ctx.ReadBuffer(0);
     const auto input_inlined_buffer = ctx.ReadBuffer(1);
-    output_buffer.resize_destructive(ctx.GetWriteBufferSize(0));
 
-    const auto nv_result =
-        nvdrv->Ioctl2(fd, command, input_buffer, input_inlined_buffer, output_buffer);
+    NvResult nv_result{};
     if (command.is_out != 0) {
-        ctx.WriteBuffer(output_buffer);
+        auto output = ctx.MapWriteBuffer(0);
+        nv_result = nvdrv->Ioctl2(fd, command, input_buffer, input_inlined_buffer,
+                                  {output.data(), output.size()});
+    } else {
+        output_buffer.resize_destructive(ctx.GetWriteBufferSize(0));
+        nv_result =
+            nvdrv->Ioctl2(fd, command, input_buffer, input_inlined_buffer, output_buffer);
     }
 
     IPC::ResponseBuilder rb{ctx, 3};
@@ -121,14 +130,18 @@ void NVDRV::Ioctl3(HLERequestContext& ctx) {
     }
 
     const auto input_buffer = ctx.ReadBuffer(0);
-    output_buffer.resize_destructive(ctx.GetWriteBufferSize(0));
-    inline_output_buffer.resize_destructive(ctx.GetWriteBufferSize(1));
 
-    const auto nv_result =
-        nvdrv->Ioctl3(fd, command, input_buffer, output_buffer, inline_output_buffer);
+    NvResult nv_result{};
     if (command.is_out != 0) {
-        ctx.WriteBuffer(output_buffer, 0);
-        ctx.WriteBuffer(inline_output_buffer, 1);
+        auto output = ctx.MapWriteBuffer(0);
+        auto inline_output = ctx.MapWriteBuffer(1);
+        nv_result = nvdrv->Ioctl3(fd, command, input_buffer, {output.data(), output.size()},
+                                  {inline_output.data(), inline_output.size()});
+    } else {
+        output_buffer.resize_destructive(ctx.GetWriteBufferSize(0));
+        inline_output_buffer.resize_destructive(ctx.GetWriteBufferSize(1));
+        nv_result =
+            nvdrv->Ioctl3(fd, command, input_buffer, output_buffer, inline_output_buffer);
     }
 
     IPC::ResponseBuilder rb{ctx, 3};
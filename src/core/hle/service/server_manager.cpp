@@ -12,6 +12,7 @@
 #include "core/hle/kernel/k_server_port.h"
 #include "core/hle/kernel/k_server_session.h"
 #include "core/hle/kernel/k_synchronization_object.h"
+#include "core/hle/kernel/k_thread.h"
 #include "core/hle/kernel/svc_results.h"
 #include "core/hle/service/hle_ipc.h"
 #include "core/hle/service/ipc_helpers.h"
@@ -26,6 +27,15 @@ enum class UserDataTag {
     DeferEvent,
 };
 
+namespace {
+
+// Set while RunMultiplexed starts services on this thread. Service threads may be fibers sharing
+// a host thread, so the guest thread is checked as well.
+thread_local ServerManager* s_multiplexing_host{};
+thread_local Kernel::KThread* s_multiplexing_thread{};
+
+} // namespace
+
 class Port : public MultiWaitHolder, public Common::IntrusiveListBaseNode<Port> {
 public:
     explicit Port(Kernel::KServerPort* server_port, SessionRequestHandlerFactory&& handler_factory)
@@ -119,9 +129,58 @@ ServerManager::~ServerManager() {
 }
 
 void ServerManager::RunServer(std::unique_ptr<ServerManager>&& server_manager) {
+    auto& kernel = server_manager->m_system.Kernel();
+    if (s_multiplexing_host != nullptr &&
+        s_multiplexing_thread == Kernel::GetCurrentThreadPointer(kernel)) {
+        s_multiplexing_host->TakeOver(std::move(server_manager));
+        return;
+    }
+
     server_manager->m_system.RunServer(std::move(server_manager));
 }
 
+void ServerManager::RunMultiplexed(Core::System& system,
+                                   const std::vector<void (*)(Core::System&)>& loop_processes) {
+    auto host = std::make_unique<ServerManager>(system);
+
+    // Start each process. Their servers are taken over by the host as they are run.
+    s_multiplexing_host = host.get();
+    s_multiplexing_thread = Kernel::GetCurrentThreadPointer(system.Kernel());
+    for (const auto loop_process : loop_processes) {
+        loop_process(system);
+    }
+    s_multiplexing_host = nullptr;
+    s_multiplexing_thread = nullptr;
+
+    RunServer(std::move(host));
+}
+
+void ServerManager::TakeOver(std::unique_ptr<ServerManager>&& other) {
+    // Deferrals, additional threads and sessions are bound to the server they were made on.
+    ASSERT(other->m_deferral_event == nullptr);
+    ASSERT(other->m_threads.empty());
+    ASSERT(other->m_sessions.empty());
+
+    {
+        std::scoped_lock lk{m_deferred_list_mutex, other->m_deferred_list_mutex};
+
+        // The other server has never waited, so its ports are all on its deferred list.
+        while (!other->m_servers.empty()) {
+            auto& port = other->m_servers.front();
+            other->m_servers.pop_front();
+            port.UnlinkFromMultiWait();
+            m_servers.push_back(port);
+            port.LinkToMultiWait(std::addressof(m_deferred_list));
+        }
+    }
+
+    // Signal the wakeup event.
+    m_wakeup_event->Signal();
+
+    // The other server never ran its loop, so there is nothing to wait for when destroying it.
+    other->m_stopped.Set();
+}
+
 Result ServerManager::RegisterSession(Kernel::KServerSession* server_session,
                                       std::shared_ptr<SessionRequestManager> manager) {
     // We are taking ownership of the server session, so don't open it.
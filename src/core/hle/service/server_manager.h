@@ -52,7 +52,15 @@ public:
 
     static void RunServer(std::unique_ptr<ServerManager>&& server);
 
+    /// Starts each of the given service processes and runs all of their services on a single
+    /// server manager loop on the current thread, instead of a thread for each. Each function
+    /// must end by calling RunServer, must not keep state on its stack that its services use, and
+    /// must not keep a reference to its server manager, which is destroyed once taken over.
+    static void RunMultiplexed(Core::System& system,
+                               const std::vector<void (*)(Core::System&)>& loop_processes);
+
 private:
+    void TakeOver(std::unique_ptr<ServerManager>&& other);
     void LinkToDeferredList(MultiWaitHolder* holder);
     void LinkDeferred();
     MultiWaitHolder* WaitSignaled();
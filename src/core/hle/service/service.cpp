@@ -5,9 +5,12 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <fmt/ranges.h>
+#include "common/allocation_profiler.h"
 #include "common/assert.h"
 #include "common/logging/log.h"
 #include "common/settings.h"
+#include "common/tracing.h"
+#include "core/call_stats.h"
 #include "core/core.h"
 #include "core/hle/ipc.h"
 #include "core/hle/kernel/kernel.h"
@@ -84,7 +87,12 @@ void ServiceFrameworkBase::InvokeRequest(HLERequestContext& ctx) {
         return ReportUnimplementedFunction(ctx, info);
 
     LOG_TRACE(Service, "{}", MakeFunctionString(info->name, GetServiceName(), ctx.CommandBuffer()));
+    TRACE_ZONE("ipc", info->name);
+    ALLOCATION_SCOPE(Service);
+    auto& call_stats = system.GetCallStats();
+    const u64 call_start = call_stats.Begin();
     handler_invoker(this, info->handler_callback, ctx);
+    call_stats.EndServiceCommand(GetServiceName(), ctx.GetCommand(), info->name, call_start);
 }
 
 void ServiceFrameworkBase::InvokeRequestTipc(HLERequestContext& ctx) {
@@ -94,7 +102,12 @@ void ServiceFrameworkBase::InvokeRequestTipc(HLERequestContext& ctx) {
         return ReportUnimplementedFunction(ctx, info);
 
     LOG_TRACE(Service, "{}", MakeFunctionString(info->name, GetServiceName(), ctx.CommandBuffer()));
+    TRACE_ZONE("ipc", info->name);
+    ALLOCATION_SCOPE(Service);
+    auto& call_stats = system.GetCallStats();
+    const u64 call_start = call_stats.Begin();
     handler_invoker(this, info->handler_callback, ctx);
+    call_stats.EndServiceCommand(GetServiceName(), ctx.GetCommand(), info->name, call_start);
 }
 
 Result ServiceFrameworkBase::HandleSyncRequest(Kernel::KServerSession& session,
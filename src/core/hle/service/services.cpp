@@ -56,6 +56,7 @@
 #include "core/hle/service/psc/psc.h"
 #include "core/hle/service/ptm/ptm.h"
 #include "core/hle/service/ro/ro.h"
+#include "core/hle/service/server_manager.h"
 #include "core/hle/service/service.h"
 #include "core/hle/service/set/settings.h"
 #include "core/hle/service/sm/sm.h"
@@ -96,57 +97,65 @@ Services::Services(std::shared_ptr<SM::ServiceManager>& sm, Core::System& system
         kernel.RunOnHostCoreProcess(std::string(e.first), [&system, f = e.second] { f(system); }).detach();
     kernel.RunOnHostCoreProcess("vi",         [&, token] { VI::LoopProcess(system, token); }).detach();
     // Avoid cold clones of lambdas -- succintly
+    // sm defers requests, am keeps its window system on its stack, psc's time service manager
+    // registers more services on its server manager later, and hid and nvnflinger are busy enough
+    // to have their own thread.
     for (auto const& e : std::vector<std::pair<std::string_view, void (*)(Core::System&)>>{
         {"sm",         &SM::LoopProcess},
-        {"account",    &Account::LoopProcess},
         {"am",         &AM::LoopProcess},
-        {"aoc",        &AOC::LoopProcess},
-        {"apm",        &APM::LoopProcess},
-        {"bcat",       &BCAT::LoopProcess},
-        {"bpc",        &BPC::LoopProcess},
-        {"btdrv",      &BtDrv::LoopProcess},
-        {"btm",        &BTM::LoopProcess},
-        {"capsrv",     &Capture::LoopProcess},
-        {"erpt",       &ERPT::LoopProcess},
-        {"es",         &ES::LoopProcess},
-        {"eupld",      &EUPLD::LoopProcess},
-        {"fatal",      &Fatal::LoopProcess},
-        {"fgm",        &FGM::LoopProcess},
-        {"friends",    &Friend::LoopProcess},
-        {"settings",   &Set::LoopProcess},
         {"psc",        &PSC::LoopProcess},
-        {"glue",       &Glue::LoopProcess},
-        {"grc",        &GRC::LoopProcess},
         {"hid",        &HID::LoopProcess},
-        {"lbl",        &LBL::LoopProcess},
-        {"LogManager.Prod", &LM::LoopProcess},
-        {"mig",        &Migration::LoopProcess},
-        {"mii",        &Mii::LoopProcess},
-        {"mm",         &MM::LoopProcess},
-        {"mnpp",       &MNPP::LoopProcess},
         {"nvnflinger", &Nvnflinger::LoopProcess},
-        {"NCM",        &NCM::LoopProcess},
-        {"nfc",        &NFC::LoopProcess},
-        {"nfp",        &NFP::LoopProcess},
-        {"ngc",        &NGC::LoopProcess},
-        {"nifm",       &NIFM::LoopProcess},
-        {"nim",        &NIM::LoopProcess},
-        {"npns",       &NPNS::LoopProcess},
-        {"ns",         &NS::LoopProcess},
-        {"olsc",       &OLSC::LoopProcess},
-        {"omm",        &OMM::LoopProcess},
-        {"pcie",       &PCIe::LoopProcess},
-        {"pctl",       &PCTL::LoopProcess},
-        {"pcv",        &PCV::LoopProcess},
-        {"prepo",      &PlayReport::LoopProcess},
-        {"ProcessManager", &PM::LoopProcess},
-        {"ptm",        &PTM::LoopProcess},
-        {"ro",         &RO::LoopProcess},
-        {"spl",        &SPL::LoopProcess},
-        {"ssl",        &SSL::LoopProcess},
-        {"usb",        &USB::LoopProcess}
     })
         kernel.RunOnGuestCoreProcess(std::string(e.first), [&system, f = e.second] { f(system); });
+    // The rest see little traffic, so serve them all from one thread rather than one each.
+    kernel.RunOnGuestCoreProcess("services", [&system] {
+        ServerManager::RunMultiplexed(system, {
+            &Account::LoopProcess,
+            &AOC::LoopProcess,
+            &APM::LoopProcess,
+            &BCAT::LoopProcess,
+            &BPC::LoopProcess,
+            &BtDrv::LoopProcess,
+            &BTM::LoopProcess,
+            &Capture::LoopProcess,
+            &ERPT::LoopProcess,
+            &ES::LoopProcess,
+            &EUPLD::LoopProcess,
+            &Fatal::LoopProcess,
+            &FGM::LoopProcess,
+            &Friend::LoopProcess,
+            &Set::LoopProcess,
+            &Glue::LoopProcess,
+            &GRC::LoopProcess,
+            &LBL::LoopProcess,
+            &LM::LoopProcess,
+            &Migration::LoopProcess,
+            &Mii::LoopProcess,
+            &MM::LoopProcess,
+            &MNPP::LoopProcess,
+            &NCM::LoopProcess,
+            &NFC::LoopProcess,
+            &NFP::LoopProcess,
+            &NGC::LoopProcess,
+            &NIFM::LoopProcess,
+            &NIM::LoopProcess,
+            &NPNS::LoopProcess,
+            &NS::LoopProcess,
+            &OLSC::LoopProcess,
+            &OMM::LoopProcess,
+            &PCIe::LoopProcess,
+            &PCTL::LoopProcess,
+            &PCV::LoopProcess,
+            &PlayReport::LoopProcess,
+            &PM::LoopProcess,
+            &PTM::LoopProcess,
+            &RO::LoopProcess,
+            &SPL::LoopProcess,
+            &SSL::LoopProcess,
+            &USB::LoopProcess,
+        });
+    });
 }
 
 } // namespace Service
@@ -978,6 +978,22 @@ u32 Memory::Read32(const Common::ProcessAddress addr) {
     return impl->Read32(addr);
 }
 
+std::optional<u32> Memory::ReadPlain32(const Common::ProcessAddress addr) const {
+    const auto& page_table = *impl->current_page_table;
+    const size_t page = addr >> YUZU_PAGEBITS;
+    if (page >= page_table.pointers.size()) {
+        return std::nullopt;
+    }
+    // Only plain memory pages have a pointer, the others are accessed through the slow path.
+    const uintptr_t pointer = page_table.pointers[page].Pointer();
+    if (pointer == 0) {
+        return std::nullopt;
+    }
+    u32 value;
+    std::memcpy(&value, reinterpret_cast<const u8*>(pointer + GetInteger(addr)), sizeof(value));
+    return value;
+}
+
 u64 Memory::Read64(const Common::ProcessAddress addr) {
     return impl->Read64(addr);
 }
@@ -198,6 +198,18 @@ public:
      */
     u32 Read32(Common::ProcessAddress addr);
 
+    /**
+     * Reads a 32-bit unsigned value from a page of plain memory in the current process' address
+     * space. Unlike Read32, only the page table is looked at, and rasterizer cached and debug
+     * pages are not read. This makes it safe to call from threads that are not registered with
+     * the system.
+     *
+     * @param addr The 4-byte aligned virtual address to read the 32-bit value from.
+     *
+     * @returns the read 32-bit unsigned value, or std::nullopt if the page is not plain memory.
+     */
+    [[nodiscard]] std::optional<u32> ReadPlain32(Common::ProcessAddress addr) const;
+
     /**
      * Reads a 64-bit unsigned value from the current process' address space
      * at the given virtual address.
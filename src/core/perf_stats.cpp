@@ -13,6 +13,7 @@
 #include <thread>
 #include <fmt/chrono.h>
 #include <fmt/ranges.h>
+#include "common/allocation_profiler.h"
 #include "common/fs/file.h"
 #include "common/fs/fs.h"
 #include "common/fs/path_util.h"
@@ -68,6 +69,8 @@ void PerfStats::BeginSystemFrame() {
 }
 
 void PerfStats::EndSystemFrame() {
+    Common::AllocationProfiler::EndFrame();
+
     std::scoped_lock lock{object_mutex};
 
     auto frame_end = Clock::now();
@@ -0,0 +1,298 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <algorithm>
+#include <bit>
+#include <iterator>
+#include <tuple>
+#include <utility>
+
+#include "core/timing_wheel.h"
+
+namespace Core::Timing {
+
+TimingWheel::TimingWheel() {
+    for (auto& level : slots) {
+        level.fill(Invalid);
+    }
+}
+
+TimingWheel::Handle TimingWheel::Insert(Event&& event, const EventType* type_key) {
+    const Handle handle = Allocate();
+    Node& node = nodes[handle];
+    node.event = std::move(event);
+    node.type_key = type_key;
+    Place(handle);
+    LinkType(handle);
+    ++num_events;
+    return handle;
+}
+
+void TimingWheel::Reinsert(Handle handle, s64 time, u64 fifo_order, s64 reschedule_time) {
+    Node& node = nodes[handle];
+    node.event.time = time;
+    node.event.fifo_order = fifo_order;
+    node.event.reschedule_time = reschedule_time;
+    Place(handle);
+    LinkType(handle);
+    ++num_events;
+}
+
+void TimingWheel::RemoveType(const EventType* type_key) {
+    const auto it = type_heads.find(type_key);
+    if (it == type_heads.end()) {
+        return;
+    }
+    Handle handle = it->second;
+    type_heads.erase(it);
+    while (handle != Invalid) {
+        const Handle next = nodes[handle].type_next;
+        Unplace(handle);
+        Free(handle);
+        --num_events;
+        handle = next;
+    }
+}
+
+std::optional<TimingWheel::Handle> TimingWheel::PopDue(s64 now) {
+    if (!FillReady()) {
+        return std::nullopt;
+    }
+    const Handle handle = ready.front();
+    if (nodes[handle].event.time > now) {
+        return std::nullopt;
+    }
+    ReadyRemove(0);
+    UnlinkType(handle);
+    nodes[handle].location = LocationDetached;
+    --num_events;
+    return handle;
+}
+
+void TimingWheel::Free(Handle handle) {
+    Node& node = nodes[handle];
+    node.event.type.reset();
+    node.location = LocationDetached;
+    free_nodes.push_back(handle);
+}
+
+std::optional<s64> TimingWheel::NextTime() {
+    if (!FillReady()) {
+        return std::nullopt;
+    }
+    return nodes[ready.front()].event.time;
+}
+
+void TimingWheel::Clear() {
+    nodes.clear();
+    free_nodes.clear();
+    for (auto& level : slots) {
+        level.fill(Invalid);
+    }
+    occupied.fill(0);
+    overflow = Invalid;
+    ready.clear();
+    type_heads.clear();
+    current_tick = 0;
+    num_events = 0;
+}
+
+TimingWheel::Handle TimingWheel::Allocate() {
+    if (!free_nodes.empty()) {
+        const Handle handle = free_nodes.back();
+        free_nodes.pop_back();
+        return handle;
+    }
+    nodes.emplace_back();
+    return static_cast<Handle>(nodes.size() - 1);
+}
+
+void TimingWheel::Place(Handle handle) {
+    Node& node = nodes[handle];
+    const u64 tick = ToTick(node.event.time);
+    if (tick <= current_tick) {
+        ReadyPush(handle);
+        return;
+    }
+    const u32 level = static_cast<u32>(std::bit_width(tick ^ current_tick) - 1) / SlotBits;
+    if (level >= NumLevels) {
+        node.location = LocationOverflow;
+        PushList(overflow, handle);
+        return;
+    }
+    const u32 slot = static_cast<u32>(tick >> (level * SlotBits)) & (NumSlots - 1);
+    node.location = static_cast<u16>(level * NumSlots + slot);
+    PushList(slots[level][slot], handle);
+    occupied[level] |= u64{1} << slot;
+}
+
+void TimingWheel::Unplace(Handle handle) {
+    const Node& node = nodes[handle];
+    if (node.location == LocationReady) {
+        ReadyRemove(node.prev);
+        return;
+    }
+    if (node.location == LocationOverflow) {
+        UnlinkList(overflow, handle);
+        return;
+    }
+    const u32 level = node.location / NumSlots;
+    const u32 slot = node.location % NumSlots;
+    u32& head = slots[level][slot];
+    UnlinkList(head, handle);
+    if (head == Invalid) {
+        occupied[level] &= ~(u64{1} << slot);
+    }
+}
+
+void TimingWheel::LinkType(Handle handle) {
+    Node& node = nodes[handle];
+    node.type_prev = Invalid;
+    const auto [it, inserted] = type_heads.try_emplace(node.type_key, handle);
+    if (inserted) {
+        node.type_next = Invalid;
+        return;
+    }
+    node.type_next = it->second;
+    nodes[it->second].type_prev = handle;
+    it->second = handle;
+}
+
+void TimingWheel::UnlinkType(Handle handle) {
+    const Node& node = nodes[handle];
+    if (node.type_prev != Invalid) {
+        nodes[node.type_prev].type_next = node.type_next;
+    } else if (node.type_next == Invalid) {
+        type_heads.erase(node.type_key);
+    } else {
+        type_heads[node.type_key] = node.type_next;
+    }
+    if (node.type_next != Invalid) {
+        nodes[node.type_next].type_prev = node.type_prev;
+    }
+}
+
+void TimingWheel::PushList(u32& head, Handle handle) {
+    Node& node = nodes[handle];
+    node.prev = Invalid;
+    node.next = head;
+    if (head != Invalid) {
+        nodes[head].prev = handle;
+    }
+    head = handle;
+}
+
+void TimingWheel::UnlinkList(u32& head, Handle handle) {
+    const Node& node = nodes[handle];
+    if (node.prev != Invalid) {
+        nodes[node.prev].next = node.next;
+    } else {
+        head = node.next;
+    }
+    if (node.next != Invalid) {
+        nodes[node.next].prev = node.prev;
+    }
+}
+
+bool TimingWheel::FillReady() {
+    while (ready.empty()) {
+        if (num_events == 0) {
+            return false;
+        }
+        const auto level_it =
+            std::find_if(occupied.begin(), occupied.end(), [](u64 bits) { return bits != 0; });
+        if (level_it != occupied.end()) {
+            // Every occupied slot is ahead of the current tick, jump to the start of the first one.
+            const u32 level = static_cast<u32>(std::distance(occupied.begin(), level_it));
+            const u32 slot = static_cast<u32>(std::countr_zero(*level_it));
+            const u32 shift = level * SlotBits;
+            const u64 block_mask = (u64{1} << (shift + SlotBits)) - 1;
+            current_tick = (current_tick & ~block_mask) | (u64{slot} << shift);
+
+            const u32 head = std::exchange(slots[level][slot], Invalid);
+            occupied[level] &= ~(u64{1} << slot);
+            CascadeList(head);
+            continue;
+        }
+        // Only far away events are left, restart the wheel from the earliest one.
+        u64 min_tick = std::numeric_limits<u64>::max();
+        for (u32 handle = overflow; handle != Invalid; handle = nodes[handle].next) {
+            min_tick = (std::min)(min_tick, ToTick(nodes[handle].event.time));
+        }
+        current_tick = min_tick;
+        CascadeList(std::exchange(overflow, Invalid));
+    }
+    return true;
+}
+
+void TimingWheel::CascadeList(u32 head) {
+    while (head != Invalid) {
+        const u32 next = nodes[head].next;
+        Place(head);
+        head = next;
+    }
+}
+
+bool TimingWheel::ReadyLess(Handle lhs, Handle rhs) const {
+    const Event& left = nodes[lhs].event;
+    const Event& right = nodes[rhs].event;
+    return std::tie(left.time, left.fifo_order) < std::tie(right.time, right.fifo_order);
+}
+
+void TimingWheel::ReadyPush(Handle handle) {
+    Node& node = nodes[handle];
+    node.location = LocationReady;
+    node.prev = static_cast<u32>(ready.size());
+    ready.push_back(handle);
+    ReadySiftUp(node.prev);
+}
+
+void TimingWheel::ReadyRemove(u32 index) {
+    const Handle last = ready.back();
+    ready.pop_back();
+    if (index == ready.size()) {
+        return;
+    }
+    ready[index] = last;
+    nodes[last].prev = index;
+    ReadySiftDown(index);
+    ReadySiftUp(nodes[last].prev);
+}
+
+void TimingWheel::ReadySiftUp(u32 index) {
+    const Handle handle = ready[index];
+    while (index > 0) {
+        const u32 parent = (index - 1) / 2;
+        if (!ReadyLess(handle, ready[parent])) {
+            break;
+        }
+        ready[index] = ready[parent];
+        nodes[ready[index]].prev = index;
+        index = parent;
+    }
+    ready[index] = handle;
+    nodes[handle].prev = index;
+}
+
+void TimingWheel::ReadySiftDown(u32 index) {
+    const Handle handle = ready[index];
+    const u32 size = static_cast<u32>(ready.size());
+    while (true) {
+        const u32 left = index * 2 + 1;
+        if (left >= size) {
+            break;
+        }
+        const u32 right = left + 1;
+        const u32 child = right < size && ReadyLess(ready[right], ready[left]) ? right : left;
+        if (!ReadyLess(ready[child], handle)) {
+            break;
+        }
+        ready[index] = ready[child];
+        nodes[ready[index]].prev = index;
+        index = child;
+    }
+    ready[index] = handle;
+    nodes[handle].prev = index;
+}
+
+} // namespace Core::Timing
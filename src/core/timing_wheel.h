@@ -0,0 +1,138 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <array>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include "common/common_types.h"
+
+namespace Core::Timing {
+
+struct EventType;
+
+/**
+ * Hierarchical timing wheel holding the pending core timing events.
+ *
+ * Time is split into ticks of 2^ResolutionBits nanoseconds. Each level has 64 slots, a slot of
+ * level N spanning 64^N ticks. An event is placed in the level of the highest tick bit where it
+ * differs from the current tick, so inserting and removing an event is O(1). Events of the current
+ * tick live in a small binary heap which keeps exact (time, insertion order) ordering.
+ *
+ * The wheel only moves forward when the earliest event is requested, cascading a single slot of
+ * the lowest occupied level at a time. Events beyond the last level go to an overflow list.
+ *
+ * Not thread-safe, CoreTiming guards it with its own lock.
+ */
+class TimingWheel {
+public:
+    struct Event {
+        s64 time;
+        u64 fifo_order;
+        std::weak_ptr<EventType> type;
+        s64 reschedule_time;
+    };
+
+    using Handle = u32;
+
+    static constexpr u32 ResolutionBits = 10;
+    static constexpr u32 SlotBits = 6;
+    static constexpr u32 NumSlots = 1U << SlotBits;
+    static constexpr u32 NumLevels = 6;
+
+    TimingWheel();
+
+    /// Adds an event of the given type. `type_key` is used to find the event again in RemoveType.
+    Handle Insert(Event&& event, const EventType* type_key);
+
+    /// Adds back an event that was returned from PopDue with a new time.
+    void Reinsert(Handle handle, s64 time, u64 fifo_order, s64 reschedule_time);
+
+    /// Removes every event that was inserted with the given type key.
+    void RemoveType(const EventType* type_key);
+
+    /// Removes the earliest event if it is due at `now`, its storage stays valid until Free.
+    [[nodiscard]] std::optional<Handle> PopDue(s64 now);
+
+    /// Releases the storage of an event returned from PopDue.
+    void Free(Handle handle);
+
+    [[nodiscard]] const Event& Get(Handle handle) const {
+        return nodes[handle].event;
+    }
+
+    /// Returns the time of the earliest event.
+    [[nodiscard]] std::optional<s64> NextTime();
+
+    [[nodiscard]] bool Empty() const noexcept {
+        return num_events == 0;
+    }
+
+    [[nodiscard]] size_t Size() const noexcept {
+        return num_events;
+    }
+
+    void Clear();
+
+private:
+    static constexpr u32 Invalid = std::numeric_limits<u32>::max();
+    static constexpr u16 LocationReady = NumLevels * NumSlots;
+    static constexpr u16 LocationOverflow = LocationReady + 1;
+    static constexpr u16 LocationDetached = LocationReady + 2;
+
+    struct Node {
+        Event event;
+        const EventType* type_key;
+        /// Links of the slot list, or the index in the ready heap.
+        u32 prev;
+        u32 next;
+        /// Links of the list of events sharing the same type.
+        u32 type_prev;
+        u32 type_next;
+        u16 location;
+    };
+
+    Handle Allocate();
+    void Place(Handle handle);
+    void Unplace(Handle handle);
+    void LinkType(Handle handle);
+    void UnlinkType(Handle handle);
+
+    void PushList(u32& head, Handle handle);
+    void UnlinkList(u32& head, Handle handle);
+
+    /// Moves the wheel forward until the ready heap holds the earliest event.
+    bool FillReady();
+    void CascadeList(u32 head);
+
+    bool ReadyLess(Handle lhs, Handle rhs) const;
+    void ReadyPush(Handle handle);
+    void ReadyRemove(u32 index);
+    void ReadySiftUp(u32 index);
+    void ReadySiftDown(u32 index);
+
+    static u64 ToTick(s64 time) {
+        return static_cast<u64>(time < 0 ? 0 : time) >> ResolutionBits;
+    }
+
+    std::vector<Node> nodes;
+    std::vector<Handle> free_nodes;
+
+    std::array<std::array<u32, NumSlots>, NumLevels> slots{};
+    std::array<u64, NumLevels> occupied{};
+    u32 overflow = Invalid;
+    std::vector<Handle> ready;
+
+    std::unordered_map<const EventType*, Handle> type_heads;
+
+    /// Every event outside the ready heap is due after this tick.
+    u64 current_tick = 0;
+    size_t num_events = 0;
+};
+
+} // namespace Core::Timing
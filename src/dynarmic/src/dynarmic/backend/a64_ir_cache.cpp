@@ -0,0 +1,158 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "dynarmic/backend/a64_ir_cache.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+#include <optional>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "dynarmic/frontend/A64/a64_location_descriptor.h"
+#include "dynarmic/interface/A64/config.h"
+#include "dynarmic/ir/basic_block.h"
+#include "dynarmic/ir/opcodes.h"
+#include "dynarmic/ir/serialization.h"
+#include "dynarmic/ir/terminal.h"
+
+namespace Dynarmic::Backend {
+
+/// Bump this when the meaning of serialized IR changes in a way OpcodeCount does not capture.
+constexpr u64 entry_format_version = 1;
+
+/// Entries covering more guest code than this are neither stored nor trusted.
+constexpr u64 max_code_size = 64 * 1024;
+
+struct EntryHeader {
+    u64 fingerprint;
+    u64 code_start;
+    u64 code_size;
+    u64 code_hash;
+};
+static_assert(std::is_trivially_copyable_v<EntryHeader>);
+
+static u64 Mix(u64 hash, u64 value) {
+    hash ^= value * 0x9E3779B97F4A7C15ULL;
+    return std::rotl(hash, 27) * 0xFF51AFD7ED558CCDULL;
+}
+
+static u64 Fingerprint(const A64::UserConfig& conf, const Optimization::PolyfillOptions& polyfill_options) {
+    const std::array<u64, 12> inputs{
+        entry_format_version,
+        u64(IR::OpcodeCount),
+        u64(conf.optimizations),
+        u64(conf.unsafe_optimizations),
+        u64(conf.define_unpredictable_behaviour),
+        u64(conf.wall_clock_cntpct),
+        u64(conf.hook_hint_instructions),
+        u64(conf.check_halt_on_memory_access),
+        u64(conf.hook_data_cache_operations),
+        u64(conf.dczid_el0),
+        u64(polyfill_options.sha256),
+        u64(polyfill_options.vector_multiply_widen),
+    };
+    u64 hash = 0;
+    for (const u64 input : inputs) {
+        hash = Mix(hash, input);
+    }
+    return hash;
+}
+
+/// Hashes the guest instructions in [start, start + size).
+/// Returns std::nullopt if any of them cannot be read.
+static std::optional<u64> HashCode(A64::UserCallbacks* cb, u64 start, u64 size) {
+    u64 hash = Mix(0, size);
+    for (u64 offset = 0; offset < size; offset += 4) {
+        const auto instruction = cb->MemoryReadCode(start + offset);
+        if (!instruction) {
+            return std::nullopt;
+        }
+        hash = Mix(hash, *instruction);
+    }
+    return hash ^ (hash >> 33);
+}
+
+/// A64MergeInterpretBlocksPass folds the instructions that follow a block into its Interpret
+/// terminal after checking that they are all interpreted, so they are part of what was translated.
+static void ExtendToInterpretedCode(const IR::Terminal& terminal, u64& code_end) {
+    if (const auto* term = boost::get<IR::Term::Interpret>(&terminal)) {
+        const u64 next_pc = A64::LocationDescriptor{term->next}.PC();
+        code_end = std::max(code_end, next_pc + 4 * u64(term->num_instructions));
+    } else if (const auto* term = boost::get<IR::Term::If>(&terminal)) {
+        ExtendToInterpretedCode(term->then_, code_end);
+        ExtendToInterpretedCode(term->else_, code_end);
+    } else if (const auto* term = boost::get<IR::Term::CheckBit>(&terminal)) {
+        ExtendToInterpretedCode(term->then_, code_end);
+        ExtendToInterpretedCode(term->else_, code_end);
+    } else if (const auto* term = boost::get<IR::Term::CheckHalt>(&terminal)) {
+        ExtendToInterpretedCode(term->else_, code_end);
+    }
+}
+
+A64IRCache::A64IRCache(const A64::UserConfig& conf, const Optimization::PolyfillOptions& polyfill_options)
+        : cache(conf.translation_cache)
+        , callbacks(conf.callbacks)
+        , fingerprint(Fingerprint(conf, polyfill_options)) {}
+
+bool A64IRCache::Load(IR::Block& block) const {
+    if (!cache) {
+        return false;
+    }
+
+    std::vector<u8> data;
+    if (!cache->Load(block.Location().Value(), data) || data.size() < sizeof(EntryHeader)) {
+        return false;
+    }
+
+    EntryHeader header;
+    std::memcpy(&header, data.data(), sizeof(header));
+    if (header.fingerprint != fingerprint || header.code_start != A64::LocationDescriptor{block.Location()}.PC()) {
+        return false;
+    }
+    if (header.code_size == 0 || header.code_size > max_code_size || header.code_size % 4 != 0) {
+        return false;
+    }
+    if (HashCode(callbacks, header.code_start, header.code_size) != header.code_hash) {
+        return false;
+    }
+
+    return IR::DeserializeBlock(block, std::span<const u8>{data}.subspan(sizeof(EntryHeader)));
+}
+
+void A64IRCache::Store(const IR::Block& block) const {
+    if (!cache) {
+        return;
+    }
+
+    const u64 code_start = A64::LocationDescriptor{block.Location()}.PC();
+    u64 code_end = A64::LocationDescriptor{block.EndLocation()}.PC();
+    ExtendToInterpretedCode(block.GetTerminal(), code_end);
+    if (code_end <= code_start || code_end - code_start > max_code_size) {
+        return;
+    }
+
+    const u64 code_size = code_end - code_start;
+    const auto code_hash = HashCode(callbacks, code_start, code_size);
+    if (!code_hash) {
+        return;
+    }
+
+    const EntryHeader header{
+        .fingerprint = fingerprint,
+        .code_start = code_start,
+        .code_size = code_size,
+        .code_hash = *code_hash,
+    };
+    std::vector<u8> data(sizeof(header));
+    std::memcpy(data.data(), &header, sizeof(header));
+    if (!IR::SerializeBlock(block, data)) {
+        return;
+    }
+    cache->Store(block.Location().Value(), data);
+}
+
+}  // namespace Dynarmic::Backend
@@ -0,0 +1,42 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include "dynarmic/common/common_types.h"
+#include "dynarmic/ir/opt_passes.h"
+
+namespace Dynarmic::A64 {
+class TranslationCache;
+struct UserCallbacks;
+struct UserConfig;
+}  // namespace Dynarmic::A64
+
+namespace Dynarmic::IR {
+class Block;
+}  // namespace Dynarmic::IR
+
+namespace Dynarmic::Backend {
+
+/// Saves optimized A64 IR to the user's A64::TranslationCache and hands it back on later
+/// lookups, provided the guest code the block was translated from has not changed.
+/// Entries also record a fingerprint of every setting that affects translation and
+/// optimization, so entries made under a different configuration are ignored.
+class A64IRCache {
+public:
+    A64IRCache(const A64::UserConfig& conf, const Optimization::PolyfillOptions& polyfill_options);
+
+    /// Fills block, which must be freshly constructed at the location to look up, from the
+    /// cache. Returns false if there is no usable entry, leaving block untouched.
+    bool Load(IR::Block& block) const;
+
+    /// Saves a translated and optimized block.
+    void Store(const IR::Block& block) const;
+
+private:
+    A64::TranslationCache* cache;
+    A64::UserCallbacks* callbacks;
+    u64 fingerprint;
+};
+
+}  // namespace Dynarmic::Backend
@@ -0,0 +1,198 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "dynarmic/backend/a64_speculative_translator.h"
+
+#include <algorithm>
+#include <memory>
+
+#include "dynarmic/common/assert.h"
+#include "dynarmic/frontend/A64/a64_location_descriptor.h"
+#include "dynarmic/frontend/A64/translate/a64_translate.h"
+#include "dynarmic/ir/basic_block.h"
+#include "dynarmic/ir/serialization.h"
+#include "dynarmic/ir/terminal.h"
+
+namespace Dynarmic::Backend {
+
+/// Requests beyond this many drop the oldest one, which is the least likely to still be ahead of execution.
+constexpr size_t max_pending_requests = 64;
+
+static void CollectSuccessors(const IR::Terminal& terminal, std::vector<IR::LocationDescriptor>& successors) {
+    if (const auto* term = boost::get<IR::Term::LinkBlock>(&terminal)) {
+        successors.push_back(term->next);
+    } else if (const auto* term = boost::get<IR::Term::LinkBlockFast>(&terminal)) {
+        successors.push_back(term->next);
+    } else if (const auto* term = boost::get<IR::Term::If>(&terminal)) {
+        CollectSuccessors(term->then_, successors);
+        CollectSuccessors(term->else_, successors);
+    } else if (const auto* term = boost::get<IR::Term::CheckBit>(&terminal)) {
+        CollectSuccessors(term->then_, successors);
+        CollectSuccessors(term->else_, successors);
+    } else if (const auto* term = boost::get<IR::Term::CheckHalt>(&terminal)) {
+        CollectSuccessors(term->else_, successors);
+    }
+}
+
+/// Translation and optimization only read code, which comes from MemoryReadCodeSpeculative.
+/// Remembers whether any of it could not be read, since the translation is then not the one the
+/// thread running the JIT would make.
+class A64SpeculativeTranslator::CodeReader final : public A64::UserCallbacks {
+public:
+    explicit CodeReader(A64::UserCallbacks* user_callbacks)
+            : user_callbacks(user_callbacks) {}
+
+    std::optional<std::uint32_t> MemoryReadCode(A64::VAddr vaddr) override {
+        const auto instruction = user_callbacks->MemoryReadCodeSpeculative(vaddr);
+        failed |= !instruction.has_value();
+        return instruction;
+    }
+
+    std::uint8_t MemoryRead8(A64::VAddr) override { UNREACHABLE(); }
+    std::uint16_t MemoryRead16(A64::VAddr) override { UNREACHABLE(); }
+    std::uint32_t MemoryRead32(A64::VAddr) override { UNREACHABLE(); }
+    std::uint64_t MemoryRead64(A64::VAddr) override { UNREACHABLE(); }
+    A64::Vector MemoryRead128(A64::VAddr) override { UNREACHABLE(); }
+    void MemoryWrite8(A64::VAddr, std::uint8_t) override { UNREACHABLE(); }
+    void MemoryWrite16(A64::VAddr, std::uint16_t) override { UNREACHABLE(); }
+    void MemoryWrite32(A64::VAddr, std::uint32_t) override { UNREACHABLE(); }
+    void MemoryWrite64(A64::VAddr, std::uint64_t) override { UNREACHABLE(); }
+    void MemoryWrite128(A64::VAddr, A64::Vector) override { UNREACHABLE(); }
+    void InterpreterFallback(A64::VAddr, size_t) override { UNREACHABLE(); }
+    void CallSVC(std::uint32_t) override { UNREACHABLE(); }
+    void ExceptionRaised(A64::VAddr, A64::Exception) override { UNREACHABLE(); }
+    void AddTicks(std::uint64_t) override { UNREACHABLE(); }
+    std::uint64_t GetTicksRemaining() override { UNREACHABLE(); }
+    std::uint64_t GetCNTPCT() override { UNREACHABLE(); }
+
+    bool failed = false;
+
+private:
+    A64::UserCallbacks* const user_callbacks;
+};
+
+static A64::UserConfig WithCallbacks(A64::UserConfig conf, A64::UserCallbacks* callbacks) {
+    conf.callbacks = callbacks;
+    return conf;
+}
+
+A64SpeculativeTranslator::A64SpeculativeTranslator(const A64::UserConfig& conf, const Optimization::PolyfillOptions& polyfill_options)
+        : code_reader(std::make_unique<CodeReader>(conf.callbacks))
+        , conf(WithCallbacks(conf, code_reader.get()))
+        , polyfill_options(polyfill_options)
+        , ir_cache(this->conf, polyfill_options)
+        , thread(&A64SpeculativeTranslator::ThreadMain, this) {}
+
+A64SpeculativeTranslator::~A64SpeculativeTranslator() {
+    {
+        std::lock_guard lock{mutex};
+        stop_requested = true;
+    }
+    request_cv.notify_one();
+    thread.join();
+
+    for (auto& slot : slots) {
+        delete slot.load(std::memory_order_acquire);
+    }
+}
+
+void A64SpeculativeTranslator::RequestSuccessors(const IR::Block& block, const std::function<bool(IR::LocationDescriptor)>& is_emitted) {
+    if (A64::LocationDescriptor{block.Location()}.SingleStepping()) {
+        return;
+    }
+
+    std::vector<IR::LocationDescriptor> successors;
+    CollectSuccessors(block.GetTerminal(), successors);
+    for (const auto successor : successors) {
+        if (!is_emitted(successor)) {
+            Request(successor);
+        }
+    }
+}
+
+bool A64SpeculativeTranslator::Take(IR::Block& block) {
+    auto& slot = SlotFor(block.Location());
+    std::unique_ptr<Result> result{slot.exchange(nullptr, std::memory_order_acq_rel)};
+    if (!result) {
+        return false;
+    }
+    if (result->location != block.Location()) {
+        // The translation is for another location that maps to the same slot. Put it back,
+        // unless the compile thread has published a newer one in the meantime.
+        Result* expected = nullptr;
+        if (slot.compare_exchange_strong(expected, result.get(), std::memory_order_acq_rel)) {
+            result.release();
+        }
+        return false;
+    }
+    // epoch is only ever changed by this thread.
+    return result->epoch == epoch && IR::DeserializeBlock(block, result->data);
+}
+
+void A64SpeculativeTranslator::Invalidate() {
+    std::lock_guard lock{mutex};
+    requests.clear();
+    epoch++;
+}
+
+void A64SpeculativeTranslator::Request(IR::LocationDescriptor location) {
+    {
+        std::lock_guard lock{mutex};
+        if (std::find(requests.begin(), requests.end(), location) != requests.end()) {
+            return;
+        }
+        if (requests.size() >= max_pending_requests) {
+            requests.pop_front();
+        }
+        requests.push_back(location);
+    }
+    request_cv.notify_one();
+}
+
+void A64SpeculativeTranslator::ThreadMain() {
+    std::unique_lock lock{mutex};
+    while (true) {
+        request_cv.wait(lock, [this] { return stop_requested || !requests.empty(); });
+        if (stop_requested) {
+            return;
+        }
+        const IR::LocationDescriptor location = requests.front();
+        requests.pop_front();
+        const u64 request_epoch = epoch;
+
+        lock.unlock();
+        TranslateAhead(location, request_epoch);
+        lock.lock();
+    }
+}
+
+void A64SpeculativeTranslator::TranslateAhead(IR::LocationDescriptor location, u64 request_epoch) {
+    // Guest code read here may change before the translation is taken. Invalidation moves to a
+    // new epoch, so translations requested before it are never used.
+    IR::Block block{location};
+    if (!ir_cache.Load(block)) {
+        code_reader->failed = false;
+        const auto get_code = [this](u64 vaddr) { return conf.callbacks->MemoryReadCode(vaddr); };
+        A64::Translate(block, A64::LocationDescriptor{location}, get_code, {conf.define_unpredictable_behaviour, conf.wall_clock_cntpct});
+        Optimization::Optimize(block, conf, polyfill_options);
+        if (code_reader->failed) {
+            // Left for the thread running the JIT, which can read all of the code.
+            return;
+        }
+        ir_cache.Store(block);
+    }
+
+    // Instructions may live inside the block object itself, so blocks cannot be moved and are
+    // handed over serialized instead.
+    auto result = std::make_unique<Result>(Result{location, request_epoch, {}});
+    if (!IR::SerializeBlock(block, result->data)) {
+        return;
+    }
+    delete SlotFor(location).exchange(result.release(), std::memory_order_acq_rel);
+}
+
+std::atomic<A64SpeculativeTranslator::Result*>& A64SpeculativeTranslator::SlotFor(IR::LocationDescriptor location) {
+    return slots[(location.Value() * 0x9E3779B97F4A7C15ULL) >> 56];
+}
+
+}  // namespace Dynarmic::Backend
@@ -0,0 +1,88 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "dynarmic/backend/a64_ir_cache.h"
+#include "dynarmic/common/common_types.h"
+#include "dynarmic/interface/A64/config.h"
+#include "dynarmic/ir/location_descriptor.h"
+#include "dynarmic/ir/opt_passes.h"
+
+namespace Dynarmic::IR {
+class Block;
+}  // namespace Dynarmic::IR
+
+namespace Dynarmic::Backend {
+
+/// Translates and optimizes A64 blocks on a thread of its own before they first run, so that
+/// the thread running the JIT only has to emit them. Newly emitted blocks request the blocks
+/// they branch to directly. Finished translations are handed over through a table of atomic
+/// pointers, so picking one up never waits on the compile thread.
+/// The member functions may only be called by the thread running the JIT. The compile thread
+/// reads guest code only through UserCallbacks::MemoryReadCodeSpeculative.
+class A64SpeculativeTranslator {
+public:
+    /// The callbacks in conf must outlive the translator.
+    A64SpeculativeTranslator(const A64::UserConfig& conf, const Optimization::PolyfillOptions& polyfill_options);
+    ~A64SpeculativeTranslator();
+
+    A64SpeculativeTranslator(const A64SpeculativeTranslator&) = delete;
+    A64SpeculativeTranslator& operator=(const A64SpeculativeTranslator&) = delete;
+
+    /// Queues the direct successors of a newly emitted block for translation, skipping those
+    /// for which is_emitted returns true.
+    void RequestSuccessors(const IR::Block& block, const std::function<bool(IR::LocationDescriptor)>& is_emitted);
+
+    /// Fills block, which must be freshly constructed at the location to look up, with a
+    /// translation made ahead of time. Returns false if there is none, leaving block untouched.
+    bool Take(IR::Block& block);
+
+    /// Drops queued requests and every translation made so far, for when guest code may have changed.
+    void Invalidate();
+
+private:
+    class CodeReader;
+
+    struct Result {
+        IR::LocationDescriptor location;
+        u64 epoch;
+        std::vector<u8> data;
+    };
+
+    void Request(IR::LocationDescriptor location);
+    void ThreadMain();
+    void TranslateAhead(IR::LocationDescriptor location, u64 request_epoch);
+    std::atomic<Result*>& SlotFor(IR::LocationDescriptor location);
+
+    /// Takes the place of the user's callbacks in conf, so that the compile thread calls nothing else.
+    const std::unique_ptr<CodeReader> code_reader;
+    const A64::UserConfig conf;
+    const Optimization::PolyfillOptions polyfill_options;
+    const A64IRCache ir_cache;
+
+    /// Each slot holds the latest translation for one of the locations that map to it.
+    /// Whoever exchanges a result out of a slot owns it.
+    std::array<std::atomic<Result*>, 256> slots{};
+
+    std::mutex mutex;
+    std::condition_variable request_cv;
+    std::deque<IR::LocationDescriptor> requests;
+    /// Translations made for an earlier epoch are stale. Only changed under mutex.
+    u64 epoch = 0;
+    bool stop_requested = false;
+
+    std::thread thread;
+};
+
+}  // namespace Dynarmic::Backend
@@ -164,7 +164,7 @@ A32AddressSpace::A32AddressSpace(const A32::UserConfig& conf)
     EmitPrelude();
 }
 
-IR::Block A32AddressSpace::GenerateIR(IR::LocationDescriptor descriptor) const {
+IR::Block A32AddressSpace::GenerateIR(IR::LocationDescriptor descriptor) {
     IR::Block ir_block = A32::Translate(A32::LocationDescriptor{descriptor}, conf.callbacks, {conf.arch_version, conf.define_unpredictable_behaviour, conf.hook_hint_instructions});
     Optimization::Optimize(ir_block, conf, {});
     return ir_block;
@@ -307,12 +307,15 @@ void A32AddressSpace::EmitPrelude() {
 
         code.LDR(X0, l_this);
         code.MOV(X1, Xstate);
+        code.MOV(X2, SP);
         code.LDR(Xscratch0, l_addr);
         code.BLR(Xscratch0);
         code.BR(X0);
 
-        const auto fn = [](A32AddressSpace& self, A32JitState& context) -> CodePtr {
-            return self.GetOrEmit(context.GetLocationDescriptor());
+        const auto fn = [](A32AddressSpace& self, A32JitState& context, StackLayout& stack_layout) -> CodePtr {
+            const CodePtr entry_point = self.GetOrEmit(context.GetLocationDescriptor());
+            self.ResetStaleRSB(stack_layout);
+            return entry_point;
         };
 
         code.align(8);
@@ -350,6 +353,7 @@ void A32AddressSpace::EmitPrelude() {
     code.dx(std::bit_cast<u64>(prelude_info.return_to_dispatcher));
 
     prelude_info.end_of_prelude = code.offset();
+    regions = CodeCacheRegions{prelude_info.end_of_prelude, code_cache_size};
 
     mem.invalidate_all();
     ProtectCodeMemory();
@@ -357,7 +361,7 @@ void A32AddressSpace::EmitPrelude() {
 
 EmitConfig A32AddressSpace::GetEmitConfig() {
     return EmitConfig{
-        .optimizations = conf.unsafe_optimizations ? conf.optimizations : conf.optimizations & all_safe_optimizations,
+        .optimizations = conf.unsafe_optimizations ? conf.optimizations : conf.optimizations & (all_safe_optimizations | all_opt_in_optimizations),
 
         .hook_isb = conf.hook_isb,
 
@@ -125,6 +125,10 @@ struct Jit::Impl final {
         current_state.exclusive_state = false;
     }
 
+    CodeCacheStatistics GetCodeCacheStatistics() const {
+        return current_address_space.GetCodeCacheStatistics();
+    }
+
     std::string Disassemble() const {
         return {};
     }
@@ -235,6 +239,10 @@ void Jit::ClearExclusiveState() {
     impl->ClearExclusiveState();
 }
 
+CodeCacheStatistics Jit::GetCodeCacheStatistics() const {
+    return impl->GetCodeCacheStatistics();
+}
+
 std::string Jit::Disassemble() const {
     return impl->Disassemble();
 }
@@ -326,22 +326,73 @@ static void* EmitExclusiveWrite128CallTrampoline(oaknut::CodeGenerator& code, co
 
 A64AddressSpace::A64AddressSpace(const A64::UserConfig& conf)
         : AddressSpace(conf.code_cache_size)
-        , conf(conf) {
+        , conf(conf)
+        , ir_cache(conf, {}) {
+    const bool tiered = conf.HasOptimization(OptimizationFlag::TieredCompilation);
+    const bool traces = conf.HasOptimization(OptimizationFlag::TraceFormation);
+    if (tiered || traces) {
+        block_profiler.emplace(tiered ? std::optional{conf.tier_up_threshold} : std::nullopt,
+                               traces ? std::optional{conf.trace_threshold} : std::nullopt);
+    }
+    if (conf.speculative_compilation) {
+        speculative_translator.emplace(this->conf, Optimization::PolyfillOptions{});
+    }
     EmitPrelude();
 }
 
-IR::Block A64AddressSpace::GenerateIR(IR::LocationDescriptor descriptor) const {
-    const auto get_code = [this](u64 vaddr) { return conf.callbacks->MemoryReadCode(vaddr); };
-    IR::Block ir_block = A64::Translate(A64::LocationDescriptor{descriptor}, get_code,
-                                        {conf.define_unpredictable_behaviour, conf.wall_clock_cntpct});
-    Optimization::Optimize(ir_block, conf, {});
+IR::Block A64AddressSpace::GenerateIR(IR::LocationDescriptor descriptor) {
+    IR::Block ir_block{descriptor};
+    const auto tier = block_profiler ? block_profiler->GetTier(descriptor) : BlockTier::Optimized;
+    if (tier != BlockTier::Trace && ((speculative_translator && speculative_translator->Take(ir_block)) || ir_cache.Load(ir_block))) {
+        if (tier == BlockTier::Baseline) {
+            // Cached and speculatively translated IR is fully optimized already.
+            block_profiler->SkipBaseline(descriptor);
+        }
+    } else {
+        const auto get_code = [this](u64 vaddr) { return conf.callbacks->MemoryReadCode(vaddr); };
+        A64::TranslationOptions options{conf.define_unpredictable_behaviour, conf.wall_clock_cntpct};
+        if (tier == BlockTier::Trace) {
+            options.trace_successor = [this](A64::LocationDescriptor a, A64::LocationDescriptor b) -> std::optional<A64::LocationDescriptor> {
+                if (const auto next = block_profiler->HotterSuccessor(a, b)) {
+                    return A64::LocationDescriptor{*next};
+                }
+                return std::nullopt;
+            };
+        }
+        A64::Translate(ir_block, A64::LocationDescriptor{descriptor}, get_code, std::move(options));
+        if (tier == BlockTier::Baseline) {
+            Optimization::OptimizeBaseline(ir_block, conf, {});
+        } else {
+            Optimization::Optimize(ir_block, conf, {});
+            ir_cache.Store(ir_block);
+        }
+    }
+    if (block_profiler && !A64::LocationDescriptor{descriptor}.SingleStepping()) {
+        if (s32* const counter = block_profiler->GetCounter(descriptor)) {
+            ir_block.PrependNewInst(ir_block.begin(), IR::Opcode::A64CountBlockExecution,
+                                    {IR::Value{std::bit_cast<u64>(counter)},
+                                     IR::Value{std::bit_cast<u64>(block_profiler->GetExpiredFlag())}});
+        }
+    }
     return ir_block;
 }
 
+bool A64AddressSpace::WantsRetranslation(IR::LocationDescriptor descriptor) {
+    // Hot blocks move up a tier; the old code stays in place for anything still running it.
+    return block_profiler && block_profiler->TakeHotBlock(descriptor);
+}
+
 void A64AddressSpace::InvalidateCacheRanges(const boost::icl::interval_set<u64>& ranges) {
+    DiscardSpeculativeTranslations();
     InvalidateBasicBlocks(block_ranges.InvalidateRanges(ranges));
 }
 
+void A64AddressSpace::DiscardSpeculativeTranslations() {
+    if (speculative_translator) {
+        speculative_translator->Invalidate();
+    }
+}
+
 void A64AddressSpace::EmitPrelude() {
     using namespace oaknut::util;
 
@@ -482,12 +533,15 @@ void A64AddressSpace::EmitPrelude() {
 
         code.LDR(X0, l_this);
         code.MOV(X1, Xstate);
+        code.MOV(X2, SP);
         code.LDR(Xscratch0, l_addr);
         code.BLR(Xscratch0);
         code.BR(X0);
 
-        const auto fn = [](A64AddressSpace& self, A64JitState& context) -> CodePtr {
-            return self.GetOrEmit(context.GetLocationDescriptor());
+        const auto fn = [](A64AddressSpace& self, A64JitState& context, StackLayout& stack_layout) -> CodePtr {
+            const CodePtr entry_point = self.GetOrEmit(context.GetLocationDescriptor());
+            self.ResetStaleRSB(stack_layout);
+            return entry_point;
         };
 
         code.align(8);
@@ -525,6 +579,7 @@ void A64AddressSpace::EmitPrelude() {
     code.dx(std::bit_cast<u64>(prelude_info.return_to_dispatcher));
 
     prelude_info.end_of_prelude = code.offset();
+    regions = CodeCacheRegions{prelude_info.end_of_prelude, code_cache_size};
 
     mem.invalidate_all();
     ProtectCodeMemory();
@@ -532,7 +587,7 @@ void A64AddressSpace::EmitPrelude() {
 
 EmitConfig A64AddressSpace::GetEmitConfig() {
     return EmitConfig{
-        .optimizations = conf.unsafe_optimizations ? conf.optimizations : conf.optimizations & all_safe_optimizations,
+        .optimizations = conf.unsafe_optimizations ? conf.optimizations : conf.optimizations & (all_safe_optimizations | all_opt_in_optimizations),
 
         .hook_isb = conf.hook_isb,
 
@@ -583,6 +638,12 @@ void A64AddressSpace::RegisterNewBasicBlock(const IR::Block& block, const Emitte
     const A64::LocationDescriptor end_location{block.EndLocation()};
     const auto range = boost::icl::discrete_interval<u64>::closed(descriptor.PC(), end_location.PC() - 1);
     block_ranges.AddRange(range, descriptor);
+
+    if (speculative_translator) {
+        speculative_translator->RequestSuccessors(block, [this](IR::LocationDescriptor location) {
+            return block_entries.contains(location);
+        });
+    }
 }
 
 }  // namespace Dynarmic::Backend::Arm64
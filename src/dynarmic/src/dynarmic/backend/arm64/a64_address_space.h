@@ -5,7 +5,10 @@
 
 #pragma once
 
+#include "dynarmic/backend/a64_ir_cache.h"
+#include "dynarmic/backend/a64_speculative_translator.h"
 #include "dynarmic/backend/arm64/address_space.h"
+#include "dynarmic/backend/block_profiler.h"
 #include "dynarmic/backend/block_range_information.h"
 #include "dynarmic/interface/A64/config.h"
 
@@ -17,19 +20,24 @@ class A64AddressSpace final : public AddressSpace {
 public:
     explicit A64AddressSpace(const A64::UserConfig& conf);
 
-    IR::Block GenerateIR(IR::LocationDescriptor) const override;
+    IR::Block GenerateIR(IR::LocationDescriptor) override;
 
     void InvalidateCacheRanges(const boost::icl::interval_set<u64>& ranges);
+    void DiscardSpeculativeTranslations();
 
 protected:
     friend class A64Core;
 
     void EmitPrelude();
+    bool WantsRetranslation(IR::LocationDescriptor descriptor) override;
     EmitConfig GetEmitConfig() override;
     void RegisterNewBasicBlock(const IR::Block& block, const EmittedBlockInfo& block_info) override;
 
     const A64::UserConfig conf;
+    A64IRCache ir_cache;
+    std::optional<BlockProfiler> block_profiler;
     BlockRangeInformation<u64> block_ranges;
+    std::optional<A64SpeculativeTranslator> speculative_translator;
 };
 
 }  // namespace Dynarmic::Backend::Arm64
@@ -151,6 +151,10 @@ struct Jit::Impl final {
         return is_executing;
     }
 
+    CodeCacheStatistics GetCodeCacheStatistics() const {
+        return current_address_space.GetCodeCacheStatistics();
+    }
+
     std::string Disassemble() const {
         return {};
     }
@@ -164,6 +168,7 @@ private:
 
             if (invalidate_entire_cache) {
                 current_address_space.ClearCache();
+                current_address_space.DiscardSpeculativeTranslations();
 
                 invalidate_entire_cache = false;
                 invalid_cache_ranges.clear();
@@ -311,6 +316,10 @@ bool Jit::IsExecuting() const {
     return impl->IsExecuting();
 }
 
+CodeCacheStatistics Jit::GetCodeCacheStatistics() const {
+    return impl->GetCodeCacheStatistics();
+}
+
 std::string Jit::Disassemble() const {
     return impl->Disassemble();
 }
@@ -6,6 +6,7 @@
  * SPDX-License-Identifier: 0BSD
  */
 
+#include <chrono>
 #include <cstdio>
 
 #include <bit>
@@ -65,11 +66,21 @@ CodePtr AddressSpace::ReverseGetEntryPoint(CodePtr host_pc) {
 
 CodePtr AddressSpace::GetOrEmit(IR::LocationDescriptor descriptor) {
     if (CodePtr block_entry = Get(descriptor)) {
-        return block_entry;
+        if (!WantsRetranslation(descriptor)) {
+            regions.Touch(static_cast<size_t>(block_entry - reinterpret_cast<CodePtr>(mem.ptr())));
+            return block_entry;
+        }
+        InvalidateBasicBlocks({descriptor});
     }
 
+    const auto start_time = std::chrono::steady_clock::now();
     IR::Block ir_block = GenerateIR(descriptor);
+    const size_t instruction_count = ir_block.CycleCount();
     const EmittedBlockInfo block_info = Emit(std::move(ir_block));
+    code_cache_statistics.compiled_blocks++;
+    code_cache_statistics.compiled_instructions += instruction_count;
+    code_cache_statistics.emitted_bytes += block_info.size;
+    code_cache_statistics.compile_time += std::chrono::steady_clock::now() - start_time;
     return block_info.entry_point;
 }
 
@@ -93,20 +104,86 @@ void AddressSpace::InvalidateBasicBlocks(const ankerl::unordered_dense::set<IR::
 }
 
 void AddressSpace::ClearCache() {
+    const auto start_time = std::chrono::steady_clock::now();
     block_entries.clear();
     reverse_block_entries.clear();
     block_infos.clear();
     block_references.clear();
+    regions.Reset();
     code.set_offset(prelude_info.end_of_prelude);
+    rsb_is_stale = true;
+    code_cache_statistics.full_clears++;
+    code_cache_statistics.eviction_time += std::chrono::steady_clock::now() - start_time;
 }
 
 size_t AddressSpace::GetRemainingSize() {
-    return code_cache_size - static_cast<size_t>(code.offset());
+    const size_t offset = static_cast<size_t>(code.offset());
+    const size_t region_end = regions.CurrentEnd();
+    return offset < region_end ? region_end - offset : 0;
+}
+
+void AddressSpace::EvictCodeRegion() {
+    const auto region = regions.Advance();
+    code.set_offset(region.begin);
+    if (!region.has_code) {
+        return;
+    }
+
+    const auto start_time = std::chrono::steady_clock::now();
+    const CodePtr begin = reinterpret_cast<CodePtr>(mem.ptr()) + region.begin;
+    const CodePtr end = reinterpret_cast<CodePtr>(mem.ptr()) + region.end;
+
+    // Links from code in the region must not be relinked once the region is reused.
+    for (auto& [target, references] : block_references) {
+        for (auto iter = references.begin(); iter != references.end();) {
+            if (*iter >= begin && *iter < end) {
+                iter = references.erase(iter);
+            } else {
+                ++iter;
+            }
+        }
+    }
+
+    UnprotectCodeMemory();
+
+    // This also covers code that has been invalidated earlier but was left in place.
+    const auto first = reverse_block_entries.lower_bound(begin);
+    const auto last = reverse_block_entries.lower_bound(end);
+    for (auto iter = first; iter != last; ++iter) {
+        const auto& [entry_point, descriptor] = *iter;
+        if (const auto entry = block_entries.find(descriptor); entry != block_entries.end() && entry->second == entry_point) {
+            RelinkForDescriptor(descriptor, nullptr);
+            block_entries.erase(entry);
+            code_cache_statistics.evicted_blocks++;
+        }
+        block_infos.erase(entry_point);
+    }
+    reverse_block_entries.erase(first, last);
+
+    ProtectCodeMemory();
+
+    rsb_is_stale = true;
+    code_cache_statistics.region_evictions++;
+    code_cache_statistics.eviction_time += std::chrono::steady_clock::now() - start_time;
+}
+
+void AddressSpace::ResetStaleRSB(StackLayout& stack_layout) {
+    if (!rsb_is_stale) {
+        return;
+    }
+    rsb_is_stale = false;
+    for (RSBEntry& entry : stack_layout.rsb) {
+        entry.code_ptr = std::bit_cast<u64>(prelude_info.return_to_dispatcher);
+    }
 }
 
 EmittedBlockInfo AddressSpace::Emit(IR::Block block) {
     if (GetRemainingSize() < 1024 * 1024) {
-        ClearCache();
+        if (regions.CanEvict()) {
+            EvictCodeRegion();
+        } else {
+            ClearCache();
+        }
     }
 
     UnprotectCodeMemory();
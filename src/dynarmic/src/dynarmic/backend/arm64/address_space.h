@@ -18,6 +18,9 @@
 
 #include "dynarmic/backend/arm64/emit_arm64.h"
 #include "dynarmic/backend/arm64/fastmem.h"
+#include "dynarmic/backend/arm64/stack_layout.h"
+#include "dynarmic/backend/code_cache_regions.h"
+#include "dynarmic/interface/code_cache_statistics.h"
 #include "dynarmic/interface/halt_reason.h"
 #include "dynarmic/ir/basic_block.h"
 #include "dynarmic/ir/location_descriptor.h"
@@ -29,7 +32,7 @@ public:
     explicit AddressSpace(size_t code_cache_size);
     virtual ~AddressSpace();
 
-    virtual IR::Block GenerateIR(IR::LocationDescriptor) const = 0;
+    virtual IR::Block GenerateIR(IR::LocationDescriptor) = 0;
 
     CodePtr Get(IR::LocationDescriptor descriptor);
 
@@ -44,7 +47,14 @@ public:
     void InvalidateBasicBlocks(const ankerl::unordered_dense::set<IR::LocationDescriptor>& descriptors);
 
     void ClearCache();
+
+    CodeCacheStatistics GetCodeCacheStatistics() const {
+        return code_cache_statistics;
+    }
 protected:
+    /// Returns true if the existing block at descriptor should be replaced by a fresh translation.
+    virtual bool WantsRetranslation(IR::LocationDescriptor) { return false; }
+
     virtual EmitConfig GetEmitConfig() = 0;
     virtual void RegisterNewBasicBlock(const IR::Block& block, const EmittedBlockInfo& block_info) = 0;
 
@@ -61,6 +71,10 @@ protected:
     }
 
     size_t GetRemainingSize();
+    void EvictCodeRegion();
+    /// Called by the dispatcher after each lookup. Return stack buffer entries hold code pointers,
+    /// so they are reset once the code cache has dropped code.
+    void ResetStaleRSB(StackLayout& stack_layout);
     EmittedBlockInfo Emit(IR::Block ir_block);
     void Link(EmittedBlockInfo& block);
     void LinkBlockLinks(const CodePtr entry_point, const CodePtr target_ptr, const std::vector<BlockRelocation>& block_relocations_list);
@@ -79,6 +93,10 @@ protected:
     ankerl::unordered_dense::map<CodePtr, EmittedBlockInfo> block_infos;
     ankerl::unordered_dense::map<IR::LocationDescriptor, ankerl::unordered_dense::set<CodePtr>> block_references;
 
+    CodeCacheRegions regions;
+    CodeCacheStatistics code_cache_statistics;
+    bool rsb_is_stale = false;
+
     ExceptionHandler exception_handler;
     FastmemManager fastmem_manager;
 
@@ -149,6 +149,12 @@ void EmitA64ConditionFailedTerminal(oaknut::CodeGenerator& code, EmitContext& ct
     EmitA64Terminal(code, ctx, IR::Term::LinkBlock{ctx.block.ConditionFailedLocation()}, location.SetSingleStepping(false), location.SingleStepping());
 }
 
+static void EmitA64SideExit(oaknut::CodeGenerator& code, EmitContext& ctx, IR::LocationDescriptor target, size_t cycles) {
+    const A64::LocationDescriptor location{ctx.block.Location()};
+    EmitAddCycles(code, ctx, cycles);
+    EmitA64Terminal(code, ctx, IR::Term::LinkBlock{target}, location.SetSingleStepping(false), location.SingleStepping());
+}
+
 void EmitA64CheckMemoryAbort(oaknut::CodeGenerator& code, EmitContext& ctx, IR::Inst* inst, oaknut::Label& end) {
     if (!ctx.conf.check_halt_on_memory_access) {
         return;
@@ -381,6 +387,78 @@ void EmitIR<IR::Opcode::A64SetPC>(oaknut::CodeGenerator& code, EmitContext& ctx,
     code.STR(Xvalue, Xstate, offsetof(A64JitState, pc));
 }
 
+template<>
+void EmitIR<IR::Opcode::A64SideExitIf>(oaknut::CodeGenerator& code, EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    const IR::Cond cond = args[0].GetImmediateCond();
+    const IR::LocationDescriptor target{args[1].GetImmediateU64()};
+    const size_t cycles = args[2].GetImmediateU64();
+
+    // Guest state has to be complete on the way out.
+    ctx.fpsr.Spill();
+    ctx.reg_alloc.SpillFlags();
+
+    SharedLabel exit = GenSharedLabel();
+    code.LDR(Wscratch0, Xstate, offsetof(A64JitState, cpsr_nzcv));
+    code.MSR(oaknut::SystemReg::NZCV, Xscratch0);
+    code.B(static_cast<oaknut::Cond>(cond), *exit);
+
+    ctx.deferred_emits.emplace_back([&code, &ctx, exit, target, cycles] {
+        code.l(*exit);
+        EmitA64SideExit(code, ctx, target, cycles);
+    });
+}
+
+template<>
+void EmitIR<IR::Opcode::A64SideExitIfCheckBit>(oaknut::CodeGenerator& code, EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    const bool check_bit = args[0].GetImmediateU1();
+    const IR::LocationDescriptor target{args[1].GetImmediateU64()};
+    const size_t cycles = args[2].GetImmediateU64();
+
+    ctx.fpsr.Spill();
+
+    SharedLabel exit = GenSharedLabel();
+    code.LDRB(Wscratch0, SP, offsetof(StackLayout, check_bit));
+    if (check_bit) {
+        code.CBNZ(Wscratch0, *exit);
+    } else {
+        code.CBZ(Wscratch0, *exit);
+    }
+
+    ctx.deferred_emits.emplace_back([&code, &ctx, exit, target, cycles] {
+        code.l(*exit);
+        EmitA64SideExit(code, ctx, target, cycles);
+    });
+}
+
+template<>
+void EmitIR<IR::Opcode::A64CountBlockExecution>(oaknut::CodeGenerator& code, EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    const u64 counter = args[0].GetImmediateU64();
+    const u64 expired_flag = args[1].GetImmediateU64();
+    const u64 pc = A64::LocationDescriptor{ctx.block.Location()}.PC();
+
+    // The counter is signed and keeps going below zero until the block is replaced, so that the
+    // block keeps returning to the dispatcher if its first expiry is missed.
+    SharedLabel expired = GenSharedLabel();
+    code.MOV(Xscratch0, counter);
+    code.LDR(Wscratch1, Xscratch0);
+    code.SUBS(Wscratch1, Wscratch1, 1);
+    code.STR(Wscratch1, Xscratch0);
+    code.B(LE, *expired);
+
+    ctx.deferred_emits.emplace_back([&code, &ctx, expired, expired_flag, pc] {
+        code.l(*expired);
+        code.MOV(Xscratch0, expired_flag);
+        code.MOV(Wscratch1, 1);
+        code.STRB(Wscratch1, Xscratch0);
+        code.MOV(Xscratch0, pc);
+        code.STR(Xscratch0, Xstate, offsetof(A64JitState, pc));
+        EmitRelocation(code, ctx, LinkTarget::ReturnToDispatcher);
+    });
+}
+
 template<>
 void EmitIR<IR::Opcode::A64CallSupervisor>(oaknut::CodeGenerator& code, EmitContext& ctx, IR::Inst* inst) {
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
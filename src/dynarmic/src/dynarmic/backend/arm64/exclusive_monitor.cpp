@@ -8,54 +8,40 @@
 
 #include "dynarmic/interface/exclusive_monitor.h"
 
-#include <algorithm>
-
 #include "dynarmic/common/assert.h"
 
 namespace Dynarmic {
 
-ExclusiveMonitor::ExclusiveMonitor(std::size_t processor_count)
-        : exclusive_addresses(processor_count, INVALID_EXCLUSIVE_ADDRESS), exclusive_values(processor_count) {}
-
-size_t ExclusiveMonitor::GetProcessorCount() const {
-    return exclusive_addresses.size();
-}
-
-void ExclusiveMonitor::Lock() {
-    lock.Lock();
+ExclusiveMonitor::ExclusiveMonitor(size_t processor_count)
+        : processor_count(processor_count) {
+    ASSERT(processor_count <= MAX_NUM_CPU_CORES);
 }
 
-void ExclusiveMonitor::Unlock() {
-    lock.Unlock();
+size_t ExclusiveMonitor::GetProcessorCount() const {
+    return processor_count;
 }
 
 bool ExclusiveMonitor::CheckAndClear(size_t processor_id, VAddr address) {
     const VAddr masked_address = address & RESERVATION_GRANULE_MASK;
+    Reservation& reservation = reservations[processor_id];
 
-    Lock();
-    if (exclusive_addresses[processor_id] != masked_address) {
-        Unlock();
+    if (reservation.address.exchange(INVALID_EXCLUSIVE_ADDRESS, std::memory_order_acq_rel) != masked_address) {
         return false;
     }
 
-    for (VAddr& other_address : exclusive_addresses) {
-        if (other_address == masked_address) {
-            other_address = INVALID_EXCLUSIVE_ADDRESS;
-        }
-    }
-    return true;
+    // Fails if another processor has committed a store to the granule since the value was read.
+    std::uint64_t expected = reservation.version;
+    return VersionOf(masked_address).compare_exchange_strong(expected, expected + 1, std::memory_order_acq_rel);
 }
 
 void ExclusiveMonitor::Clear() {
-    Lock();
-    std::fill(exclusive_addresses.begin(), exclusive_addresses.end(), INVALID_EXCLUSIVE_ADDRESS);
-    Unlock();
+    for (size_t i = 0; i < processor_count; i++) {
+        reservations[i].address.store(INVALID_EXCLUSIVE_ADDRESS, std::memory_order_release);
+    }
 }
 
 void ExclusiveMonitor::ClearProcessor(size_t processor_id) {
-    Lock();
-    exclusive_addresses[processor_id] = INVALID_EXCLUSIVE_ADDRESS;
-    Unlock();
+    reservations[processor_id].address.store(INVALID_EXCLUSIVE_ADDRESS, std::memory_order_release);
 }
 
 }  // namespace Dynarmic
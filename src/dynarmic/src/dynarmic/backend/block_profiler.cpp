@@ -0,0 +1,123 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "dynarmic/backend/block_profiler.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace Dynarmic::Backend {
+
+/// Successor counts below this are too few to say anything about the branch.
+constexpr u64 min_successor_count = 16;
+
+BlockProfiler::BlockProfiler(std::optional<u32> tier_up_threshold, std::optional<u32> trace_threshold)
+        : tier_up_threshold(tier_up_threshold)
+        , trace_threshold(trace_threshold) {}
+
+BlockTier BlockProfiler::GetTier(IR::LocationDescriptor location) const {
+    const auto iter = entries.find(location);
+    return iter != entries.end() ? iter->second.tier : InitialTier();
+}
+
+void BlockProfiler::SkipBaseline(IR::LocationDescriptor location) {
+    Entry& entry = GetEntry(location);
+    if (entry.tier == BlockTier::Baseline) {
+        EnterTier(entry, BlockTier::Optimized);
+    }
+}
+
+s32* BlockProfiler::GetCounter(IR::LocationDescriptor location) {
+    Entry& entry = GetEntry(location);
+    return ThresholdFor(entry.tier) ? &entry.counter : nullptr;
+}
+
+bool BlockProfiler::TakeHotBlock(IR::LocationDescriptor location) {
+    if (!counter_expired) {
+        return false;
+    }
+    counter_expired = false;
+
+    // The lookup may be for another block if the guest context was switched in between;
+    // the expired block's counter stays at or below zero, so it sets the flag again the next
+    // time it is entered.
+    const auto iter = entries.find(location);
+    if (iter == entries.end() || !ThresholdFor(iter->second.tier) || !HasExpired(iter->second)) {
+        return false;
+    }
+    Entry& entry = iter->second;
+    entry.completed += entry.period;
+    EnterTier(entry, entry.tier == BlockTier::Baseline ? BlockTier::Optimized : BlockTier::Trace);
+    return true;
+}
+
+std::optional<IR::LocationDescriptor> BlockProfiler::HotterSuccessor(IR::LocationDescriptor a, IR::LocationDescriptor b) const {
+    // Blocks are counted rather than branches, so a successor that is also reached from
+    // elsewhere looks hotter than it is. Demanding a clear majority keeps that from mattering much.
+    const u64 count_a = ExecutionCount(a);
+    const u64 count_b = ExecutionCount(b);
+    const u64 total = count_a + count_b;
+    if (total < min_successor_count) {
+        return std::nullopt;
+    }
+    if (count_a * 4 >= total * 3) {
+        return a;
+    }
+    if (count_b * 4 >= total * 3) {
+        return b;
+    }
+    return std::nullopt;
+}
+
+BlockTier BlockProfiler::InitialTier() const {
+    return tier_up_threshold ? BlockTier::Baseline : BlockTier::Optimized;
+}
+
+BlockProfiler::Entry& BlockProfiler::GetEntry(IR::LocationDescriptor location) {
+    const auto [iter, inserted] = entries.try_emplace(location);
+    if (inserted) {
+        EnterTier(iter->second, InitialTier());
+    }
+    return iter->second;
+}
+
+void BlockProfiler::EnterTier(Entry& entry, BlockTier tier) const {
+    entry.tier = tier;
+    // Clamped so that the period fits the signed counter.
+    entry.period = static_cast<s32>(std::min<u32>(ThresholdFor(tier).value_or(0), std::numeric_limits<s32>::max()));
+    entry.counter = entry.period;
+}
+
+std::optional<u32> BlockProfiler::ThresholdFor(BlockTier tier) const {
+    // The number of runs before a block leaves the tier.
+    switch (tier) {
+    case BlockTier::Baseline:
+        return tier_up_threshold;
+    case BlockTier::Optimized:
+        return trace_threshold;
+    case BlockTier::Trace:
+        return std::nullopt;
+    }
+    return std::nullopt;
+}
+
+u64 BlockProfiler::ExecutionCount(IR::LocationDescriptor location) const {
+    const auto iter = entries.find(location);
+    if (iter == entries.end()) {
+        return 0;
+    }
+    const Entry& entry = iter->second;
+    if (!ThresholdFor(entry.tier)) {
+        return entry.completed;
+    }
+    if (HasExpired(entry)) {
+        return entry.completed + entry.period;
+    }
+    return entry.completed + static_cast<u64>(entry.period - entry.counter);
+}
+
+bool BlockProfiler::HasExpired(const Entry& entry) {
+    return entry.counter <= 0;
+}
+
+}  // namespace Dynarmic::Backend
@@ -0,0 +1,79 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <optional>
+#include <unordered_map>
+
+#include "dynarmic/common/common_types.h"
+#include "dynarmic/ir/location_descriptor.h"
+
+namespace Dynarmic::Backend {
+
+/// How much effort went into the translation of a block. Blocks move up a tier each time
+/// they have run often enough at the current one.
+enum class BlockTier : u8 {
+    Baseline,   ///< Translated with only the passes emission needs.
+    Optimized,  ///< Translated with the full optimization pipeline.
+    Trace,      ///< Retranslated as a trace along its usual path.
+};
+
+/// Counts how often emitted blocks run, to find the ones worth translating again at a higher tier.
+/// Emitted code counts its block's counter down on entry. Whenever it is at or below zero, the code
+/// sets the expired flag and returns to the dispatcher, whose next lookup is for that same block.
+class BlockProfiler {
+public:
+    /// A tier without a threshold is skipped: without tier_up_threshold blocks start out
+    /// optimized, without trace_threshold they are never made into traces.
+    BlockProfiler(std::optional<u32> tier_up_threshold, std::optional<u32> trace_threshold);
+
+    BlockTier GetTier(IR::LocationDescriptor location) const;
+
+    /// Moves a block that has not been counted yet straight to the optimized tier, for when
+    /// optimized IR for it is at hand anyway.
+    void SkipBaseline(IR::LocationDescriptor location);
+
+    /// Returns the counter the block at location counts down, or nullptr if it is at its final
+    /// tier and need not be counted any more. Counters keep their address for the lifetime of
+    /// the profiler and keep their count when the block is emitted again.
+    s32* GetCounter(IR::LocationDescriptor location);
+
+    /// Set by emitted code when a counter runs out.
+    bool* GetExpiredFlag() {
+        return &counter_expired;
+    }
+
+    /// Returns true once for a block whose counter has just run out, which is then moved up a
+    /// tier and is to be translated again.
+    bool TakeHotBlock(IR::LocationDescriptor location);
+
+    /// Picks the successor a trace should continue at, if one of them clearly ran more often.
+    std::optional<IR::LocationDescriptor> HotterSuccessor(IR::LocationDescriptor a, IR::LocationDescriptor b) const;
+
+private:
+    struct Entry {
+        BlockTier tier;
+        /// Signed, so that it stays expired when emitted code counts past zero.
+        s32 counter;
+        /// What counter was last reset to.
+        s32 period;
+        /// Runs counted in earlier tiers.
+        u64 completed = 0;
+    };
+
+    BlockTier InitialTier() const;
+    Entry& GetEntry(IR::LocationDescriptor location);
+    void EnterTier(Entry& entry, BlockTier tier) const;
+    std::optional<u32> ThresholdFor(BlockTier tier) const;
+    u64 ExecutionCount(IR::LocationDescriptor location) const;
+    static bool HasExpired(const Entry& entry);
+
+    const std::optional<u32> tier_up_threshold;
+    const std::optional<u32> trace_threshold;
+    bool counter_expired = false;
+    // Node-based so that emitted code can point at counters.
+    std::unordered_map<IR::LocationDescriptor, Entry> entries;
+};
+
+}  // namespace Dynarmic::Backend
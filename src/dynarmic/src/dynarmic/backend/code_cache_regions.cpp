@@ -0,0 +1,75 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "dynarmic/backend/code_cache_regions.h"
+
+#include <algorithm>
+
+#include "dynarmic/common/assert.h"
+
+namespace Dynarmic::Backend {
+
+/// Regions have to hold many blocks for evicting one at a time to be worth it;
+/// emitters keep 1 MiB spare for a single block.
+constexpr size_t min_region_size = 8 * 1024 * 1024;
+constexpr size_t max_region_count = 8;
+
+CodeCacheRegions::CodeCacheRegions(size_t begin, size_t end) {
+    ASSERT(begin <= end);
+    const size_t count = std::clamp<size_t>((end - begin) / min_region_size, 1, max_region_count);
+    region_size = (end - begin) / count;
+    for (size_t i = 0; i < count; i++) {
+        const size_t region_begin = begin + i * region_size;
+        const size_t region_end = i + 1 == count ? end : region_begin + region_size;
+        regions.push_back({region_begin, region_end, 0, false});
+    }
+    Reset();
+}
+
+size_t CodeCacheRegions::CurrentEnd() const {
+    return regions[current].end;
+}
+
+void CodeCacheRegions::Touch(size_t offset) {
+    if (!CanEvict() || offset < regions.front().begin) {
+        return;
+    }
+    const size_t index = std::min((offset - regions.front().begin) / region_size, regions.size() - 1);
+    regions[index].generation = generation;
+}
+
+CodeCacheRegions::Region CodeCacheRegions::Advance() {
+    ASSERT(CanEvict());
+    generation++;
+
+    // Search from the region after the current one, so that on ties regions are filled in order.
+    size_t oldest = (current + 1) % regions.size();
+    for (size_t i = 2; i < regions.size(); i++) {
+        const size_t index = (current + i) % regions.size();
+        if (regions[index].generation < regions[oldest].generation) {
+            oldest = index;
+        }
+    }
+
+    RegionState& region = regions[oldest];
+    const Region result{region.begin, region.end, region.has_code};
+    region.generation = generation;
+    region.has_code = true;
+    current = oldest;
+    return result;
+}
+
+void CodeCacheRegions::Reset() {
+    for (RegionState& region : regions) {
+        region.generation = 0;
+        region.has_code = false;
+    }
+    generation = 1;
+    current = 0;
+    if (!regions.empty()) {
+        regions[0].generation = generation;
+        regions[0].has_code = true;
+    }
+}
+
+}  // namespace Dynarmic::Backend
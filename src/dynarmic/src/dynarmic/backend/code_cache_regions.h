@@ -0,0 +1,63 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "dynarmic/common/common_types.h"
+
+namespace Dynarmic::Backend {
+
+/// Splits a code cache into regions that are filled one after another, so that running out of
+/// space only costs the code in the least recently used region rather than all of it.
+/// Regions are described by their offsets into the code cache.
+class CodeCacheRegions {
+public:
+    struct Region {
+        size_t begin;
+        size_t end;
+        /// False if nothing has been emitted into the region since the cache was last cleared.
+        bool has_code;
+    };
+
+    CodeCacheRegions() = default;
+    /// Splits the offsets [begin, end) into regions. Too small a cache stays a single region.
+    CodeCacheRegions(size_t begin, size_t end);
+
+    /// Whether there is a region other than the current one that can be evicted.
+    bool CanEvict() const {
+        return regions.size() > 1;
+    }
+
+    /// The end offset of the region code is currently emitted into.
+    size_t CurrentEnd() const;
+
+    /// Records a use of the code at offset, which keeps its region from being evicted soon.
+    void Touch(size_t offset);
+
+    /// Makes the least recently used other region the current one and returns it. Any code in it
+    /// must be evicted before anything new is emitted there.
+    Region Advance();
+
+    /// Forgets all code and uses, for when the whole cache has been cleared.
+    void Reset();
+
+private:
+    struct RegionState {
+        size_t begin;
+        size_t end;
+        /// The generation in which the region was last emitted into or used.
+        u64 generation;
+        bool has_code;
+    };
+
+    std::vector<RegionState> regions;
+    size_t region_size = 0;
+    size_t current = 0;
+    /// Advances every time a new region becomes current.
+    u64 generation = 0;
+};
+
+}  // namespace Dynarmic::Backend
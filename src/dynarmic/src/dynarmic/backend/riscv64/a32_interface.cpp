@@ -157,6 +157,11 @@ void Jit::ClearCache() {
     impl->ClearCache();
 }
 
+CodeCacheStatistics Jit::GetCodeCacheStatistics() const {
+    // This backend always clears its whole code cache and keeps no statistics.
+    return {};
+}
+
 void Jit::InvalidateCacheRange(u32 start_address, std::size_t length) {
     impl->InvalidateCacheRange(start_address, length);
 }
@@ -117,7 +117,11 @@ A32EmitX64::BlockDescriptor A32EmitX64::Emit(IR::Block& block) {
         return gprs;
     }();
 
-    new (&this->reg_alloc) RegAlloc(gpr_order, any_xmm);
+    const bool use_live_intervals = conf.HasOptimization(OptimizationFlag::LiveIntervalRegAlloc);
+    if (use_live_intervals) {
+        live_intervals.Compute(block);
+    }
+    new (&this->reg_alloc) RegAlloc(gpr_order, any_xmm, use_live_intervals ? &live_intervals : nullptr);
     A32EmitContext ctx{conf, reg_alloc, block};
 
     // Start emitting.
@@ -148,6 +152,7 @@ A32EmitX64::BlockDescriptor A32EmitX64::Emit(IR::Block& block) {
                 UNREACHABLE();
             }
             reg_alloc.EndOfAllocScope();
+            reg_alloc.EndOfInstruction();
             func(reg_alloc);
         }
     };
@@ -190,6 +195,23 @@ void A32EmitX64::ClearCache() {
     fastmem_patch_info.clear();
 }
 
+size_t A32EmitX64::EvictCodeRegion(CodePtr begin, CodePtr end) {
+    const size_t evicted = EmitX64::EvictCodeRegion(begin, end);
+    // New code in the region must be able to register its own fastmem patch locations.
+    const auto begin_rip = std::bit_cast<u64>(begin);
+    const auto end_rip = std::bit_cast<u64>(end);
+    std::vector<u64> stale_patches;
+    for (const auto& [rip, patch_info] : fastmem_patch_info) {
+        if (rip >= begin_rip && rip < end_rip) {
+            stale_patches.push_back(rip);
+        }
+    }
+    for (const u64 rip : stale_patches) {
+        fastmem_patch_info.erase(rip);
+    }
+    return evicted;
+}
+
 void A32EmitX64::InvalidateCacheRanges(const boost::icl::interval_set<u32>& ranges) {
     InvalidateBasicBlocks(block_ranges.InvalidateRanges(ranges));
 }
@@ -56,6 +56,8 @@ public:
 
     void ClearCache() override;
 
+    size_t EvictCodeRegion(CodePtr begin, CodePtr end) override;
+
     void InvalidateCacheRanges(const boost::icl::interval_set<u32>& ranges);
 
 //protected:
@@ -123,6 +125,7 @@ public:
 
     const A32::UserConfig conf;
     RegAlloc reg_alloc; //reusable reg alloc
+    LiveIntervals live_intervals; //reusable, only filled in with OptimizationFlag::LiveIntervalRegAlloc
     BlockRangeInformation<u32> block_ranges;
     std::array<FastDispatchEntry, fast_dispatch_table_size> fast_dispatch_table;
     ankerl::unordered_dense::map<u64, FastmemPatchInfo> fastmem_patch_info;
@@ -6,6 +6,7 @@
  * SPDX-License-Identifier: 0BSD
  */
 
+#include <chrono>
 #include <functional>
 #include <memory>
 #include <mutex>
@@ -176,6 +177,10 @@ struct Jit::Impl {
         return jit_state.SetFpscr(value);
     }
 
+    CodeCacheStatistics GetCodeCacheStatistics() const {
+        return code_cache_statistics;
+    }
+
     std::string Disassemble() const {
         const size_t size = reinterpret_cast<const char*>(block_of_code.getCurr()) - reinterpret_cast<const char*>(block_of_code.GetCodeBegin());
         auto const* p = reinterpret_cast<const char*>(block_of_code.GetCodeBegin());
@@ -202,19 +207,45 @@ private:
 
     A32EmitX64::BlockDescriptor GetBasicBlock(IR::LocationDescriptor descriptor) {
         auto block = emitter.GetBasicBlock(descriptor);
-        if (block)
+        if (block) {
+            block_of_code.TouchRegion(block->entrypoint);
             return *block;
+        }
 
         constexpr size_t MINIMUM_REMAINING_CODESIZE = 1 * 1024 * 1024;
         if (block_of_code.SpaceRemaining() < MINIMUM_REMAINING_CODESIZE) {
-            invalidate_entire_cache = true;
-            PerformRequestedCacheInvalidation(HaltReason::CacheInvalidation);
+            EvictCodeRegion();
         }
         block_of_code.EnsureMemoryCommitted(MINIMUM_REMAINING_CODESIZE);
 
+        const auto start_time = std::chrono::steady_clock::now();
         IR::Block ir_block = A32::Translate(A32::LocationDescriptor{descriptor}, conf.callbacks, {conf.arch_version, conf.define_unpredictable_behaviour, conf.hook_hint_instructions});
         Optimization::Optimize(ir_block, conf, polyfill_options);
-        return emitter.Emit(ir_block);
+        const auto block_descriptor = emitter.Emit(ir_block);
+        code_cache_statistics.compiled_blocks++;
+        code_cache_statistics.compiled_instructions += ir_block.CycleCount();
+        code_cache_statistics.emitted_bytes += block_descriptor.size;
+        code_cache_statistics.compile_time += std::chrono::steady_clock::now() - start_time;
+        return block_descriptor;
+    }
+
+    void EvictCodeRegion() {
+        const auto region = block_of_code.AdvanceRegion();
+        if (!region) {
+            invalidate_entire_cache = true;
+            PerformRequestedCacheInvalidation(HaltReason::CacheInvalidation);
+            return;
+        }
+        if (!region->has_code) {
+            return;
+        }
+
+        const auto start_time = std::chrono::steady_clock::now();
+        // The return stack buffer may hold code pointers into the region.
+        jit_state.ResetRSB();
+        code_cache_statistics.evicted_blocks += emitter.EvictCodeRegion(region->begin, region->end);
+        code_cache_statistics.region_evictions++;
+        code_cache_statistics.eviction_time += std::chrono::steady_clock::now() - start_time;
     }
 
     void PerformRequestedCacheInvalidation(HaltReason hr) {
@@ -229,8 +260,11 @@ private:
 
             jit_state.ResetRSB();
             if (invalidate_entire_cache) {
+                const auto start_time = std::chrono::steady_clock::now();
                 block_of_code.ClearCache();
                 emitter.ClearCache();
+                code_cache_statistics.full_clears++;
+                code_cache_statistics.eviction_time += std::chrono::steady_clock::now() - start_time;
             } else {
                 emitter.InvalidateCacheRanges(invalid_cache_ranges);
             }
@@ -248,6 +282,8 @@ private:
 
     Jit* jit_interface;
 
+    CodeCacheStatistics code_cache_statistics;
+
     // Requests made during execution to invalidate the cache are queued up here.
     bool invalidate_entire_cache = false;
     boost::icl::interval_set<u32> invalid_cache_ranges;
@@ -323,6 +359,10 @@ void Jit::ClearExclusiveState() {
     impl->ClearExclusiveState();
 }
 
+CodeCacheStatistics Jit::GetCodeCacheStatistics() const {
+    return impl->GetCodeCacheStatistics();
+}
+
 std::string Jit::Disassemble() const {
     return impl->Disassemble();
 }
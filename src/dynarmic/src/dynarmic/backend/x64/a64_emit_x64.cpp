@@ -91,7 +91,11 @@ A64EmitX64::BlockDescriptor A64EmitX64::Emit(IR::Block& block) noexcept {
         return gprs;
     }();
 
-    new (&this->reg_alloc) RegAlloc{gpr_order, any_xmm};
+    const bool use_live_intervals = conf.HasOptimization(OptimizationFlag::LiveIntervalRegAlloc);
+    if (use_live_intervals) {
+        live_intervals.Compute(block);
+    }
+    new (&this->reg_alloc) RegAlloc{gpr_order, any_xmm, use_live_intervals ? &live_intervals : nullptr};
     A64EmitContext ctx{conf, reg_alloc, block};
 
     // Start emitting.
@@ -141,6 +145,7 @@ a64_branch:
         (this->*a64_handlers[size_t(opcode) - std::size(opcode_handlers)])(ctx, &inst);
 finish_this_inst:
         ctx.reg_alloc.EndOfAllocScope();
+        ctx.reg_alloc.EndOfInstruction();
         if (conf.very_verbose_debugging_output) [[unlikely]] {
             EmitVerboseDebuggingOutput(reg_alloc);
         }
@@ -177,6 +182,23 @@ void A64EmitX64::ClearCache() {
     fastmem_patch_info.clear();
 }
 
+size_t A64EmitX64::EvictCodeRegion(CodePtr begin, CodePtr end) {
+    const size_t evicted = EmitX64::EvictCodeRegion(begin, end);
+    // New code in the region must be able to register its own fastmem patch locations.
+    const auto begin_rip = std::bit_cast<u64>(begin);
+    const auto end_rip = std::bit_cast<u64>(end);
+    std::vector<u64> stale_patches;
+    for (const auto& [rip, patch_info] : fastmem_patch_info) {
+        if (rip >= begin_rip && rip < end_rip) {
+            stale_patches.push_back(rip);
+        }
+    }
+    for (const u64 rip : stale_patches) {
+        fastmem_patch_info.erase(rip);
+    }
+    return evicted;
+}
+
 void A64EmitX64::InvalidateCacheRanges(const boost::icl::interval_set<u64>& ranges) {
     InvalidateBasicBlocks(block_ranges.InvalidateRanges(ranges));
 }
@@ -500,6 +522,77 @@ void A64EmitX64::EmitA64SetPC(A64EmitContext& ctx, IR::Inst* inst) {
     }
 }
 
+void A64EmitX64::EmitA64SideExitIf(A64EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    const IR::Cond cond = args[0].GetImmediateCond();
+    const IR::LocationDescriptor target{args[1].GetImmediateU64()};
+    const size_t cycles = args[2].GetImmediateU64();
+
+    // EmitCond reads the flags into rax.
+    ctx.reg_alloc.ScratchGpr(code, HostLoc::RAX);
+
+    SharedLabel exit = GenSharedLabel();
+    Xbyak::Label stay = EmitCond(IR::Invert(cond));
+    code.jmp(*exit, code.T_NEAR);
+    code.L(stay);
+
+    ctx.deferred_emits.emplace_back([=, this, &ctx] {
+        code.L(*exit);
+        EmitSideExit(ctx, target, cycles);
+    });
+}
+
+void A64EmitX64::EmitA64SideExitIfCheckBit(A64EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    const bool check_bit = args[0].GetImmediateU1();
+    const IR::LocationDescriptor target{args[1].GetImmediateU64()};
+    const size_t cycles = args[2].GetImmediateU64();
+
+    SharedLabel exit = GenSharedLabel();
+    code.cmp(code.byte[rsp + ABI_SHADOW_SPACE + offsetof(StackLayout, check_bit)], u8(0));
+    if (check_bit) {
+        code.jnz(*exit, code.T_NEAR);
+    } else {
+        code.jz(*exit, code.T_NEAR);
+    }
+
+    ctx.deferred_emits.emplace_back([=, this, &ctx] {
+        code.L(*exit);
+        EmitSideExit(ctx, target, cycles);
+    });
+}
+
+void A64EmitX64::EmitSideExit(A64EmitContext& ctx, IR::LocationDescriptor target, size_t cycles) {
+    if (conf.enable_cycle_counting) {
+        EmitAddCycles(cycles);
+    }
+    EmitTerminal(IR::Term::LinkBlock{target}, ctx.Location().SetSingleStepping(false), ctx.IsSingleStep());
+}
+
+void A64EmitX64::EmitA64CountBlockExecution(A64EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    const u64 counter = args[0].GetImmediateU64();
+    const u64 expired_flag = args[1].GetImmediateU64();
+    const u64 pc = ctx.Location().PC();
+    const Xbyak::Reg64 tmp = ctx.reg_alloc.ScratchGpr(code);
+
+    // The counter is signed and keeps going below zero until the block is replaced, so that the
+    // block keeps returning to the dispatcher if its first expiry is missed.
+    SharedLabel expired = GenSharedLabel();
+    code.mov(tmp, counter);
+    code.sub(dword[tmp], 1);
+    code.jle(*expired, code.T_NEAR);
+
+    ctx.deferred_emits.emplace_back([=, this] {
+        code.L(*expired);
+        code.mov(rax, expired_flag);
+        code.mov(byte[rax], 1);
+        code.mov(rax, pc);
+        code.mov(qword[code.ABI_JIT_PTR + offsetof(A64JitState, pc)], rax);
+        code.ReturnFromRunCode();
+    });
+}
+
 void A64EmitX64::EmitA64CallSupervisor(A64EmitContext& ctx, IR::Inst* inst) {
     ctx.reg_alloc.HostCall(code, nullptr);
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
@@ -51,6 +51,8 @@ public:
 
     void ClearCache() override;
 
+    size_t EvictCodeRegion(CodePtr begin, CodePtr end) override;
+
     void InvalidateCacheRanges(const boost::icl::interval_set<u64>& ranges);
 
 //protected:
@@ -108,6 +110,7 @@ public:
 
     // Terminal instruction emitters
     void EmitTerminal(IR::Terminal terminal, IR::LocationDescriptor initial_location, bool is_single_step) noexcept override;
+    void EmitSideExit(A64EmitContext& ctx, IR::LocationDescriptor target, size_t cycles);
 
     // Patching
     void Unpatch(const IR::LocationDescriptor& target_desc) override;
@@ -119,6 +122,7 @@ public:
 //data
     const A64::UserConfig conf;
     RegAlloc reg_alloc; //reusable reg alloc
+    LiveIntervals live_intervals; //reusable, only filled in with OptimizationFlag::LiveIntervalRegAlloc
     BlockRangeInformation<u64> block_ranges;
     std::array<FastDispatchEntry, fast_dispatch_table_size> fast_dispatch_table;
     ankerl::unordered_dense::map<u64, FastmemPatchInfo> fastmem_patch_info;
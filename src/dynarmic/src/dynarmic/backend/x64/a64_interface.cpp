@@ -6,9 +6,11 @@
  * SPDX-License-Identifier: 0BSD
  */
 
+#include <chrono>
 #include <cstring>
 #include <memory>
 #include <mutex>
+#include <optional>
 
 #include <boost/icl/interval_set.hpp>
 #include "dynarmic/common/assert.h"
@@ -16,6 +18,9 @@
 #include <bit>
 #include <mcl/scope_exit.hpp>
 
+#include "dynarmic/backend/a64_ir_cache.h"
+#include "dynarmic/backend/a64_speculative_translator.h"
+#include "dynarmic/backend/block_profiler.h"
 #include "dynarmic/backend/x64/a64_emit_x64.h"
 #include "dynarmic/backend/x64/a64_jitstate.h"
 #include "dynarmic/backend/x64/block_of_code.h"
@@ -64,8 +69,18 @@ public:
             : conf(conf)
             , block_of_code(GenRunCodeCallbacks(conf.callbacks, &GetCurrentBlockThunk, this, conf), JitStateInfo{jit_state}, conf.code_cache_size, GenRCP(conf))
             , emitter(block_of_code, conf, jit)
-            , polyfill_options(GenPolyfillOptions(block_of_code)) {
+            , polyfill_options(GenPolyfillOptions(block_of_code))
+            , ir_cache(conf, polyfill_options) {
         ASSERT(conf.page_table_address_space_bits >= 12 && conf.page_table_address_space_bits <= 64);
+        const bool tiered = conf.HasOptimization(OptimizationFlag::TieredCompilation);
+        const bool traces = conf.HasOptimization(OptimizationFlag::TraceFormation);
+        if (tiered || traces) {
+            block_profiler.emplace(tiered ? std::optional{conf.tier_up_threshold} : std::nullopt,
+                                   traces ? std::optional{conf.trace_threshold} : std::nullopt);
+        }
+        if (conf.speculative_compilation) {
+            speculative_translator.emplace(this->conf, polyfill_options);
+        }
     }
 
     ~Impl() = default;
@@ -230,6 +245,10 @@ public:
         return is_executing;
     }
 
+    CodeCacheStatistics GetCodeCacheStatistics() const {
+        return code_cache_statistics;
+    }
+
     std::string Disassemble() const {
         const size_t size = reinterpret_cast<const char*>(block_of_code.getCurr()) - reinterpret_cast<const char*>(block_of_code.GetCodeBegin());
         auto const* p = reinterpret_cast<const char*>(block_of_code.GetCodeBegin());
@@ -255,23 +274,86 @@ private:
     }
 
     CodePtr GetBlock(IR::LocationDescriptor current_location) {
-        if (auto block = emitter.GetBasicBlock(current_location))
+        if (block_profiler && block_profiler->TakeHotBlock(current_location)) {
+            // Replace the block with a better translation. The old code stays in place for anything still running it.
+            emitter.InvalidateBasicBlocks({current_location});
+        } else if (auto block = emitter.GetBasicBlock(current_location)) {
+            block_of_code.TouchRegion(block->entrypoint);
             return block->entrypoint;
+        }
 
         constexpr size_t MINIMUM_REMAINING_CODESIZE = 1 * 1024 * 1024;
         if (block_of_code.SpaceRemaining() < MINIMUM_REMAINING_CODESIZE) {
+            EvictCodeRegion();
+        }
+        block_of_code.EnsureMemoryCommitted(MINIMUM_REMAINING_CODESIZE);
+
+        // JIT Compile
+        const auto start_time = std::chrono::steady_clock::now();
+        IR::Block ir_block{current_location};
+        const auto tier = block_profiler ? block_profiler->GetTier(current_location) : Backend::BlockTier::Optimized;
+        if (tier != Backend::BlockTier::Trace && ((speculative_translator && speculative_translator->Take(ir_block)) || ir_cache.Load(ir_block))) {
+            if (tier == Backend::BlockTier::Baseline) {
+                // Cached and speculatively translated IR is fully optimized already.
+                block_profiler->SkipBaseline(current_location);
+            }
+        } else {
+            const auto get_code = [this](u64 vaddr) { return conf.callbacks->MemoryReadCode(vaddr); };
+            A64::TranslationOptions options{conf.define_unpredictable_behaviour, conf.wall_clock_cntpct};
+            if (tier == Backend::BlockTier::Trace) {
+                options.trace_successor = [this](A64::LocationDescriptor a, A64::LocationDescriptor b) -> std::optional<A64::LocationDescriptor> {
+                    if (const auto next = block_profiler->HotterSuccessor(a, b)) {
+                        return A64::LocationDescriptor{*next};
+                    }
+                    return std::nullopt;
+                };
+            }
+            A64::Translate(ir_block, A64::LocationDescriptor{current_location}, get_code, std::move(options));
+            if (tier == Backend::BlockTier::Baseline) {
+                Optimization::OptimizeBaseline(ir_block, conf, polyfill_options);
+            } else {
+                Optimization::Optimize(ir_block, conf, polyfill_options);
+                ir_cache.Store(ir_block);
+            }
+        }
+        if (block_profiler && !A64::LocationDescriptor{current_location}.SingleStepping()) {
+            if (s32* const counter = block_profiler->GetCounter(current_location)) {
+                ir_block.PrependNewInst(ir_block.begin(), IR::Opcode::A64CountBlockExecution,
+                                        {IR::Value{std::bit_cast<u64>(counter)},
+                                         IR::Value{std::bit_cast<u64>(block_profiler->GetExpiredFlag())}});
+            }
+        }
+        const auto block_descriptor = emitter.Emit(ir_block);
+        code_cache_statistics.compiled_blocks++;
+        code_cache_statistics.compiled_instructions += ir_block.CycleCount();
+        code_cache_statistics.emitted_bytes += block_descriptor.size;
+        code_cache_statistics.compile_time += std::chrono::steady_clock::now() - start_time;
+        if (speculative_translator) {
+            speculative_translator->RequestSuccessors(ir_block, [this](IR::LocationDescriptor location) {
+                return emitter.GetBasicBlock(location).has_value();
+            });
+        }
+        return block_descriptor.entrypoint;
+    }
+
+    void EvictCodeRegion() {
+        const auto region = block_of_code.AdvanceRegion();
+        if (!region) {
             // Immediately evacuate cache
             invalidate_entire_cache = true;
             PerformRequestedCacheInvalidation(HaltReason::CacheInvalidation);
+            return;
+        }
+        if (!region->has_code) {
+            return;
         }
-        block_of_code.EnsureMemoryCommitted(MINIMUM_REMAINING_CODESIZE);
 
-        // JIT Compile
-        const auto get_code = [this](u64 vaddr) { return conf.callbacks->MemoryReadCode(vaddr); };
-        IR::Block ir_block = A64::Translate(A64::LocationDescriptor{current_location}, get_code,
-                                            {conf.define_unpredictable_behaviour, conf.wall_clock_cntpct});
-        Optimization::Optimize(ir_block, conf, polyfill_options);
-        return emitter.Emit(ir_block).entrypoint;
+        const auto start_time = std::chrono::steady_clock::now();
+        // The return stack buffer may hold code pointers into the region.
+        jit_state.ResetRSB();
+        code_cache_statistics.evicted_blocks += emitter.EvictCodeRegion(region->begin, region->end);
+        code_cache_statistics.region_evictions++;
+        code_cache_statistics.eviction_time += std::chrono::steady_clock::now() - start_time;
     }
 
     void PerformRequestedCacheInvalidation(HaltReason hr) {
@@ -285,9 +367,15 @@ private:
             }
 
             jit_state.ResetRSB();
+            if (speculative_translator) {
+                speculative_translator->Invalidate();
+            }
             if (invalidate_entire_cache) {
+                const auto start_time = std::chrono::steady_clock::now();
                 block_of_code.ClearCache();
                 emitter.ClearCache();
+                code_cache_statistics.full_clears++;
+                code_cache_statistics.eviction_time += std::chrono::steady_clock::now() - start_time;
             } else {
                 emitter.InvalidateCacheRanges(invalid_cache_ranges);
             }
@@ -303,6 +391,11 @@ private:
     BlockOfCode block_of_code;
     A64EmitX64 emitter;
     Optimization::PolyfillOptions polyfill_options;
+    Backend::A64IRCache ir_cache;
+    std::optional<Backend::BlockProfiler> block_profiler;
+    std::optional<Backend::A64SpeculativeTranslator> speculative_translator;
+
+    CodeCacheStatistics code_cache_statistics;
 
     bool invalidate_entire_cache = false;
     boost::icl::interval_set<u64> invalid_cache_ranges;
@@ -422,6 +515,10 @@ bool Jit::IsExecuting() const {
     return impl->IsExecuting();
 }
 
+CodeCacheStatistics Jit::GetCodeCacheStatistics() const {
+    return impl->GetCodeCacheStatistics();
+}
+
 std::string Jit::Disassemble() const {
     return impl->Disassemble();
 }
@@ -251,6 +251,7 @@ BlockOfCode::BlockOfCode(RunCodeCallbacks cb, JitStateInfo jsi, size_t total_cod
 void BlockOfCode::PreludeComplete() {
     prelude_complete = true;
     code_begin = getCurr();
+    regions = CodeCacheRegions{getSize(), maxSize_};
     ClearCache();
     DisableWriting();
 }
@@ -277,15 +278,31 @@ void BlockOfCode::DisableWriting() {
 
 void BlockOfCode::ClearCache() {
     ASSERT(prelude_complete);
+    regions.Reset();
     SetCodePtr(code_begin);
 }
 
 size_t BlockOfCode::SpaceRemaining() const {
     ASSERT(prelude_complete);
     const u8* current_ptr = getCurr<const u8*>();
-    if (current_ptr >= &top_[maxSize_])
+    const u8* region_end = &top_[regions.CurrentEnd()];
+    if (current_ptr >= region_end)
         return 0;
-    return &top_[maxSize_] - current_ptr;
+    return region_end - current_ptr;
+}
+
+std::optional<CodeRegion> BlockOfCode::AdvanceRegion() {
+    ASSERT(prelude_complete);
+    if (!regions.CanEvict()) {
+        return std::nullopt;
+    }
+    const auto region = regions.Advance();
+    SetCodePtr(&top_[region.begin]);
+    return CodeRegion{&top_[region.begin], &top_[region.end], region.has_code};
+}
+
+void BlockOfCode::TouchRegion(CodePtr code_ptr) {
+    regions.Touch(static_cast<const u8*>(code_ptr) - top_);
 }
 
 void BlockOfCode::EnsureMemoryCommitted([[maybe_unused]] size_t codesize) {
@@ -11,6 +11,7 @@
 #include <array>
 #include <functional>
 #include <memory>
+#include <optional>
 #include <type_traits>
 
 #include <mcl/bit/bit_field.hpp>
@@ -18,6 +19,7 @@
 #include <xbyak/xbyak.h>
 #include <xbyak/xbyak_util.h>
 
+#include "dynarmic/backend/code_cache_regions.h"
 #include "dynarmic/backend/x64/abi.h"
 #include "dynarmic/backend/x64/callback.h"
 #include "dynarmic/backend/x64/constant_pool.h"
@@ -38,6 +40,13 @@ struct RunCodeCallbacks {
     bool enable_cycle_counting;
 };
 
+struct CodeRegion {
+    CodePtr begin;
+    CodePtr end;
+    /// False if nothing has been emitted into the region since the cache was last cleared.
+    bool has_code;
+};
+
 class BlockOfCode final : public Xbyak::CodeGenerator {
 public:
     BlockOfCode(RunCodeCallbacks cb, JitStateInfo jsi, size_t total_code_size, std::function<void(BlockOfCode&)> rcp);
@@ -53,8 +62,14 @@ public:
 
     /// Clears this block of code and resets code pointer to beginning.
     void ClearCache();
-    /// Calculates how much space is remaining to use.
+    /// Calculates how much space is remaining to use in the current region.
     size_t SpaceRemaining() const;
+    /// Moves the code pointer to the start of the least recently used region and returns it.
+    /// Blocks in that region must be evicted before emitting. Returns nullopt if the cache is not
+    /// split into regions, in which case the whole cache has to be cleared instead.
+    std::optional<CodeRegion> AdvanceRegion();
+    /// Records that the block at code_ptr was looked up, which keeps its region around for longer.
+    void TouchRegion(CodePtr code_ptr);
     /// Ensure at least codesize bytes of code cache memory are committed at the current code_ptr.
     void EnsureMemoryCommitted(size_t codesize);
 
@@ -194,6 +209,7 @@ private:
     size_t committed_size = 0;
 #endif
     ConstantPool constant_pool;
+    CodeCacheRegions regions;
     RunCodeFuncType run_code = nullptr;
     RunCodeFuncType step_code = nullptr;
     std::array<const void*, 4> return_from_run_code;
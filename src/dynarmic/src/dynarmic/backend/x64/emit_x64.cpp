@@ -8,6 +8,8 @@
 
 #include "dynarmic/backend/x64/emit_x64.h"
 
+#include <algorithm>
+#include <functional>
 #include <iterator>
 
 #include "dynarmic/common/assert.h"
@@ -386,6 +388,40 @@ void EmitX64::ClearCache() {
     PerfMapClear();
 }
 
+size_t EmitX64::EvictCodeRegion(CodePtr begin, CodePtr end) {
+    const auto in_region = [begin, end](CodePtr ptr) {
+        return std::less_equal<CodePtr>{}(begin, ptr) && std::less<CodePtr>{}(ptr, end);
+    };
+    const auto erase_in_region = [&](auto& locations) {
+        locations.erase(std::remove_if(locations.begin(), locations.end(), in_region), locations.end());
+    };
+
+    // Links from code in the region must not be patched once the region is reused.
+    // This also covers code that has been invalidated earlier but was left in place.
+    for (auto& [target, patch_info] : patch_information) {
+        erase_in_region(patch_info.jg);
+        erase_in_region(patch_info.jz);
+        erase_in_region(patch_info.jmp);
+        erase_in_region(patch_info.mov_rcx);
+    }
+
+    std::vector<IR::LocationDescriptor> evicted;
+    for (const auto& [location, block] : block_descriptors) {
+        if (in_region(block.entrypoint)) {
+            evicted.push_back(location);
+        }
+    }
+
+    code.EnableWriting();
+    for (const auto& location : evicted) {
+        Unpatch(location);
+        block_descriptors.erase(location);
+    }
+    code.DisableWriting();
+
+    return evicted.size();
+}
+
 void EmitX64::InvalidateBasicBlocks(const ankerl::unordered_dense::set<IR::LocationDescriptor>& locations) {
     code.EnableWriting();
     for (const auto& descriptor : locations) {
@@ -95,6 +95,9 @@ public:
     /// Invalidates a selection of basic blocks.
     void InvalidateBasicBlocks(const ankerl::unordered_dense::set<IR::LocationDescriptor>& locations);
 
+    /// Forgets all code in [begin, end), so that the memory can be reused. Returns the number of blocks dropped.
+    virtual size_t EvictCodeRegion(CodePtr begin, CodePtr end);
+
 //protected:
     // Microinstruction emitters
 #define OPCODE(name, type, ...) void Emit##name(EmitContext& ctx, IR::Inst* inst);
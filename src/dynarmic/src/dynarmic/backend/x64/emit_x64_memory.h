@@ -12,7 +12,6 @@
 #include "dynarmic/backend/x64/a32_emit_x64.h"
 #include "dynarmic/backend/x64/a64_emit_x64.h"
 #include "dynarmic/backend/x64/exclusive_monitor_friend.h"
-#include "dynarmic/common/spin_lock_x64.h"
 #include "dynarmic/interface/exclusive_monitor.h"
 #include "dynarmic/ir/acc_type.h"
 
@@ -339,45 +338,53 @@ const void* EmitWriteMemoryMov(BlockOfCode& code, const Xbyak::RegExp& addr, int
     }
 }
 
+/// Points pointer at the version of vaddr's granule.
 template<typename UserConfig>
-void EmitExclusiveLock(BlockOfCode& code, const UserConfig& conf, Xbyak::Reg64 pointer, Xbyak::Reg32 tmp) {
-    if (conf.HasOptimization(OptimizationFlag::Unsafe_IgnoreGlobalMonitor)) {
-        return;
-    }
-
-    code.mov(pointer, std::bit_cast<u64>(GetExclusiveMonitorLockPointer(conf.global_monitor)));
-    EmitSpinLockLock(code, pointer, tmp);
+void EmitExclusiveVersionPointer(BlockOfCode& code, const UserConfig& conf, Xbyak::Reg64 vaddr, Xbyak::Reg64 pointer, Xbyak::Reg64 tmp) {
+    // (((vaddr >> 4) * 0x9E3779B97F4A7C15) >> 56) * 64
+    code.mov(tmp, vaddr);
+    code.shr(tmp, 4);
+    code.mov(pointer, 0x9E3779B97F4A7C15);
+    code.imul(tmp, pointer);
+    code.shr(tmp, 56);
+    code.shl(tmp.cvt32(), 6);
+    code.mov(pointer, std::bit_cast<u64>(GetExclusiveMonitorVersionTable(conf.global_monitor)));
+    code.add(pointer, tmp);
 }
 
+/// Records the version of vaddr's granule in this processor's reservation. Must come before the exclusive load.
 template<typename UserConfig>
-void EmitExclusiveUnlock(BlockOfCode& code, const UserConfig& conf, Xbyak::Reg64 pointer, Xbyak::Reg32 tmp) {
-    if (conf.HasOptimization(OptimizationFlag::Unsafe_IgnoreGlobalMonitor)) {
-        return;
-    }
-
-    code.mov(pointer, std::bit_cast<u64>(GetExclusiveMonitorLockPointer(conf.global_monitor)));
-    EmitSpinLockUnlock(code, pointer, tmp);
+void EmitExclusiveMarkVersion(BlockOfCode& code, const UserConfig& conf, Xbyak::Reg64 vaddr, Xbyak::Reg64 pointer, Xbyak::Reg64 tmp) {
+    EmitExclusiveVersionPointer(code, conf, vaddr, pointer, tmp);
+    code.mov(tmp, qword[pointer]);
+    code.mov(pointer, std::bit_cast<u64>(GetExclusiveMonitorVersionPointer(conf.global_monitor, conf.processor_id)));
+    code.mov(qword[pointer], tmp);
 }
 
+/// Takes this processor's reservation and commits an exclusive store to vaddr by advancing the
+/// version of its granule. Jumps to fail if the reservation is not for vaddr, or if another store
+/// to the granule has committed since. Clobbers rax.
 template<typename UserConfig>
-void EmitExclusiveTestAndClear(BlockOfCode& code, const UserConfig& conf, Xbyak::Reg64 vaddr, Xbyak::Reg64 pointer, Xbyak::Reg64 tmp) {
+void EmitExclusiveCommit(BlockOfCode& code, const UserConfig& conf, Xbyak::Reg64 vaddr, Xbyak::Reg64 pointer, Xbyak::Reg64 tmp, Xbyak::Label& fail) {
+    code.mov(pointer, std::bit_cast<u64>(GetExclusiveMonitorAddressPointer(conf.global_monitor, conf.processor_id)));
     if (conf.HasOptimization(OptimizationFlag::Unsafe_IgnoreGlobalMonitor)) {
+        code.cmp(qword[pointer], vaddr);
+        code.jne(fail, code.T_NEAR);
         return;
     }
 
-    code.mov(tmp, 0xDEAD'DEAD'DEAD'DEAD);
-    const size_t processor_count = GetExclusiveMonitorProcessorCount(conf.global_monitor);
-    for (size_t processor_index = 0; processor_index < processor_count; processor_index++) {
-        if (processor_index == conf.processor_id) {
-            continue;
-        }
-        Xbyak::Label ok;
-        code.mov(pointer, std::bit_cast<u64>(GetExclusiveMonitorAddressPointer(conf.global_monitor, processor_index)));
-        code.cmp(qword[pointer], vaddr);
-        code.jne(ok, code.T_NEAR);
-        code.mov(qword[pointer], tmp);
-        code.L(ok);
-    }
+    code.mov(code.rax, 0xDEAD'DEAD'DEAD'DEAD);
+    code.xchg(qword[pointer], code.rax);
+    code.cmp(code.rax, vaddr);
+    code.jne(fail, code.T_NEAR);
+
+    code.mov(pointer, std::bit_cast<u64>(GetExclusiveMonitorVersionPointer(conf.global_monitor, conf.processor_id)));
+    code.mov(code.rax, qword[pointer]);
+    EmitExclusiveVersionPointer(code, conf, vaddr, pointer, tmp);
+    code.lea(tmp, ptr[code.rax + 1]);
+    code.lock();
+    code.cmpxchg(qword[pointer], tmp);
+    code.jne(fail, code.T_NEAR);
 }
 
 inline bool IsOrdered(IR::AccType acctype) {
@@ -246,6 +246,79 @@ void DenormalsAreZero(BlockOfCode& code, FP::FPCR fpcr, std::initializer_list<Xb
     }
 }
 
+/// Gives lanes in which an operand or the result is a NaN the value the default NaNHandler would for
+/// an element-wise operation: the first signalling NaN operand quieted, else the first quiet NaN
+/// operand, else the default NaN. Unlike the handler this does not leave JITted code.
+/// Requires AVX. Clobbers tmp and xmm0, or k1 and k2 with AVX-512.
+template<size_t fsize, size_t nargs>
+void FixupNaNs(BlockOfCode& code, std::array<Xbyak::Xmm, nargs + 1> xmms, Xbyak::Xmm tmp) {
+    using FPT = mcl::unsigned_integer_of_size<fsize>;
+    const Xbyak::Xmm result = xmms[0];
+    const Xbyak::Address quiet_bit = GetVectorOf<fsize, FP::FPInfo<FPT>::mantissa_msb>(code);
+
+    // Operands are applied last to first so that earlier ones take priority. Setting the quiet
+    // bit of a quiet NaN leaves it unchanged.
+    if (code.HasHostFeature(HostFeature::AVX512_OrthoFloat)) {
+        FCODE(vfpclassp)(k1, result, u8(FpClass::QNaN | FpClass::SNaN));
+        for (size_t i = 1; i <= nargs; ++i) {
+            FCODE(vfpclassp)(k2, xmms[i], u8(FpClass::QNaN | FpClass::SNaN));
+            code.kandnw(k1, k2, k1);
+        }
+        FCODE(vblendmp)(result | k1, result, GetNaNVector<fsize>(code));
+
+        for (const u8 nan_class : {u8(FpClass::QNaN | FpClass::SNaN), FpClass::SNaN}) {
+            for (size_t i = nargs; i > 0; --i) {
+                FCODE(vfpclassp)(k1, xmms[i], nan_class);
+                FCODE(vorp)(result | k1, xmms[i], quiet_bit);
+            }
+        }
+        return;
+    }
+
+    FCODE(vcmpunordp)(tmp, xmms[1], xmms[1]);
+    for (size_t i = 2; i <= nargs; ++i) {
+        FCODE(vcmpunordp)(xmm0, xmms[i], xmms[i]);
+        code.vorps(tmp, tmp, xmm0);
+    }
+    FCODE(vcmpunordp)(xmm0, result, result);
+    code.vandnps(tmp, tmp, xmm0);
+    FCODE(vblendvp)(result, result, GetNaNVector<fsize>(code), tmp);
+
+    for (size_t i = nargs; i > 0; --i) {
+        FCODE(vcmpunordp)(tmp, xmms[i], xmms[i]);
+        FCODE(vorp)(xmm0, xmms[i], quiet_bit);
+        FCODE(vblendvp)(result, result, xmm0, tmp);
+    }
+    for (size_t i = nargs; i > 0; --i) {
+        FCODE(vandp)(xmm0, xmms[i], quiet_bit);
+        ICODE(vpcmpeq)(xmm0, xmm0, quiet_bit);
+        FCODE(vcmpunordp)(tmp, xmms[i], xmms[i]);
+        code.vandnps(tmp, xmm0, tmp);
+        FCODE(vorp)(xmm0, xmms[i], quiet_bit);
+        FCODE(vblendvp)(result, result, xmm0, tmp);
+    }
+}
+
+/// Like HandleNaNs with the default NaNHandler of an element-wise operation, but fixes up the
+/// result with FixupNaNs instead of calling out to the handler. nan_mask is clobbered.
+template<size_t fsize, size_t nargs>
+void HandleNaNsInline(BlockOfCode& code, EmitContext& ctx, std::array<Xbyak::Xmm, nargs + 1> xmms, const Xbyak::Xmm& nan_mask) {
+    static_assert(fsize == 32 || fsize == 64, "fsize must be either 32 or 64");
+
+    code.ptest(nan_mask, nan_mask);
+
+    SharedLabel end = GenSharedLabel(), nan = GenSharedLabel();
+
+    code.jnz(*nan, code.T_NEAR);
+    code.L(*end);
+
+    ctx.deferred_emits.emplace_back([=, &code] {
+        code.L(*nan);
+        FixupNaNs<fsize, nargs>(code, xmms, nan_mask);
+        code.jmp(*end, code.T_NEAR);
+    });
+}
+
 template<typename T>
 struct DefaultIndexer {
     std::tuple<T> operator()(size_t i, const VectorArray<T>& a) {
@@ -261,6 +334,10 @@ struct DefaultIndexer {
     }
 };
 
+/// Whether NaNs produced with this indexer can be handled by HandleNaNsInline.
+template<template<typename> class Indexer>
+constexpr bool is_element_wise = std::is_same_v<Indexer<u32>, DefaultIndexer<u32>>;
+
 template<typename T>
 struct PairedIndexer {
     std::tuple<T, T> operator()(size_t i, const VectorArray<T>& a, const VectorArray<T>& b) {
@@ -350,7 +427,11 @@ void EmitTwoOpVectorOperation(BlockOfCode& code, EmitContext& ctx, IR::Inst* ins
         FCODE(cmpunordp)(nan_mask, nan_mask);
     }
 
-    HandleNaNs<fsize, 1>(code, ctx, fpcr_controlled, {result, xmm_a}, nan_mask, nan_handler);
+    if (is_element_wise<Indexer> && code.HasHostFeature(HostFeature::AVX) && nan_handler == NaNHandler<fsize, Indexer, 2>::GetDefault()) {
+        HandleNaNsInline<fsize, 1>(code, ctx, {result, xmm_a}, nan_mask);
+    } else {
+        HandleNaNs<fsize, 1>(code, ctx, fpcr_controlled, {result, xmm_a}, nan_mask, nan_handler);
+    }
 
     ctx.reg_alloc.DefineValue(code, inst, result);
 }
@@ -420,7 +501,11 @@ void EmitThreeOpVectorOperation(BlockOfCode& code, EmitContext& ctx, IR::Inst* i
         FCODE(cmpunordp)(nan_mask, nan_mask);
     }
 
-    HandleNaNs<fsize, 2>(code, ctx, fpcr_controlled, {result, xmm_a, xmm_b}, nan_mask, nan_handler);
+    if (is_element_wise<Indexer> && code.HasHostFeature(HostFeature::AVX) && nan_handler == NaNHandler<fsize, Indexer, 3>::GetDefault()) {
+        HandleNaNsInline<fsize, 2>(code, ctx, {result, xmm_a, xmm_b}, nan_mask);
+    } else {
+        HandleNaNs<fsize, 2>(code, ctx, fpcr_controlled, {result, xmm_a, xmm_b}, nan_mask, nan_handler);
+    }
 
     ctx.reg_alloc.DefineValue(code, inst, result);
 }
@@ -1361,6 +1446,25 @@ void EmitFPVectorMulAdd(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst) {
 
             ctx.deferred_emits.emplace_back([=, &code, &ctx] {
                 code.L(*fallback);
+                if (needs_nan_correction && !needs_rounding_correction && code.HasHostFeature(HostFeature::AVX512_OrthoFloat)) {
+                    FixupNaNs<fsize, 3>(code, {result, xmm_a, xmm_b, xmm_c}, tmp);
+
+                    // A quiet NaN addend does not hide the invalid operation of (inf * zero).
+                    constexpr u8 inf_class = FpClass::InfPos | FpClass::InfNeg;
+                    constexpr u8 zero_class = FpClass::ZeroPos | FpClass::ZeroNeg;
+                    FCODE(vfpclassp)(k1, xmm_b, inf_class);
+                    FCODE(vfpclassp)(k2, xmm_c, zero_class);
+                    code.kandw(k1, k1, k2);
+                    FCODE(vfpclassp)(k2, xmm_b, zero_class);
+                    FCODE(vfpclassp)(k3, xmm_c, inf_class);
+                    code.kandw(k2, k2, k3);
+                    code.korw(k1, k1, k2);
+                    FCODE(vfpclassp)(k2, xmm_a, FpClass::QNaN);
+                    code.kandw(k1, k1, k2);
+                    FCODE(vblendmp)(result | k1, result, GetNaNVector<fsize>(code));
+                    code.jmp(*end, code.T_NEAR);
+                    return;
+                }
                 code.lea(rsp, ptr[rsp - 8]);
                 ABI_PushCallerSaveRegistersAndAdjustStackExcept(code, HostLocXmmIdx(result.getIdx()));
                 if (needs_rounding_correction && needs_nan_correction) {
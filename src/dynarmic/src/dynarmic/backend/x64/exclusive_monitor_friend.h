@@ -9,20 +9,27 @@
 
 namespace Dynarmic {
 
-inline volatile int* GetExclusiveMonitorLockPointer(ExclusiveMonitor* monitor) {
-    return &monitor->lock.storage;
+inline size_t GetExclusiveMonitorProcessorCount(ExclusiveMonitor* monitor) {
+    return monitor->processor_count;
 }
 
-inline size_t GetExclusiveMonitorProcessorCount(ExclusiveMonitor* monitor) {
-    return monitor->exclusive_addresses.size();
+inline std::atomic<VAddr>* GetExclusiveMonitorAddressPointer(ExclusiveMonitor* monitor, size_t index) {
+    return &monitor->reservations[index].address;
 }
 
-inline VAddr* GetExclusiveMonitorAddressPointer(ExclusiveMonitor* monitor, size_t index) {
-    return monitor->exclusive_addresses.data() + index;
+inline std::uint64_t* GetExclusiveMonitorVersionPointer(ExclusiveMonitor* monitor, size_t index) {
+    return &monitor->reservations[index].version;
 }
 
 inline Vector* GetExclusiveMonitorValuePointer(ExclusiveMonitor* monitor, size_t index) {
-    return monitor->exclusive_values.data() + index;
+    return &monitor->reservations[index].value;
+}
+
+/// The version of an address is the 64-bit word at offset (((address >> 4) * 0x9E3779B97F4A7C15) >> 56) * 64.
+inline void* GetExclusiveMonitorVersionTable(ExclusiveMonitor* monitor) {
+    static_assert(ExclusiveMonitor::VERSION_GRANULE_BITS == 4 && ExclusiveMonitor::NUM_VERSIONS_BITS == 8);
+    static_assert(sizeof(ExclusiveMonitor::Version) == 64);
+    return monitor->versions.data();
 }
 
 }  // namespace Dynarmic
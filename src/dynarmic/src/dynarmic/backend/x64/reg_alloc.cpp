@@ -21,6 +21,7 @@
 #include "dynarmic/backend/x64/abi.h"
 #include "dynarmic/backend/x64/stack_layout.h"
 #include "dynarmic/backend/x64/verbose_debugging_output.h"
+#include "dynarmic/ir/basic_block.h"
 
 namespace Dynarmic::Backend::X64 {
 
@@ -55,6 +56,30 @@ static inline bool IsValuelessType(const IR::Type type) noexcept {
     return type == IR::Type::Table;
 }
 
+void LiveIntervals::Compute(const IR::Block& block) {
+    uses.clear();
+    u32 position = 0;
+    for (const auto& inst : block) {
+        for (size_t i = 0; i < inst.NumArgs(); i++) {
+            const auto arg = inst.GetArg(i);
+            if (!arg.IsImmediate() && !IsValuelessType(arg.GetType())) {
+                uses[arg.GetInst()].push_back(position);
+            }
+        }
+        position++;
+    }
+}
+
+u32 LiveIntervals::NextUse(const IR::Inst* value, u32 position) const noexcept {
+    const auto iter = uses.find(value);
+    if (iter == uses.end()) {
+        return no_use;
+    }
+    // Uses by the instruction at position count, as its arguments may not have been allocated yet.
+    const auto next = std::lower_bound(iter->second.begin(), iter->second.end(), position);
+    return next != iter->second.end() ? *next : no_use;
+}
+
 void HostLocInfo::ReleaseOne() noexcept {
     is_being_used_count--;
     is_scratch = false;
@@ -185,9 +210,10 @@ bool Argument::IsInMemory(RegAlloc& reg_alloc) const noexcept {
     return HostLocIsSpill(*reg_alloc.ValueLocation(value.GetInst()));
 }
 
-RegAlloc::RegAlloc(boost::container::static_vector<HostLoc, 28> gpr_order, boost::container::static_vector<HostLoc, 28> xmm_order) noexcept
+RegAlloc::RegAlloc(boost::container::static_vector<HostLoc, 28> gpr_order, boost::container::static_vector<HostLoc, 28> xmm_order, const LiveIntervals* live_intervals) noexcept
     : gpr_order(gpr_order),
-    xmm_order(xmm_order)
+    xmm_order(xmm_order),
+    live_intervals(live_intervals)
 {}
 
 RegAlloc::ArgumentInfo RegAlloc::GetArgumentInfo(const IR::Inst* inst) noexcept {
@@ -343,6 +369,7 @@ void RegAlloc::HostCall(
         return ret;
     }();
 
+    in_host_call = true;
     ScratchGpr(code, ABI_RETURN);
     if (result_def)
         DefineValueImpl(code, result_def, ABI_RETURN);
@@ -380,6 +407,7 @@ void RegAlloc::HostCall(
             }
         }
     }
+    in_host_call = false;
 }
 
 void RegAlloc::AllocStackSpace(BlockOfCode& code, const size_t stack_space) noexcept {
@@ -408,6 +436,8 @@ HostLoc RegAlloc::SelectARegister(const boost::container::static_vector<HostLoc,
     auto it_candidate = desired_locations.cend(); //default fallback if everything fails
     auto it_rex_candidate = desired_locations.cend();
     auto it_empty_candidate = desired_locations.cend();
+    auto it_furthest_candidate = desired_locations.cend();
+    u32 furthest_use = 0;
     for (auto it = desired_locations.cbegin(); it != desired_locations.cend(); it++) {
         auto const& loc_info = LocInfo(*it);
         DEBUG_ASSERT(*it != ABI_JIT_PTR);
@@ -423,6 +453,12 @@ HostLoc RegAlloc::SelectARegister(const boost::container::static_vector<HostLoc,
         } else if (loc_info.IsEmpty()) {
             it_empty_candidate = it;
             break;
+        // With live intervals at hand, spill the register that is needed again the furthest ahead
+        } else if (live_intervals) {
+            if (const u32 next_use = NextUse(loc_info); it_furthest_candidate == desired_locations.cend() || next_use > furthest_use) {
+                furthest_use = next_use;
+                it_furthest_candidate = it;
+            }
         // No empty registers for some reason (very evil) - just do normal LRU
         } else if (loc_info.lru_counter < min_lru_counter) {
             // Otherwise a "quasi"-LRU
@@ -440,12 +476,14 @@ HostLoc RegAlloc::SelectARegister(const boost::container::static_vector<HostLoc,
     }
     // Final resolution goes as follows:
     // 1 => Try an empty candidate
-    // 2 => Try normal candidate (no REX prefix)
-    // 3 => Try using a REX prefixed one
+    // 2 => Try the candidate used furthest ahead (with live intervals only)
+    // 3 => Try normal candidate (no REX prefix)
+    // 4 => Try using a REX prefixed one
     // We avoid using REX-addressable registers because they add +1 REX prefix which
     // do we really need? The trade-off may not be worth it.
     auto const it_final = it_empty_candidate != desired_locations.cend()
-        ? it_empty_candidate : it_candidate != desired_locations.cend()
+        ? it_empty_candidate : it_furthest_candidate != desired_locations.cend()
+        ? it_furthest_candidate : it_candidate != desired_locations.cend()
         ? it_candidate : it_rex_candidate;
     ASSERT(it_final != desired_locations.cend() && "All candidate registers have already been allocated");
     // Evil magic - increment LRU counter (will wrap at 256)
@@ -512,6 +550,13 @@ void RegAlloc::Exchange(BlockOfCode& code, HostLoc a, HostLoc b) noexcept {
 void RegAlloc::MoveOutOfTheWay(BlockOfCode& code, HostLoc reg) noexcept {
     ASSERT(!LocInfo(reg).IsLocked());
     if (!LocInfo(reg).IsEmpty()) {
+        if (live_intervals) {
+            // A register-to-register move is cheaper than the spill and the reload that follows it.
+            if (const auto free_reg = FindFreeRegister(reg)) {
+                Move(code, *free_reg, reg);
+                return;
+            }
+        }
         SpillRegister(code, reg);
     }
 }
@@ -548,6 +593,34 @@ HostLoc RegAlloc::FindFreeSpill(bool is_xmm) const noexcept {
     UNREACHABLE();
 }
 
+std::optional<HostLoc> RegAlloc::FindFreeRegister(HostLoc loc) const noexcept {
+    const auto is_caller_save = [](HostLoc candidate) {
+        return std::find(ABI_ALL_CALLER_SAVE.begin(), ABI_ALL_CALLER_SAVE.end(), candidate) != ABI_ALL_CALLER_SAVE.end();
+    };
+    // Callee-saved registers are preferred, as host calls would move values out of the others again.
+    std::optional<HostLoc> caller_save_candidate;
+    for (auto const candidate : HostLocIsXMM(loc) ? xmm_order : gpr_order) {
+        // R13 to R15 are avoided for the same reasons as in SelectARegister
+        if (candidate == loc || (candidate >= HostLoc::R13 && candidate <= HostLoc::R15) || !LocInfo(candidate).IsEmpty()) {
+            continue;
+        }
+        if (!is_caller_save(candidate)) {
+            return candidate;
+        }
+        if (!in_host_call && !caller_save_candidate) {
+            caller_save_candidate = candidate;
+        }
+    }
+    return caller_save_candidate;
+}
+
+u32 RegAlloc::NextUse(const HostLocInfo& loc_info) const noexcept {
+    u32 next_use = LiveIntervals::no_use;
+    for (auto const value : loc_info.values)
+        next_use = std::min(next_use, live_intervals->NextUse(value, position));
+    return next_use;
+}
+
 #define MAYBE_AVX(OPCODE, ...) \
     [&] { \
         if (code.HasHostFeature(HostFeature::AVX)) code.v##OPCODE(__VA_ARGS__); \
@@ -10,8 +10,11 @@
 
 #include <array>
 #include <functional>
+#include <limits>
 #include <optional>
 
+#include <ankerl/unordered_dense.h>
+
 #include "boost/container/small_vector.hpp"
 #include "dynarmic/common/common_types.h"
 #include <xbyak/xbyak.h>
@@ -30,6 +33,7 @@
 
 namespace Dynarmic::IR {
 enum class AccType;
+class Block;
 }  // namespace Dynarmic::IR
 
 namespace Dynarmic::Backend::X64 {
@@ -141,11 +145,28 @@ private:
     bool allocated = false; //1
 };
 
+/// Live intervals of the values in a block, as the positions of the instructions that use them.
+/// Positions count instructions from the start of the block.
+class LiveIntervals {
+public:
+    static constexpr u32 no_use = (std::numeric_limits<u32>::max)();
+
+    void Compute(const IR::Block& block);
+
+    /// Returns the position of the first use of value after position, or no_use.
+    u32 NextUse(const IR::Inst* value, u32 position) const noexcept;
+
+private:
+    ankerl::unordered_dense::map<const IR::Inst*, boost::container::small_vector<u32, 4>> uses;
+};
+
 class RegAlloc final {
 public:
     using ArgumentInfo = std::array<Argument, IR::max_arg_count>;
     RegAlloc() noexcept = default;
-    RegAlloc(boost::container::static_vector<HostLoc, 28> gpr_order, boost::container::static_vector<HostLoc, 28> xmm_order) noexcept;
+    /// With live_intervals, registers are spilled in order of next use and values are moved
+    /// out of the way into free registers rather than onto the stack where possible.
+    RegAlloc(boost::container::static_vector<HostLoc, 28> gpr_order, boost::container::static_vector<HostLoc, 28> xmm_order, const LiveIntervals* live_intervals = nullptr) noexcept;
 
     ArgumentInfo GetArgumentInfo(const IR::Inst* inst) noexcept;
     void RegisterPseudoOperation(const IR::Inst* inst) noexcept;
@@ -210,6 +231,10 @@ public:
         for (auto& iter : hostloc_info)
             iter.ReleaseAll();
     }
+    /// Moves on to the next instruction of the block.
+    inline void EndOfInstruction() noexcept {
+        position++;
+    }
     inline void AssertNoMoreUses() noexcept {
         ASSERT(std::all_of(hostloc_info.begin(), hostloc_info.end(), [](const auto& i) noexcept { return i.IsEmpty(); }));
     }
@@ -236,6 +261,8 @@ private:
 
     void SpillRegister(BlockOfCode& code, HostLoc loc) noexcept;
     HostLoc FindFreeSpill(bool is_xmm) const noexcept;
+    std::optional<HostLoc> FindFreeRegister(HostLoc loc) const noexcept;
+    u32 NextUse(const HostLocInfo& loc_info) const noexcept;
 
     inline HostLocInfo& LocInfo(const HostLoc loc) noexcept {
         ASSERT(loc != HostLoc::RSP && loc != ABI_JIT_PTR);
@@ -254,6 +281,11 @@ private:
     alignas(64) boost::container::static_vector<HostLoc, 28> xmm_order;
     alignas(64) std::array<HostLocInfo, NonSpillHostLocCount + SpillCount> hostloc_info;
     size_t reserved_stack_space = 0;
+    const LiveIntervals* live_intervals = nullptr;
+    /// Position of the instruction being emitted, for live_intervals.
+    u32 position = 0;
+    /// Set while registers are set up for a host call, which clobbers the caller-saved ones.
+    bool in_host_call = false;
 };
 // Ensure a cache line (or less) is used, this is primordial
 static_assert(sizeof(boost::container::static_vector<HostLoc, 28>) == 40);
@@ -49,6 +49,14 @@ public:
         Inst(Opcode::A64SetCheckBit, value);
     }
 
+    void SideExitIf(IR::Cond cond, const LocationDescriptor& target, size_t cycles) noexcept {
+        Inst(Opcode::A64SideExitIf, IR::Value{cond}, Imm64(target.UniqueHash()), Imm64(cycles));
+    }
+
+    void SideExitIfCheckBit(bool check_bit, const LocationDescriptor& target, size_t cycles) noexcept {
+        Inst(Opcode::A64SideExitIfCheckBit, Imm1(check_bit), Imm64(target.UniqueHash()), Imm64(cycles));
+    }
+
     IR::U1 GetCFlag() noexcept {
         return Inst<IR::U1>(Opcode::A64GetCFlag);
     }
@@ -17,9 +17,14 @@
 namespace Dynarmic::A64 {
 
 IR::Block Translate(LocationDescriptor descriptor, MemoryReadCodeFuncType memory_read_code, TranslationOptions options) {
+    IR::Block block{descriptor};
+    Translate(block, descriptor, std::move(memory_read_code), std::move(options));
+    return block;
+}
+
+void Translate(IR::Block& block, LocationDescriptor descriptor, MemoryReadCodeFuncType memory_read_code, TranslationOptions options) {
     const bool single_step = descriptor.SingleStepping();
 
-    IR::Block block{descriptor};
     TranslatorVisitor visitor{block, descriptor, std::move(options)};
 
     bool should_continue = true;
@@ -36,7 +41,12 @@ IR::Block Translate(LocationDescriptor descriptor, MemoryReadCodeFuncType memory
             should_continue = visitor.RaiseException(Exception::NoExecuteFault);
         }
 
-        visitor.ir.current_location = visitor.ir.current_location->AdvancePC(4);
+        if (visitor.trace_continuation) {
+            visitor.ir.current_location = *visitor.trace_continuation;
+            visitor.trace_continuation.reset();
+        } else {
+            visitor.ir.current_location = visitor.ir.current_location->AdvancePC(4);
+        }
         block.CycleCount()++;
     } while (should_continue && !single_step);
 
@@ -47,8 +57,6 @@ IR::Block Translate(LocationDescriptor descriptor, MemoryReadCodeFuncType memory
     ASSERT(block.HasTerminal() && "Terminal has not been set");
 
     block.SetEndLocation(*visitor.ir.current_location);
-
-    return block;
 }
 
 bool TranslateSingleInstruction(IR::Block& block, LocationDescriptor descriptor, u32 instruction) {
@@ -11,6 +11,7 @@
 #include <optional>
 
 #include "dynarmic/common/common_types.h"
+#include "dynarmic/frontend/A64/a64_location_descriptor.h"
 
 namespace Dynarmic {
 
@@ -20,8 +21,6 @@ class Block;
 
 namespace A64 {
 
-class LocationDescriptor;
-
 using MemoryReadCodeFuncType = std::function<std::optional<u32>(u64 vaddr)>;
 
 struct TranslationOptions {
@@ -38,6 +37,12 @@ struct TranslationOptions {
     /// If this is false, we treat the instruction as a NOP.
     /// If this is true, we emit an ExceptionRaised instruction.
     bool hook_hint_instructions = true;
+
+    /// If set, translation continues across forward direct branches, so that one block covers a
+    /// whole hot path (a trace). At a conditional branch this is given both possible successors
+    /// and returns the one to continue at; leaving for the other becomes a side exit.
+    /// Returning nothing ends the block at the branch as usual.
+    std::function<std::optional<LocationDescriptor>(LocationDescriptor, LocationDescriptor)> trace_successor;
 };
 
 /**
@@ -49,6 +54,12 @@ struct TranslationOptions {
  */
 IR::Block Translate(LocationDescriptor descriptor, MemoryReadCodeFuncType memory_read_code, TranslationOptions options);
 
+/**
+ * Like the above, but translates into an existing block instead of returning a new one.
+ * @param block An empty block, constructed at descriptor.
+ */
+void Translate(IR::Block& block, LocationDescriptor descriptor, MemoryReadCodeFuncType memory_read_code, TranslationOptions options);
+
 /**
  * This function translates a single provided instruction into our intermediate representation.
  * @param block The block to append the IR for the instruction to.
@@ -14,10 +14,9 @@ bool TranslatorVisitor::B_cond(Imm<19> imm19, Cond cond) {
     const s64 offset = concatenate(imm19, Imm<2>{0}).SignExtend<s64>();
     const u64 target = ir.PC() + offset;
 
-    const auto cond_pass = IR::Term::LinkBlock{ir.current_location->SetPC(target)};
-    const auto cond_fail = IR::Term::LinkBlock{ir.current_location->AdvancePC(4)};
-    ir.SetTerm(IR::Term::If{cond, cond_pass, cond_fail});
-    return false;
+    const auto cond_pass = ir.current_location->SetPC(target);
+    const auto cond_fail = ir.current_location->AdvancePC(4);
+    return BranchIfCond(cond, cond_pass, cond_fail);
 }
 
 bool TranslatorVisitor::B_uncond(Imm<26> imm26) {
@@ -28,6 +27,9 @@ bool TranslatorVisitor::B_uncond(Imm<26> imm26) {
         ir.SetTerm(IR::Term::LinkBlock{ir.current_location->SetPC(target)});
         return false;
     }
+    if (CanExtendTraceTo(ir.current_location->SetPC(target))) {
+        return ExtendTrace(ir.current_location->SetPC(target));
+    }
     ir.SetTerm(IR::Term::LinkBlockFast{ir.current_location->SetPC(target)});
     return false;
 }
@@ -79,10 +81,9 @@ bool TranslatorVisitor::CBZ(bool sf, Imm<19> imm19, Reg Rt) {
     ir.SetCheckBit(ir.IsZero(operand1));
 
     const u64 target = ir.PC() + offset;
-    const auto cond_pass = IR::Term::LinkBlock{ir.current_location->SetPC(target)};
-    const auto cond_fail = IR::Term::LinkBlock{ir.current_location->AdvancePC(4)};
-    ir.SetTerm(IR::Term::CheckBit{cond_pass, cond_fail});
-    return false;
+    const auto cond_pass = ir.current_location->SetPC(target);
+    const auto cond_fail = ir.current_location->AdvancePC(4);
+    return BranchIfCheckBit(cond_pass, cond_fail);
 }
 
 bool TranslatorVisitor::CBNZ(bool sf, Imm<19> imm19, Reg Rt) {
@@ -94,10 +95,9 @@ bool TranslatorVisitor::CBNZ(bool sf, Imm<19> imm19, Reg Rt) {
     ir.SetCheckBit(ir.IsZero(operand1));
 
     const u64 target = ir.PC() + offset;
-    const auto cond_pass = IR::Term::LinkBlock{ir.current_location->AdvancePC(4)};
-    const auto cond_fail = IR::Term::LinkBlock{ir.current_location->SetPC(target)};
-    ir.SetTerm(IR::Term::CheckBit{cond_pass, cond_fail});
-    return false;
+    const auto cond_pass = ir.current_location->AdvancePC(4);
+    const auto cond_fail = ir.current_location->SetPC(target);
+    return BranchIfCheckBit(cond_pass, cond_fail);
 }
 
 bool TranslatorVisitor::TBZ(Imm<1> b5, Imm<5> b40, Imm<14> imm14, Reg Rt) {
@@ -110,10 +110,9 @@ bool TranslatorVisitor::TBZ(Imm<1> b5, Imm<5> b40, Imm<14> imm14, Reg Rt) {
     ir.SetCheckBit(ir.TestBit(operand, ir.Imm8(bit_pos)));
 
     const u64 target = ir.PC() + offset;
-    const auto cond_1 = IR::Term::LinkBlock{ir.current_location->AdvancePC(4)};
-    const auto cond_0 = IR::Term::LinkBlock{ir.current_location->SetPC(target)};
-    ir.SetTerm(IR::Term::CheckBit{cond_1, cond_0});
-    return false;
+    const auto cond_1 = ir.current_location->AdvancePC(4);
+    const auto cond_0 = ir.current_location->SetPC(target);
+    return BranchIfCheckBit(cond_1, cond_0);
 }
 
 bool TranslatorVisitor::TBNZ(Imm<1> b5, Imm<5> b40, Imm<14> imm14, Reg Rt) {
@@ -126,10 +125,9 @@ bool TranslatorVisitor::TBNZ(Imm<1> b5, Imm<5> b40, Imm<14> imm14, Reg Rt) {
     ir.SetCheckBit(ir.TestBit(operand, ir.Imm8(bit_pos)));
 
     const u64 target = ir.PC() + offset;
-    const auto cond_1 = IR::Term::LinkBlock{ir.current_location->SetPC(target)};
-    const auto cond_0 = IR::Term::LinkBlock{ir.current_location->AdvancePC(4)};
-    ir.SetTerm(IR::Term::CheckBit{cond_1, cond_0});
-    return false;
+    const auto cond_1 = ir.current_location->SetPC(target);
+    const auto cond_0 = ir.current_location->AdvancePC(4);
+    return BranchIfCheckBit(cond_1, cond_0);
 }
 
 }  // namespace Dynarmic::A64
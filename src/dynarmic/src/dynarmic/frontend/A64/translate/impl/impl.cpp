@@ -16,6 +16,58 @@
 
 namespace Dynarmic::A64 {
 
+// A trace only ever moves forward within a short window of its start. Guest code covered by
+// the block then stays one contiguous range, as block invalidation and caching expect.
+constexpr u64 max_trace_span = 1024;
+constexpr size_t max_trace_side_exits = 16;
+
+bool TranslatorVisitor::CanExtendTraceTo(LocationDescriptor next) const {
+    const u64 start_pc = LocationDescriptor{ir.block.Location()}.PC();
+    return options.trace_successor
+        && next.PC() > ir.PC()
+        && next.PC() - start_pc < max_trace_span
+        && trace_side_exits < max_trace_side_exits;
+}
+
+bool TranslatorVisitor::ExtendTrace(LocationDescriptor next) {
+    trace_continuation = next;
+    return true;
+}
+
+bool TranslatorVisitor::BranchIfCond(Cond cond, LocationDescriptor then_, LocationDescriptor else_) {
+    if (cond != Cond::AL && cond != Cond::NV && options.trace_successor) {
+        if (const auto next = options.trace_successor(then_, else_); next && CanExtendTraceTo(*next)) {
+            const size_t cycles = ir.block.CycleCount() + 1;
+            if (*next == then_) {
+                ir.SideExitIf(IR::Invert(cond), else_, cycles);
+            } else {
+                ir.SideExitIf(cond, then_, cycles);
+            }
+            ++trace_side_exits;
+            return ExtendTrace(*next);
+        }
+    }
+    ir.SetTerm(IR::Term::If{cond, IR::Term::LinkBlock{then_}, IR::Term::LinkBlock{else_}});
+    return false;
+}
+
+bool TranslatorVisitor::BranchIfCheckBit(LocationDescriptor then_, LocationDescriptor else_) {
+    if (options.trace_successor) {
+        if (const auto next = options.trace_successor(then_, else_); next && CanExtendTraceTo(*next)) {
+            const size_t cycles = ir.block.CycleCount() + 1;
+            if (*next == then_) {
+                ir.SideExitIfCheckBit(false, else_, cycles);
+            } else {
+                ir.SideExitIfCheckBit(true, then_, cycles);
+            }
+            ++trace_side_exits;
+            return ExtendTrace(*next);
+        }
+    }
+    ir.SetTerm(IR::Term::CheckBit{IR::Term::LinkBlock{then_}, IR::Term::LinkBlock{else_}});
+    return false;
+}
+
 bool TranslatorVisitor::InterpretThisInstruction() {
     ir.SetTerm(IR::Term::Interpret(*ir.current_location));
     return false;
@@ -24,6 +24,15 @@ struct TranslatorVisitor final {
     A64::IREmitter ir;
     TranslationOptions options;
 
+    /// Where translation resumes after the current instruction when it is not the next one.
+    std::optional<LocationDescriptor> trace_continuation;
+    size_t trace_side_exits = 0;
+
+    bool CanExtendTraceTo(LocationDescriptor next) const;
+    bool ExtendTrace(LocationDescriptor next);
+    bool BranchIfCond(Cond cond, LocationDescriptor then_, LocationDescriptor else_);
+    bool BranchIfCheckBit(LocationDescriptor then_, LocationDescriptor else_);
+
     bool InterpretThisInstruction();
     bool UnpredictableInstruction();
     bool DecodeError();
@@ -15,6 +15,7 @@
 #include <vector>
 
 #include "dynarmic/interface/A32/config.h"
+#include "dynarmic/interface/code_cache_statistics.h"
 #include "dynarmic/interface/halt_reason.h"
 
 namespace Dynarmic {
@@ -92,6 +93,10 @@ public:
         return is_executing;
     }
 
+    /// Returns how much emitted code has had to be thrown away to make room for new code.
+    /// Must not be called while another thread is running this JIT.
+    CodeCacheStatistics GetCodeCacheStatistics() const;
+
     /// @brief Disassemble the instructions following the current pc and return
     /// the resulting instructions as a vector of their string representations.
     std::string Disassemble() const;
@@ -92,6 +92,8 @@ struct UserCallbacks : public TranslateCallbacks {
     virtual void MemoryWrite64(VAddr vaddr, std::uint64_t value) = 0;
 
     // Writes through these callbacks may not be aligned.
+    // They must only write if memory still holds expected, atomically. The global monitor relies on
+    // this to fail stores racing with an exclusive store made by another processor.
     virtual bool MemoryWriteExclusive8(VAddr /*vaddr*/, std::uint8_t /*value*/, std::uint8_t /*expected*/) { return false; }
     virtual bool MemoryWriteExclusive16(VAddr /*vaddr*/, std::uint16_t /*value*/, std::uint16_t /*expected*/) { return false; }
     virtual bool MemoryWriteExclusive32(VAddr /*vaddr*/, std::uint32_t /*value*/, std::uint32_t /*expected*/) { return false; }
@@ -125,7 +127,7 @@ struct UserCallbacks : public TranslateCallbacks {
 struct UserConfig {
     bool HasOptimization(OptimizationFlag f) const {
         if (!unsafe_optimizations) {
-            f &= all_safe_optimizations;
+            f &= all_safe_optimizations | all_opt_in_optimizations;
         }
         return (f & optimizations) != no_optimizations;
     }
@@ -10,6 +10,7 @@
 #include <cstdint>
 #include <memory>
 #include <optional>
+#include <vector>
 
 #include "dynarmic/interface/optimization_flags.h"
 
@@ -88,6 +89,13 @@ struct UserCallbacks {
     // Memory must be interpreted as little endian.
     virtual std::optional<std::uint32_t> MemoryReadCode(VAddr vaddr) { return MemoryRead32(vaddr); }
 
+    // Reads code for UserConfig::speculative_compilation. This is called from the JIT's compile
+    // thread, concurrently with the thread running the JIT, and is the only callback called there.
+    // Return std::nullopt for memory that cannot be read safely from that thread; blocks that need
+    // it are then translated when they are first run instead.
+    // All reads through this callback are 4-byte aligned.
+    virtual std::optional<std::uint32_t> MemoryReadCodeSpeculative(VAddr /*vaddr*/) { return std::nullopt; }
+
     // Reads through these callbacks may not be aligned.
     virtual std::uint8_t MemoryRead8(VAddr vaddr) = 0;
     virtual std::uint16_t MemoryRead16(VAddr vaddr) = 0;
@@ -103,6 +111,8 @@ struct UserCallbacks {
     virtual void MemoryWrite128(VAddr vaddr, Vector value) = 0;
 
     // Writes through these callbacks may not be aligned.
+    // They must only write if memory still holds expected, atomically. The global monitor relies on
+    // this to fail stores racing with an exclusive store made by another processor.
     virtual bool MemoryWriteExclusive8(VAddr /*vaddr*/, std::uint8_t /*value*/, std::uint8_t /*expected*/) { return false; }
     virtual bool MemoryWriteExclusive16(VAddr /*vaddr*/, std::uint16_t /*value*/, std::uint16_t /*expected*/) { return false; }
     virtual bool MemoryWriteExclusive32(VAddr /*vaddr*/, std::uint32_t /*value*/, std::uint32_t /*expected*/) { return false; }
@@ -135,6 +145,23 @@ struct UserCallbacks {
     virtual std::uint64_t GetCNTPCT() = 0;
 };
 
+/// Persistent storage for translated blocks, implemented by the user of this library.
+/// Entries are opaque to the user and are keyed by the unique hash of a block's location
+/// descriptor. The JIT checks every entry against the guest code it was translated from
+/// before using it, so stale entries are harmless.
+/// These functions may be called concurrently by JIT instances that share the cache.
+class TranslationCache {
+public:
+    virtual ~TranslationCache() = default;
+
+    /// Fills data with the entry stored for location and returns true, or returns false if
+    /// there is no such entry.
+    virtual bool Load(std::uint64_t location, std::vector<std::uint8_t>& data) = 0;
+
+    /// Stores an entry for location, replacing any existing one.
+    virtual void Store(std::uint64_t location, const std::vector<std::uint8_t>& data) = 0;
+};
+
 struct UserConfig {
     /// Fastmem Pointer
     /// This should point to the beginning of a 2^page_table_address_space_bits bytes
@@ -147,6 +174,16 @@ struct UserConfig {
 
     ExclusiveMonitor* global_monitor = nullptr;
 
+    /// If set, optimized IR for every translated block is saved here and reused instead of
+    /// translating the block again, as long as the guest code it came from is unchanged.
+    TranslationCache* translation_cache = nullptr;
+
+    /// When set to true, the JIT translates the blocks that newly emitted blocks branch to
+    /// directly on a thread of its own, before they first run. That thread reads code through
+    /// UserCallbacks::MemoryReadCodeSpeculative, which must be overridden for this to have any
+    /// effect.
+    bool speculative_compilation = false;
+
     /// Pointer to where TPIDRRO_EL0 is stored. This pointer will be inserted into
     /// emitted code.
     const std::uint64_t* tpidrro_el0 = nullptr;
@@ -168,6 +205,14 @@ struct UserConfig {
     /// This is intended to be used for debugging.
     OptimizationFlag optimizations = all_safe_optimizations;
 
+    /// Number of times a block has to run before it is recompiled with all optimizations.
+    /// Only used with OptimizationFlag::TieredCompilation.
+    std::uint32_t tier_up_threshold = 64;
+
+    /// Number of times a fully optimized block has to run before it is retranslated as a trace.
+    /// Only used with OptimizationFlag::TraceFormation.
+    std::uint32_t trace_threshold = 1000;
+
     /// Declares how many valid address bits are there in virtual addresses.
     /// Determines the size of page_table. Valid values are between 12 and 64 inclusive.
     /// This is only used if page_table is not nullptr.
@@ -298,7 +343,7 @@ struct UserConfig {
 
     inline bool HasOptimization(OptimizationFlag f) const {
         if (!unsafe_optimizations) {
-            f &= all_safe_optimizations;
+            f &= all_safe_optimizations | all_opt_in_optimizations;
         }
         return (f & optimizations) != no_optimizations;
     }
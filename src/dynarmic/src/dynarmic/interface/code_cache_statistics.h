@@ -0,0 +1,34 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+namespace Dynarmic {
+
+/// How much code a JIT has compiled, and how often it has had to throw away emitted code to make
+/// room for new code.
+struct CodeCacheStatistics {
+    /// Number of blocks compiled, counting recompilations of the same location.
+    std::uint64_t compiled_blocks = 0;
+    /// Number of guest instructions in those blocks.
+    std::uint64_t compiled_instructions = 0;
+    /// Bytes of host code emitted for those blocks.
+    std::uint64_t emitted_bytes = 0;
+    /// Time spent translating, optimizing and emitting those blocks.
+    std::chrono::nanoseconds compile_time{};
+
+    /// Number of times the least recently used region of the code cache was evicted.
+    std::uint64_t region_evictions = 0;
+    /// Number of blocks dropped by those evictions.
+    std::uint64_t evicted_blocks = 0;
+    /// Number of times the whole code cache was cleared, either on request or because it was
+    /// too small to be split into regions.
+    std::uint64_t full_clears = 0;
+    /// Time spent on evictions and clears, not counting recompilation of the dropped blocks.
+    std::chrono::nanoseconds eviction_time{};
+};
+
+}  // namespace Dynarmic
@@ -6,18 +6,22 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
-#include <boost/container/static_vector.hpp>
-
-#include <dynarmic/common/spin_lock.h>
+#include <type_traits>
 
 namespace Dynarmic {
 
 using VAddr = std::uint64_t;
 using Vector = std::array<std::uint64_t, 2>;
 
+/// Global exclusive monitor shared by all processors, without locks.
+/// Every processor has a reservation slot. An exclusive load records in it the address and the
+/// version of the address's granule. An exclusive store commits by advancing the version with a
+/// compare-and-swap, so that at most one exclusive store commits per version and every other
+/// reservation of the address is invalidated.
 class ExclusiveMonitor {
 public:
     /// @param processor_count Maximum number of processors using this global
@@ -33,12 +37,14 @@ public:
     T ReadAndMark(size_t processor_id, VAddr address, Function op) {
         static_assert(std::is_trivially_copyable_v<T>);
         const VAddr masked_address = address & RESERVATION_GRANULE_MASK;
+        Reservation& reservation = reservations[processor_id];
 
-        Lock();
-        exclusive_addresses[processor_id] = masked_address;
+        // The version is read before the value, so any store that commits after the value
+        // has been read also moves the version on.
+        reservation.version = VersionOf(masked_address).load(std::memory_order_acquire);
         const T value = op();
-        std::memcpy(exclusive_values[processor_id].data(), &value, sizeof(T));
-        Unlock();
+        std::memcpy(reservation.value.data(), &value, sizeof(T));
+        reservation.address.store(masked_address, std::memory_order_release);
         return value;
     }
 
@@ -54,11 +60,8 @@ public:
         }
 
         T saved_value;
-        std::memcpy(&saved_value, exclusive_values[processor_id].data(), sizeof(T));
-        const bool result = op(saved_value);
-
-        Unlock();
-        return result;
+        std::memcpy(&saved_value, reservations[processor_id].value.data(), sizeof(T));
+        return op(saved_value);
     }
 
     /// Unmark everything.
@@ -67,22 +70,41 @@ public:
     void ClearProcessor(size_t processor_id);
 
 private:
+    struct alignas(64) Reservation {
+        std::atomic<VAddr> address{INVALID_EXCLUSIVE_ADDRESS};
+        /// Only accessed by the processor owning the reservation.
+        std::uint64_t version = 0;
+        Vector value{};
+    };
+
+    struct alignas(64) Version {
+        std::atomic<std::uint64_t> value{0};
+    };
+
     bool CheckAndClear(size_t processor_id, VAddr address);
 
-    void Lock();
-    void Unlock();
+    std::atomic<std::uint64_t>& VersionOf(VAddr address) {
+        return versions[((address >> VERSION_GRANULE_BITS) * 0x9E3779B97F4A7C15ULL) >> (64 - NUM_VERSIONS_BITS)].value;
+    }
 
-    friend volatile int* GetExclusiveMonitorLockPointer(ExclusiveMonitor*);
     friend size_t GetExclusiveMonitorProcessorCount(ExclusiveMonitor*);
-    friend VAddr* GetExclusiveMonitorAddressPointer(ExclusiveMonitor*, size_t index);
+    friend std::atomic<VAddr>* GetExclusiveMonitorAddressPointer(ExclusiveMonitor*, size_t index);
+    friend std::uint64_t* GetExclusiveMonitorVersionPointer(ExclusiveMonitor*, size_t index);
     friend Vector* GetExclusiveMonitorValuePointer(ExclusiveMonitor*, size_t index);
+    friend void* GetExclusiveMonitorVersionTable(ExclusiveMonitor*);
 
     static constexpr VAddr RESERVATION_GRANULE_MASK = 0xFFFF'FFFF'FFFF'FFFFull;
     static constexpr VAddr INVALID_EXCLUSIVE_ADDRESS = 0xDEAD'DEAD'DEAD'DEADull;
     static constexpr size_t MAX_NUM_CPU_CORES = 4; // Sync with src/core/hardware_properties
-    boost::container::static_vector<VAddr, MAX_NUM_CPU_CORES> exclusive_addresses;
-    boost::container::static_vector<Vector, MAX_NUM_CPU_CORES> exclusive_values;
-    SpinLock lock;
+
+    /// Addresses in the same 16 bytes, or that otherwise hash to the same version, invalidate each
+    /// other's reservations. That only causes spurious store failures, which are permitted.
+    static constexpr size_t VERSION_GRANULE_BITS = 4;
+    static constexpr size_t NUM_VERSIONS_BITS = 8;
+
+    size_t processor_count;
+    std::array<Reservation, MAX_NUM_CPU_CORES> reservations;
+    std::array<Version, size_t{1} << NUM_VERSIONS_BITS> versions;
 };
 
 }  // namespace Dynarmic
@@ -39,6 +39,24 @@ enum class OptimizationFlag : std::uint32_t {
     CodeSpeed = 0x00000040,
     /// Disable verification passes
     DisableVerification = 0x00000080,
+    /// This optimization retranslates frequently run A64 blocks into traces that continue across
+    /// forward branches along their usual path, leaving through side exits when it is not taken.
+    /// This is a safe optimization, but is only used when enabled explicitly.
+    TraceFormation = 0x00000100,
+    /// This optimization first emits A64 blocks with only the most necessary IR passes, and
+    /// recompiles those that run often with all enabled IR optimizations.
+    /// This is a safe optimization, but is only used when enabled explicitly.
+    TieredCompilation = 0x00000200,
+    /// This optimization computes live intervals over each block for the register allocator of
+    /// the x64 backend. Registers are then spilled in order of next use, and values in registers
+    /// needed for calls and fixed operands move to free registers instead of onto the stack.
+    /// This is a safe optimization, but is only used when enabled explicitly.
+    LiveIntervalRegAlloc = 0x00000400,
+    /// This is an IR optimization. This optimization forwards values stored to memory to later
+    /// loads of the same address within an A64 block, and removes repeated loads of an address
+    /// that has not been written to in between. Removed loads do not reach the memory callbacks.
+    /// This is a safe optimization, but is only used when enabled explicitly.
+    MemoryForwarding = 0x00000800,
 
     /// This is an UNSAFE optimization that reduces accuracy of fused multiply-add operations.
     /// This unfuses fused instructions to improve performance on host CPUs without FMA support.
@@ -59,7 +77,10 @@ enum class OptimizationFlag : std::uint32_t {
 };
 
 constexpr OptimizationFlag no_optimizations = static_cast<OptimizationFlag>(0);
-constexpr OptimizationFlag all_safe_optimizations = static_cast<OptimizationFlag>(0x0000FFFF);
+/// Safe optimizations that are new enough to be left out of all_safe_optimizations. Users of the
+/// library opt in to these.
+constexpr OptimizationFlag all_opt_in_optimizations = static_cast<OptimizationFlag>(0x00000F00);
+constexpr OptimizationFlag all_safe_optimizations = static_cast<OptimizationFlag>(0x0000F0FF);
 
 constexpr OptimizationFlag operator~(OptimizationFlag f) {
     return static_cast<OptimizationFlag>(~static_cast<std::uint32_t>(f));
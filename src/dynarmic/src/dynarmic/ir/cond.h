@@ -28,4 +28,9 @@ enum class Cond {
     LO = CC,
 };
 
+/// Returns the condition that holds exactly when cond does not. cond must not be AL or NV.
+constexpr Cond Invert(Cond cond) {
+    return static_cast<Cond>(static_cast<int>(cond) ^ 1);
+}
+
 }  // namespace Dynarmic::IR
@@ -190,6 +190,7 @@ constexpr bool ReadsFromCPSR(const Opcode op) noexcept {
     case Opcode::A32UpdateUpperLocationDescriptor:
     case Opcode::A64GetCFlag:
     case Opcode::A64GetNZCVRaw:
+    case Opcode::A64SideExitIf:
     case Opcode::ConditionalSelect32:
     case Opcode::ConditionalSelect64:
     case Opcode::ConditionalSelectNZCV:
@@ -589,10 +590,18 @@ constexpr bool IsSetCheckBitOperation(const Opcode op) noexcept {
         || op == Opcode::A64SetCheckBit;
 }
 
+/// @brief Determines whether or not this instruction may leave the block before its terminal.
+constexpr bool IsSideExit(const Opcode op) noexcept {
+    return op == Opcode::A64SideExitIf
+        || op == Opcode::A64SideExitIfCheckBit
+        || op == Opcode::A64CountBlockExecution;
+}
+
 /// @brief Determines whether or not this instruction may have side-effects.
 constexpr bool MayHaveSideEffects(const Opcode op) noexcept {
     return op == Opcode::PushRSB
         || op == Opcode::CallHostFunction
+        || IsSideExit(op)
         || op == Opcode::A64DataCacheOperationRaised
         || op == Opcode::A64InstructionCacheOperationRaised
         || IsSetCheckBitOperation(op)
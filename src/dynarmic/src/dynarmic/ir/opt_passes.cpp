@@ -614,6 +614,18 @@ static void A64GetSetElimination(IR::Block& block) {
             do_set(nzcv_info, inst->GetArg(0), inst, TrackingType::NZCVRaw);
             break;
         }
+        case IR::Opcode::A64SideExitIf:
+        case IR::Opcode::A64SideExitIfCheckBit:
+        case IR::Opcode::A64CountBlockExecution: {
+            // State must be complete wherever the block may be left, so earlier sets have to stay;
+            // the tracked values themselves remain good for the rest of the block.
+            const auto keep_sets = [](RegisterInfo& info) { info.set_instruction_present = false; };
+            std::for_each(reg_info.begin(), reg_info.end(), keep_sets);
+            std::for_each(vec_info.begin(), vec_info.end(), keep_sets);
+            keep_sets(sp_info);
+            keep_sets(nzcv_info);
+            break;
+        }
         default: {
             if (ReadsFromCPSR(opcode) || WritesToCPSR(opcode)) {
                 nzcv_info = {};
@@ -629,6 +641,134 @@ static void A64GetSetElimination(IR::Block& block) {
     }
 }
 
+static size_t A64MemoryAccessBytes(IR::Opcode opcode) {
+    switch (opcode) {
+    case IR::Opcode::A64ReadMemory8:
+    case IR::Opcode::A64WriteMemory8:
+        return 1;
+    case IR::Opcode::A64ReadMemory16:
+    case IR::Opcode::A64WriteMemory16:
+        return 2;
+    case IR::Opcode::A64ReadMemory32:
+    case IR::Opcode::A64WriteMemory32:
+        return 4;
+    case IR::Opcode::A64ReadMemory64:
+    case IR::Opcode::A64WriteMemory64:
+        return 8;
+    case IR::Opcode::A64ReadMemory128:
+    case IR::Opcode::A64WriteMemory128:
+        return 16;
+    default:
+        UNREACHABLE();
+    }
+}
+
+/// Forwards stored values to later loads of the same address, and replaces loads of an address
+/// that was loaded before, as long as nothing in between may have written to it.
+/// Addresses are compared as a base value plus a constant offset; accesses relative to different
+/// bases are assumed to alias. Barriers, exclusive and ordered accesses, and anything that calls
+/// out of the JIT forget everything known about memory.
+static void A64MemoryForwardingPass(IR::Block& block) {
+    struct KnownValue {
+        const IR::Inst* base;  ///< nullptr for absolute addresses
+        u64 offset;
+        size_t bytes;
+        IR::Value value;
+    };
+    /// Bounds the work per access; the oldest values are forgotten first.
+    constexpr size_t max_known_values = 32;
+    boost::container::small_vector<KnownValue, max_known_values> known;
+
+    const auto decompose_address = [](IR::Value vaddr) {
+        u64 offset = 0;
+        while (!vaddr.IsImmediate()) {
+            const IR::Inst* inst = vaddr.GetInstRecursive();
+            const auto opcode = inst->GetOpcode();
+            if ((opcode != IR::Opcode::Add64 && opcode != IR::Opcode::Sub64) || !inst->GetArg(1).IsImmediate() || !inst->GetArg(2).IsImmediate()) {
+                return std::make_pair(inst, offset);
+            }
+            const u64 imm = inst->GetArg(1).GetImmediateAsU64();
+            const u64 carry = inst->GetArg(2).GetU1() ? 1 : 0;
+            offset += (opcode == IR::Opcode::Add64 ? imm : ~imm) + carry;
+            vaddr = inst->GetArg(0);
+        }
+        return std::make_pair(static_cast<const IR::Inst*>(nullptr), offset + vaddr.GetImmediateAsU64());
+    };
+    const auto is_plain_access = [](IR::AccType acc_type) {
+        switch (acc_type) {
+        case IR::AccType::NORMAL:
+        case IR::AccType::VEC:
+        case IR::AccType::STREAM:
+        case IR::AccType::VECSTREAM:
+        case IR::AccType::UNPRIV:
+        case IR::AccType::DCZVA:
+            return true;
+        default:
+            return false;
+        }
+    };
+    const auto remember = [&known](KnownValue value) {
+        if (known.size() == max_known_values) {
+            known.erase(known.begin());
+        }
+        known.push_back(value);
+    };
+
+    for (auto& inst : block) {
+        const auto opcode = inst.GetOpcode();
+        switch (opcode) {
+        case IR::Opcode::A64ReadMemory8:
+        case IR::Opcode::A64ReadMemory16:
+        case IR::Opcode::A64ReadMemory32:
+        case IR::Opcode::A64ReadMemory64:
+        case IR::Opcode::A64ReadMemory128: {
+            if (!is_plain_access(inst.GetArg(2).GetAccType())) {
+                known.clear();
+                break;
+            }
+            const auto [base, offset] = decompose_address(inst.GetArg(1));
+            const size_t bytes = A64MemoryAccessBytes(opcode);
+            const auto iter = std::find_if(known.begin(), known.end(), [&](const KnownValue& k) {
+                return k.base == base && k.offset == offset && k.bytes == bytes;
+            });
+            if (iter != known.end()) {
+                inst.ReplaceUsesWith(iter->value);
+            } else {
+                remember({base, offset, bytes, IR::Value{&inst}});
+            }
+            break;
+        }
+        case IR::Opcode::A64WriteMemory8:
+        case IR::Opcode::A64WriteMemory16:
+        case IR::Opcode::A64WriteMemory32:
+        case IR::Opcode::A64WriteMemory64:
+        case IR::Opcode::A64WriteMemory128: {
+            if (!is_plain_access(inst.GetArg(3).GetAccType())) {
+                known.clear();
+                break;
+            }
+            const auto [base, offset] = decompose_address(inst.GetArg(1));
+            const size_t bytes = A64MemoryAccessBytes(opcode);
+            // Offsets wrap around like addresses do, so overlap is checked modulo 2^64.
+            known.erase(std::remove_if(known.begin(), known.end(), [&](const KnownValue& k) {
+                return k.base != base || offset - k.offset < k.bytes || k.offset - offset < bytes;
+            }), known.end());
+            remember({base, offset, bytes, inst.GetArg(2)});
+            break;
+        }
+        default: {
+            if (IsBarrier(opcode) || AltersExclusiveState(opcode) || CausesCPUException(opcode)
+                || opcode == IR::Opcode::CallHostFunction
+                || opcode == IR::Opcode::A64DataCacheOperationRaised
+                || opcode == IR::Opcode::A64InstructionCacheOperationRaised) {
+                known.clear();
+            }
+            break;
+        }
+        }
+    }
+}
+
 static void A64MergeInterpretBlocksPass(IR::Block& block, A64::UserCallbacks* cb) {
     const auto is_interpret_instruction = [cb](A64::LocationDescriptor location) {
         const auto instruction = cb->MemoryReadCode(location.PC());
@@ -1509,9 +1649,27 @@ void Optimize(IR::Block& block, const A64::UserConfig& conf, const Optimization:
         Optimization::ConstantPropagation(block);
         Optimization::DeadCodeElimination(block);
     }
+    if (conf.HasOptimization(OptimizationFlag::MemoryForwarding) && !conf.check_halt_on_memory_access) {
+        // Removed loads would no longer be seen by the debugger's watchpoints.
+        Optimization::A64MemoryForwardingPass(block);
+        Optimization::DeadCodeElimination(block);
+    }
     if (conf.HasOptimization(OptimizationFlag::MiscIROpt)) [[likely]] {
         Optimization::A64MergeInterpretBlocksPass(block, conf.callbacks);
     }
+    if (conf.HasOptimization(OptimizationFlag::TieredCompilation)) {
+        // Only blocks that have proven hot get here, so the extra time is well spent.
+        Optimization::IdentityRemovalPass(block);
+    }
+    if (!conf.HasOptimization(OptimizationFlag::DisableVerification)) {
+        Optimization::VerificationPass(block);
+    }
+}
+
+void OptimizeBaseline(IR::Block& block, const A64::UserConfig& conf, const Optimization::PolyfillOptions& polyfill_options) {
+    Optimization::PolyfillPass(block, polyfill_options);
+    Optimization::A64CallbackConfigPass(block, conf);
+    Optimization::NamingPass(block);
     if (!conf.HasOptimization(OptimizationFlag::DisableVerification)) {
         Optimization::VerificationPass(block);
     }
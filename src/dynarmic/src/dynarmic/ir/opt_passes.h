@@ -33,5 +33,8 @@ struct PolyfillOptions {
 
 void Optimize(IR::Block& block, const A32::UserConfig& conf, const Optimization::PolyfillOptions& polyfill_options);
 void Optimize(IR::Block& block, const A64::UserConfig& conf, const Optimization::PolyfillOptions& polyfill_options);
+/// Runs only the passes a block needs to be emitted, for blocks that may never run often enough
+/// to pay back a full optimization.
+void OptimizeBaseline(IR::Block& block, const A64::UserConfig& conf, const Optimization::PolyfillOptions& polyfill_options);
 
 }  // namespace Dynarmic::Optimization
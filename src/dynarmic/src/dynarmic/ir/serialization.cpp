@@ -0,0 +1,507 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "dynarmic/ir/serialization.h"
+
+#include <array>
+#include <cstring>
+#include <optional>
+#include <type_traits>
+
+#include <ankerl/unordered_dense.h>
+
+#include "dynarmic/frontend/A32/a32_types.h"
+#include "dynarmic/frontend/A64/a64_types.h"
+#include "dynarmic/ir/acc_type.h"
+#include "dynarmic/ir/basic_block.h"
+#include "dynarmic/ir/cond.h"
+#include "dynarmic/ir/microinstruction.h"
+#include "dynarmic/ir/opcodes.h"
+#include "dynarmic/ir/terminal.h"
+#include "dynarmic/ir/type.h"
+#include "dynarmic/ir/value.h"
+
+namespace Dynarmic::IR {
+
+namespace {
+
+/// Nested terminals deeper than this are rejected when reading, to bound recursion on bad data.
+constexpr size_t max_terminal_depth = 16;
+
+/// Every serialized instruction takes at least its opcode and name.
+constexpr size_t min_inst_size = sizeof(u16) + sizeof(u32);
+
+enum class TerminalTag : u8 {
+    Invalid,
+    Interpret,
+    ReturnToDispatch,
+    LinkBlock,
+    LinkBlockFast,
+    PopRSBHint,
+    FastDispatchHint,
+    If,
+    CheckBit,
+    CheckHalt,
+};
+
+class Writer {
+public:
+    explicit Writer(std::vector<u8>& out)
+            : out(out) {}
+
+    template<typename T>
+    void Write(T value) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        const size_t offset = out.size();
+        out.resize(offset + sizeof(T));
+        std::memcpy(out.data() + offset, &value, sizeof(T));
+    }
+
+private:
+    std::vector<u8>& out;
+};
+
+class Reader {
+public:
+    explicit Reader(std::span<const u8> data)
+            : data(data) {}
+
+    template<typename T>
+    bool Read(T& value) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        if (data.size() - offset < sizeof(T)) {
+            return false;
+        }
+        std::memcpy(&value, data.data() + offset, sizeof(T));
+        offset += sizeof(T);
+        return true;
+    }
+
+    bool AtEnd() const { return offset == data.size(); }
+
+    size_t Remaining() const { return data.size() - offset; }
+
+private:
+    std::span<const u8> data;
+    size_t offset = 0;
+};
+
+/// An instruction that has been read and validated but not yet added to a block.
+/// Arguments that refer to other instructions hold the index of that instruction plus one in
+/// refs, and an empty value in args.
+struct DecodedInst {
+    Opcode op;
+    u32 name;
+    std::array<Value, max_arg_count> args;
+    std::array<u32, max_arg_count> refs;
+};
+
+void WriteTerminal(Writer& w, const Terminal& terminal) {
+    struct : boost::static_visitor<void> {
+        Writer* w;
+        void operator()(const Term::Invalid&) const {
+            w->Write(TerminalTag::Invalid);
+        }
+        void operator()(const Term::Interpret& t) const {
+            w->Write(TerminalTag::Interpret);
+            w->Write(t.next.Value());
+            w->Write(u64(t.num_instructions));
+        }
+        void operator()(const Term::ReturnToDispatch&) const {
+            w->Write(TerminalTag::ReturnToDispatch);
+        }
+        void operator()(const Term::LinkBlock& t) const {
+            w->Write(TerminalTag::LinkBlock);
+            w->Write(t.next.Value());
+        }
+        void operator()(const Term::LinkBlockFast& t) const {
+            w->Write(TerminalTag::LinkBlockFast);
+            w->Write(t.next.Value());
+        }
+        void operator()(const Term::PopRSBHint&) const {
+            w->Write(TerminalTag::PopRSBHint);
+        }
+        void operator()(const Term::FastDispatchHint&) const {
+            w->Write(TerminalTag::FastDispatchHint);
+        }
+        void operator()(const Term::If& t) const {
+            w->Write(TerminalTag::If);
+            w->Write(u8(t.if_));
+            WriteTerminal(*w, t.then_);
+            WriteTerminal(*w, t.else_);
+        }
+        void operator()(const Term::CheckBit& t) const {
+            w->Write(TerminalTag::CheckBit);
+            WriteTerminal(*w, t.then_);
+            WriteTerminal(*w, t.else_);
+        }
+        void operator()(const Term::CheckHalt& t) const {
+            w->Write(TerminalTag::CheckHalt);
+            WriteTerminal(*w, t.else_);
+        }
+    } visitor;
+    visitor.w = &w;
+    boost::apply_visitor(visitor, terminal);
+}
+
+std::optional<Terminal> ReadTerminal(Reader& r, size_t depth) {
+    if (depth > max_terminal_depth) {
+        return std::nullopt;
+    }
+    TerminalTag tag;
+    if (!r.Read(tag)) {
+        return std::nullopt;
+    }
+    switch (tag) {
+    case TerminalTag::Invalid:
+        return Term::Invalid{};
+    case TerminalTag::Interpret: {
+        u64 next, num_instructions;
+        if (!r.Read(next) || !r.Read(num_instructions)) {
+            return std::nullopt;
+        }
+        Term::Interpret t{LocationDescriptor{next}};
+        t.num_instructions = size_t(num_instructions);
+        return t;
+    }
+    case TerminalTag::ReturnToDispatch:
+        return Term::ReturnToDispatch{};
+    case TerminalTag::LinkBlock:
+    case TerminalTag::LinkBlockFast: {
+        u64 next;
+        if (!r.Read(next)) {
+            return std::nullopt;
+        }
+        if (tag == TerminalTag::LinkBlock) {
+            return Term::LinkBlock{LocationDescriptor{next}};
+        }
+        return Term::LinkBlockFast{LocationDescriptor{next}};
+    }
+    case TerminalTag::PopRSBHint:
+        return Term::PopRSBHint{};
+    case TerminalTag::FastDispatchHint:
+        return Term::FastDispatchHint{};
+    case TerminalTag::If: {
+        u8 cond;
+        if (!r.Read(cond) || cond > u8(Cond::NV)) {
+            return std::nullopt;
+        }
+        auto then_ = ReadTerminal(r, depth + 1);
+        if (!then_) {
+            return std::nullopt;
+        }
+        auto else_ = ReadTerminal(r, depth + 1);
+        if (!else_) {
+            return std::nullopt;
+        }
+        return Term::If{Cond(cond), std::move(*then_), std::move(*else_)};
+    }
+    case TerminalTag::CheckBit: {
+        auto then_ = ReadTerminal(r, depth + 1);
+        if (!then_) {
+            return std::nullopt;
+        }
+        auto else_ = ReadTerminal(r, depth + 1);
+        if (!else_) {
+            return std::nullopt;
+        }
+        return Term::CheckBit{std::move(*then_), std::move(*else_)};
+    }
+    case TerminalTag::CheckHalt: {
+        auto else_ = ReadTerminal(r, depth + 1);
+        if (!else_) {
+            return std::nullopt;
+        }
+        return Term::CheckHalt{std::move(*else_)};
+    }
+    }
+    return std::nullopt;
+}
+
+/// Looks through Identity instructions to the immediate they forward.
+Value ResolveImmediate(Value value) {
+    while (value.IsIdentity()) {
+        value = value.GetInst()->GetArg(0);
+    }
+    return value;
+}
+
+bool WriteImmediate(Writer& w, const Value& value) {
+    const Type type = value.GetType();
+    w.Write(type);
+    switch (type) {
+    case Type::Void:
+    case Type::NZCVFlags:
+        return true;
+    case Type::A32Reg:
+        w.Write(u64(value.GetA32RegRef()));
+        return true;
+    case Type::A32ExtReg:
+        w.Write(u64(value.GetA32ExtRegRef()));
+        return true;
+    case Type::A64Reg:
+        w.Write(u64(value.GetA64RegRef()));
+        return true;
+    case Type::A64Vec:
+        w.Write(u64(value.GetA64VecRef()));
+        return true;
+    case Type::U1:
+        w.Write(u64(value.GetU1()));
+        return true;
+    case Type::U8:
+        w.Write(u64(value.GetU8()));
+        return true;
+    case Type::U16:
+        w.Write(u64(value.GetU16()));
+        return true;
+    case Type::U32:
+        w.Write(u64(value.GetU32()));
+        return true;
+    case Type::U64:
+        w.Write(value.GetU64());
+        return true;
+    case Type::CoprocInfo:
+        w.Write(value.GetCoprocInfo());
+        return true;
+    case Type::Cond:
+        w.Write(u64(value.GetCond()));
+        return true;
+    case Type::AccType:
+        w.Write(u64(value.GetAccType()));
+        return true;
+    default:
+        return false;
+    }
+}
+
+std::optional<Value> ReadImmediate(Reader& r, Type type) {
+    if (type == Type::Void) {
+        return Value{};
+    }
+    if (type == Type::NZCVFlags) {
+        return Value::EmptyNZCVImmediateMarker();
+    }
+    if (type == Type::CoprocInfo) {
+        Value::CoprocessorInfo info;
+        if (!r.Read(info)) {
+            return std::nullopt;
+        }
+        return Value{info};
+    }
+
+    u64 raw;
+    if (!r.Read(raw)) {
+        return std::nullopt;
+    }
+    switch (type) {
+    case Type::A32Reg:
+        if (raw > u64(A32::Reg::R15)) {
+            return std::nullopt;
+        }
+        return Value{static_cast<A32::Reg>(raw)};
+    case Type::A32ExtReg:
+        if (raw > u64(A32::ExtReg::Q15)) {
+            return std::nullopt;
+        }
+        return Value{static_cast<A32::ExtReg>(raw)};
+    case Type::A64Reg:
+        if (raw > u64(A64::Reg::R31)) {
+            return std::nullopt;
+        }
+        return Value{static_cast<A64::Reg>(raw)};
+    case Type::A64Vec:
+        if (raw > u64(A64::Vec::V31)) {
+            return std::nullopt;
+        }
+        return Value{static_cast<A64::Vec>(raw)};
+    case Type::U1:
+        return Value{raw != 0};
+    case Type::U8:
+        return Value{u8(raw)};
+    case Type::U16:
+        return Value{u16(raw)};
+    case Type::U32:
+        return Value{u32(raw)};
+    case Type::U64:
+        return Value{raw};
+    case Type::Cond:
+        if (raw > u64(Cond::NV)) {
+            return std::nullopt;
+        }
+        return Value{Cond(raw)};
+    case Type::AccType:
+        if (raw > u64(AccType::SWAP)) {
+            return std::nullopt;
+        }
+        return Value{AccType(raw)};
+    default:
+        return std::nullopt;
+    }
+}
+
+}  // namespace
+
+bool SerializeBlock(const Block& block, std::vector<u8>& out) {
+    Writer w{out};
+
+    w.Write(block.EndLocation().Value());
+    w.Write(u8(block.GetCondition()));
+    w.Write(u8(block.HasConditionFailedLocation()));
+    if (block.HasConditionFailedLocation()) {
+        w.Write(block.ConditionFailedLocation().Value());
+    }
+    w.Write(u64(block.ConditionFailedCycleCount()));
+    w.Write(u64(block.CycleCount()));
+
+    ankerl::unordered_dense::map<const Inst*, u32> indices;
+    indices.reserve(block.size());
+    w.Write(u32(block.size()));
+    for (const Inst& inst : block) {
+        const Opcode op = inst.GetOpcode();
+        w.Write(u16(op));
+        w.Write(u32(inst.GetName()));
+        for (size_t i = 0; i < inst.NumArgs(); i++) {
+            const Value arg = inst.GetArg(i);
+            if (!arg.IsEmpty() && !arg.IsImmediate()) {
+                // Instructions may only refer to instructions that precede them.
+                const auto iter = indices.find(arg.GetInst());
+                if (iter == indices.end()) {
+                    return false;
+                }
+                w.Write(Type::Opaque);
+                w.Write(iter->second);
+            } else if (!WriteImmediate(w, ResolveImmediate(arg))) {
+                return false;
+            }
+        }
+        indices.emplace(&inst, u32(indices.size()));
+    }
+
+    WriteTerminal(w, block.GetTerminal());
+    return true;
+}
+
+bool DeserializeBlock(Block& block, std::span<const u8> data) {
+    Reader r{data};
+
+    u64 end_location, cond_failed_location = 0, cond_failed_cycle_count, cycle_count;
+    u8 cond, has_cond_failed;
+    if (!r.Read(end_location) || !r.Read(cond) || cond > u8(Cond::NV) || !r.Read(has_cond_failed)) {
+        return false;
+    }
+    if (has_cond_failed && !r.Read(cond_failed_location)) {
+        return false;
+    }
+    if (!r.Read(cond_failed_cycle_count) || !r.Read(cycle_count)) {
+        return false;
+    }
+
+    // The count comes from untrusted data, so bound it before reserving space for it.
+    u32 inst_count;
+    if (!r.Read(inst_count) || inst_count > r.Remaining() / min_inst_size) {
+        return false;
+    }
+    std::vector<DecodedInst> insts;
+    std::vector<Type> result_types;
+    insts.reserve(inst_count);
+    result_types.reserve(inst_count);
+    for (u32 index = 0; index < inst_count; index++) {
+        u16 raw_op;
+        DecodedInst& inst = insts.emplace_back();
+        if (!r.Read(raw_op) || raw_op >= OpcodeCount || !r.Read(inst.name)) {
+            return false;
+        }
+        inst.op = Opcode(raw_op);
+        inst.refs = {};
+
+        const size_t num_args = GetNumArgsOf(inst.op);
+        std::array<Type, max_arg_count> arg_types{};
+        for (size_t i = 0; i < num_args; i++) {
+            Type type;
+            if (!r.Read(type)) {
+                return false;
+            }
+            if (type == Type::Opaque) {
+                u32 ref;
+                if (!r.Read(ref) || ref >= index) {
+                    return false;
+                }
+                inst.refs[i] = ref + 1;
+                arg_types[i] = result_types[ref];
+            } else {
+                const auto value = ReadImmediate(r, type);
+                if (!value) {
+                    return false;
+                }
+                inst.args[i] = *value;
+                arg_types[i] = type;
+            }
+
+            const Type expected = GetArgTypeOf(inst.op, i);
+            if (arg_types[i] == Type::Void ? expected != Type::Opaque : !AreTypesCompatible(arg_types[i], expected)) {
+                return false;
+            }
+        }
+
+        if (IsAPseudoOperation(inst.op)) {
+            if (num_args == 0 || inst.refs[0] == 0) {
+                return false;
+            }
+            if (inst.op == Opcode::GetNZCVFromOp && !MayGetNZCVFromOp(insts[inst.refs[0] - 1].op)) {
+                return false;
+            }
+        }
+
+        result_types.push_back(inst.op == Opcode::Identity && num_args > 0 ? arg_types[0] : GetTypeOf(inst.op));
+    }
+
+    auto terminal = ReadTerminal(r, 0);
+    if (!terminal || !r.AtEnd()) {
+        return false;
+    }
+
+    // Everything has been validated; build the block.
+    block.SetEndLocation(LocationDescriptor{end_location});
+    block.SetCondition(Cond(cond));
+    if (has_cond_failed) {
+        block.SetConditionFailedLocation(LocationDescriptor{cond_failed_location});
+    }
+    block.ConditionFailedCycleCount() = size_t(cond_failed_cycle_count);
+    block.CycleCount() = size_t(cycle_count);
+
+    std::vector<Inst*> built;
+    built.reserve(insts.size());
+    for (DecodedInst& inst : insts) {
+        auto& args = inst.args;
+        for (size_t i = 0; i < max_arg_count; i++) {
+            if (inst.refs[i] != 0) {
+                args[i] = Value{built[inst.refs[i] - 1]};
+            }
+        }
+        switch (GetNumArgsOf(inst.op)) {
+        case 0:
+            block.AppendNewInst(inst.op, {});
+            break;
+        case 1:
+            block.AppendNewInst(inst.op, {args[0]});
+            break;
+        case 2:
+            block.AppendNewInst(inst.op, {args[0], args[1]});
+            break;
+        case 3:
+            block.AppendNewInst(inst.op, {args[0], args[1], args[2]});
+            break;
+        default:
+            block.AppendNewInst(inst.op, {args[0], args[1], args[2], args[3]});
+            break;
+        }
+        Inst* const new_inst = &block.back();
+        new_inst->SetName(inst.name);
+        built.push_back(new_inst);
+    }
+
+    block.SetTerminal(std::move(*terminal));
+    return true;
+}
+
+}  // namespace Dynarmic::IR
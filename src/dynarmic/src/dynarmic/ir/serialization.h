@@ -0,0 +1,25 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <span>
+#include <vector>
+
+#include "dynarmic/common/common_types.h"
+
+namespace Dynarmic::IR {
+
+class Block;
+
+/// Appends a binary representation of block to out. The representation is only meaningful
+/// to the same build of this library. Returns false if the block cannot be represented, in
+/// which case the contents of out are unspecified.
+bool SerializeBlock(const Block& block, std::vector<u8>& out);
+
+/// Rebuilds a block from data produced by SerializeBlock. block must be freshly constructed
+/// with the location the data was produced from. The whole of data is validated before block
+/// is modified, so block is left untouched if this returns false.
+bool DeserializeBlock(Block& block, std::span<const u8> data);
+
+}  // namespace Dynarmic::IR
@@ -6,13 +6,21 @@
  * SPDX-License-Identifier: 0BSD
  */
 
+#include <map>
+#include <utility>
+#include <vector>
+
 #include <catch2/catch_test_macros.hpp>
 #include <oaknut/oaknut.hpp>
 
 #include "./testenv.h"
 #include "../native/testenv.h"
 #include "dynarmic/common/fp/fpsr.h"
+#include "dynarmic/frontend/A64/translate/a64_translate.h"
 #include "dynarmic/interface/exclusive_monitor.h"
+#include "dynarmic/ir/basic_block.h"
+#include "dynarmic/ir/opcodes.h"
+#include "dynarmic/ir/opt_passes.h"
 
 using namespace Dynarmic;
 using namespace oaknut::util;
@@ -1050,6 +1058,32 @@ TEST_CASE("A64: FMUL.4S(lane)", "[a64]") {
     REQUIRE(jit.GetVector(3) == Vector{0x40b4000040b40000, 0x40b4000040b40000});
 }
 
+TEST_CASE("A64: FADD.4S, FMLA.4S (NaN propagation)", "[a64]") {
+    A64TestEnv env;
+    A64::UserConfig jit_user_config{};
+    jit_user_config.callbacks = &env;
+    A64::Jit jit{jit_user_config};
+
+    env.code_mem.emplace_back(0x4e22d420);  // FADD.4S V0, V1, V2
+    env.code_mem.emplace_back(0x4e26cca4);  // FMLA.4S V4, V5, V6
+    env.code_mem.emplace_back(0x14000000);  // B .
+
+    jit.SetPC(0);
+    // QNaN + SNaN, SNaN + QNaN, inf + -inf, 1 + 2
+    jit.SetVector(1, {0x7f800003'7fc00001, 0x3f800000'7f800000});
+    jit.SetVector(2, {0x7fc00004'7f800002, 0x40000000'ff800000});
+    // QNaN + inf * 0, QNaN + SNaN * 1, 1 + QNaN * SNaN, 1 + 2 * 3
+    jit.SetVector(4, {0x7fc00006'7fc00005, 0x3f800000'3f800000});
+    jit.SetVector(5, {0x7f800007'7f800000, 0x40000000'7fc00008});
+    jit.SetVector(6, {0x3f800000'00000000, 0x40400000'7f800009});
+
+    env.ticks_left = 3;
+    CheckedRun([&]() { jit.Run(); });
+
+    REQUIRE(jit.GetVector(0) == Vector{0x7fc00003'7fc00002, 0x40400000'7fc00000});
+    REQUIRE(jit.GetVector(4) == Vector{0x7fc00007'7fc00000, 0x40e00000'7fc00009});
+}
+
 TEST_CASE("A64: FMLA.4S (denormal)", "[a64]") {
     A64TestEnv env;
     A64::UserConfig jit_user_config{};
@@ -2411,3 +2445,313 @@ TEST_CASE("A64: CLZ{W}", "[a64]") {
     REQUIRE(jit.GetRegister(1) == 4);
     REQUIRE(jit.GetRegister(2) == 5);
 }
+
+TEST_CASE("A64: Trace formation", "[a64]") {
+    A64TestEnv env;
+    A64::UserConfig conf{};
+    conf.callbacks = &env;
+    conf.trace_threshold = 64;
+    conf.optimizations |= OptimizationFlag::TraceFormation;
+    A64::Jit jit{conf};
+
+    REQUIRE(conf.HasOptimization(OptimizationFlag::TraceFormation));
+
+    // A loop whose forward branches are rarely taken, so that its body becomes a trace with
+    // side exits on both a check bit branch and a conditional branch.
+    oaknut::VectorCodeGenerator code{env.code_mem, nullptr};
+    oaknut::Label loop, back1, back2, rare1, rare2, end;
+
+    code.MOV(X1, 3000);
+    code.l(loop);
+    code.AND(X3, X1, 0xff);
+    code.CBZ(X3, rare1);
+    code.ADD(X0, X0, 1);
+    code.l(back1);
+    code.TST(X1, 0x7f);
+    code.B(EQ, rare2);
+    code.ADD(X4, X4, 1);
+    code.l(back2);
+    code.SUBS(X1, X1, 1);
+    code.B(NE, loop);
+    code.l(end);
+    code.B(end);
+    code.l(rare1);
+    code.ADD(X2, X2, 1);
+    code.B(back1);
+    code.l(rare2);
+    code.ADD(X5, X5, 1);
+    code.B(back2);
+
+    jit.SetPC(0);
+    env.ticks_left = 100000;
+    CheckedRun([&]() { jit.Run(); });
+
+    REQUIRE(jit.GetRegister(0) == 2989);
+    REQUIRE(jit.GetRegister(1) == 0);
+    REQUIRE(jit.GetRegister(2) == 11);
+    REQUIRE(jit.GetRegister(4) == 2977);
+    REQUIRE(jit.GetRegister(5) == 23);
+    REQUIRE(jit.GetPC() == 36);
+}
+
+TEST_CASE("A64: Tiered compilation", "[a64]") {
+    A64TestEnv env;
+    A64::UserConfig conf{};
+    conf.callbacks = &env;
+    conf.tier_up_threshold = 8;
+    conf.optimizations |= OptimizationFlag::TieredCompilation;
+    A64::Jit jit{conf};
+
+    REQUIRE(conf.HasOptimization(OptimizationFlag::TieredCompilation));
+
+    // The loop body runs at the baseline tier for its first iterations and is then replaced
+    // by its optimized translation midway through the loop.
+    oaknut::VectorCodeGenerator code{env.code_mem, nullptr};
+    oaknut::Label loop, end;
+
+    code.MOV(X2, 100);
+    code.l(loop);
+    code.ADD(X0, X0, X1);
+    code.ADD(X1, X1, 2);
+    code.CMP(X1, 100);
+    code.CSINC(X3, X3, X3, LO);
+    code.SUBS(X2, X2, 1);
+    code.B(NE, loop);
+    code.l(end);
+    code.B(end);
+
+    jit.SetPC(0);
+    env.ticks_left = 10000;
+    CheckedRun([&]() { jit.Run(); });
+
+    REQUIRE(jit.GetRegister(0) == 9900);
+    REQUIRE(jit.GetRegister(1) == 200);
+    REQUIRE(jit.GetRegister(2) == 0);
+    REQUIRE(jit.GetRegister(3) == 51);
+    REQUIRE(jit.GetPC() == 28);
+}
+
+TEST_CASE("A64: Speculative compilation", "[a64]") {
+    struct SpeculativeTestEnv final : A64TestEnv {
+        std::optional<std::uint32_t> MemoryReadCodeSpeculative(u64 vaddr) override {
+            return MemoryReadCode(vaddr);
+        }
+    };
+
+    // Blocks may be emitted from either the compile thread's translation or a fresh one,
+    // depending on timing. Both must behave the same. Without MemoryReadCodeSpeculative, every
+    // block is translated on the thread running the JIT.
+    const auto run = [](A64TestEnv& env) {
+        A64::UserConfig conf{};
+        conf.callbacks = &env;
+        conf.speculative_compilation = true;
+        A64::Jit jit{conf};
+
+        oaknut::VectorCodeGenerator code{env.code_mem, nullptr};
+        oaknut::Label l1, l2, l3, end;
+
+        code.MOV(X0, 1);
+        code.B(l1);
+        code.l(l1);
+        code.ADD(X0, X0, 2);
+        code.CBZ(X1, l2);
+        code.ADD(X0, X0, 100);
+        code.l(l2);
+        code.ADD(X0, X0, 4);
+        code.B(l3);
+        code.l(l3);
+        code.ADD(X0, X0, 8);
+        code.l(end);
+        code.B(end);
+
+        jit.SetPC(0);
+        env.ticks_left = 20;
+        CheckedRun([&]() { jit.Run(); });
+        REQUIRE(jit.GetRegister(0) == 15);
+        REQUIRE(jit.GetPC() == 32);
+
+        jit.InvalidateCacheRange(16, 4);
+
+        jit.SetRegister(1, 1);
+        jit.SetPC(0);
+        env.ticks_left = 20;
+        CheckedRun([&]() { jit.Run(); });
+        REQUIRE(jit.GetRegister(0) == 115);
+        REQUIRE(jit.GetPC() == 32);
+    };
+
+    SpeculativeTestEnv speculative_env;
+    run(speculative_env);
+    A64TestEnv env;
+    run(env);
+}
+
+TEST_CASE("A64: Translation cache", "[a64]") {
+    struct MockTranslationCache final : A64::TranslationCache {
+        bool Load(std::uint64_t location, std::vector<std::uint8_t>& data) override {
+            const auto iter = entries.find(location);
+            if (iter == entries.end()) {
+                return false;
+            }
+            data = iter->second;
+            return true;
+        }
+        void Store(std::uint64_t location, const std::vector<std::uint8_t>& data) override {
+            entries[location] = data;
+            stores++;
+        }
+
+        std::map<std::uint64_t, std::vector<std::uint8_t>> entries;
+        size_t stores = 0;
+    } cache;
+
+    // Each run is a fresh JIT, as after a restart, sharing only the cache.
+    const auto run = [&cache] {
+        A64TestEnv env;
+        A64::UserConfig conf{};
+        conf.callbacks = &env;
+        conf.translation_cache = &cache;
+        A64::Jit jit{conf};
+
+        oaknut::VectorCodeGenerator code{env.code_mem, nullptr};
+        oaknut::Label loop, end;
+        code.MOV(X1, 10);
+        code.l(loop);
+        code.ADD(X0, X0, X1);
+        code.SUBS(X1, X1, 1);
+        code.B(NE, loop);
+        code.l(end);
+        code.B(end);
+
+        jit.SetPC(0);
+        env.ticks_left = 100;
+        CheckedRun([&]() { jit.Run(); });
+        REQUIRE(jit.GetPC() == 16);
+        return jit.GetRegister(0);
+    };
+
+    REQUIRE(run() == 55);
+    const size_t stores = cache.stores;
+    REQUIRE(stores != 0);
+
+    // Blocks loaded from the cache are not translated, so nothing is stored again.
+    REQUIRE(run() == 55);
+    REQUIRE(cache.stores == stores);
+
+    // Entries that fail to decode are ignored, and the blocks are translated again.
+    for (auto& [location, data] : cache.entries) {
+        data.pop_back();
+    }
+    REQUIRE(run() == 55);
+    REQUIRE(cache.stores == stores * 2);
+}
+
+TEST_CASE("A64: Live interval register allocation", "[a64]") {
+    // Many values stay live across a memory callback, so the allocator has to free up the
+    // caller-saved registers that hold them.
+    const auto run = [](OptimizationFlag optimizations) {
+        A64TestEnv env;
+        A64::UserConfig conf{};
+        conf.callbacks = &env;
+        conf.optimizations = optimizations;
+        A64::Jit jit{conf};
+
+        for (std::uint32_t i = 1; i <= 15; i++) {
+            env.code_mem.emplace_back(0x91000000 | (i << 10) | i);  // ADD Xi, X0, #i
+        }
+        env.code_mem.emplace_back(0xf9400230);  // LDR X16, [X17]
+        for (std::uint32_t i = 1; i <= 15; i++) {
+            env.code_mem.emplace_back(0x8b000252 | (i << 16));  // ADD X18, X18, Xi
+        }
+        env.code_mem.emplace_back(0x14000000);  // B .
+
+        jit.SetRegister(0, 1000);
+        jit.SetRegister(17, 0x1000);
+        jit.SetPC(0);
+        env.ticks_left = 40;
+        CheckedRun([&]() { jit.Run(); });
+
+        REQUIRE(jit.GetRegister(18) == 15 * 1000 + 120);
+        for (size_t i = 1; i <= 15; i++) {
+            REQUIRE(jit.GetRegister(i) == 1000 + i);
+        }
+        return jit.GetRegister(16);
+    };
+
+    REQUIRE(run(all_safe_optimizations | OptimizationFlag::LiveIntervalRegAlloc) == run(all_safe_optimizations));
+}
+
+TEST_CASE("A64: Memory access forwarding", "[a64]") {
+    // X0 and X4 hold the same address, so stores through X4 must not be forwarded past.
+    const std::vector<u32> code{
+        0xf9000001,  // STR X1, [X0]
+        0xf9000085,  // STR X5, [X4]
+        0xf9400002,  // LDR X2, [X0]
+        0xb9000406,  // STR W6, [X0, #4]
+        0xf9400007,  // LDR X7, [X0]
+        0xf9000809,  // STR X9, [X0, #16]
+        0xf9400808,  // LDR X8, [X0, #16]
+        0xf940080a,  // LDR X10, [X0, #16]
+        0x14000000,  // B .
+    };
+
+    const auto run = [&code](OptimizationFlag optimizations) {
+        A64TestEnv env;
+        A64::UserConfig conf{};
+        conf.callbacks = &env;
+        conf.optimizations = optimizations;
+        A64::Jit jit{conf};
+
+        env.code_mem = code;
+
+        jit.SetRegister(0, 0x1000);
+        jit.SetRegister(4, 0x1000);
+        jit.SetRegister(1, 0x1111111111111111);
+        jit.SetRegister(5, 0x5555555555555555);
+        jit.SetRegister(6, 0x66666666);
+        jit.SetRegister(9, 0x99);
+        jit.SetPC(0);
+        env.ticks_left = 9;
+        CheckedRun([&]() { jit.Run(); });
+
+        REQUIRE(jit.GetRegister(2) == 0x5555555555555555);
+        REQUIRE(jit.GetRegister(7) == 0x6666666655555555);
+        REQUIRE(jit.GetRegister(8) == 0x99);
+        REQUIRE(jit.GetRegister(10) == 0x99);
+        REQUIRE(env.MemoryRead64(0x1000) == 0x6666666655555555);
+    };
+
+    run(all_safe_optimizations | OptimizationFlag::MemoryForwarding);
+    run(all_safe_optimizations);
+
+    // Returns the 64-bit reads left in the optimized block, and how many of them are from [X0, #16].
+    const auto count_reads = [&code](OptimizationFlag optimizations) {
+        A64TestEnv env;
+        A64::UserConfig conf{};
+        conf.callbacks = &env;
+        conf.optimizations = optimizations;
+        env.code_mem = code;
+
+        IR::Block block = A64::Translate(A64::LocationDescriptor{0, {}}, [&env](u64 vaddr) { return env.MemoryReadCode(vaddr); }, {});
+        Optimization::Optimize(block, conf, {});
+
+        size_t reads = 0;
+        size_t offset_reads = 0;
+        for (const auto& inst : block) {
+            if (inst.GetOpcode() != IR::Opcode::A64ReadMemory64) {
+                continue;
+            }
+            reads++;
+            const IR::Inst* vaddr = inst.GetArg(1).GetInstRecursive();
+            if (vaddr->GetOpcode() == IR::Opcode::Add64 && vaddr->GetArg(1).IsImmediate() && vaddr->GetArg(1).GetImmediateAsU64() == 16) {
+                offset_reads++;
+            }
+        }
+        return std::make_pair(reads, offset_reads);
+    };
+
+    // Both loads from [X0, #16] take the stored value. The loads from [X0] follow stores that may
+    // alias them and are kept.
+    REQUIRE(count_reads(all_safe_optimizations | OptimizationFlag::MemoryForwarding) == std::make_pair(size_t{2}, size_t{0}));
+    REQUIRE(count_reads(all_safe_optimizations) == std::make_pair(size_t{4}, size_t{2}));
+}
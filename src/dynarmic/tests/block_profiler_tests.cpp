@@ -0,0 +1,57 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "dynarmic/backend/block_profiler.h"
+
+using namespace Dynarmic;
+
+namespace {
+
+/// What emitted code does on block entry.
+void Enter(Backend::BlockProfiler& profiler, s32* counter) {
+    if (--*counter <= 0) {
+        *profiler.GetExpiredFlag() = true;
+    }
+}
+
+}  // namespace
+
+TEST_CASE("Block profiler: Blocks tier up after the threshold", "[block_profiler]") {
+    const IR::LocationDescriptor location{0x1000};
+    Backend::BlockProfiler profiler{4, std::nullopt};
+    REQUIRE(profiler.GetTier(location) == Backend::BlockTier::Baseline);
+
+    s32* const counter = profiler.GetCounter(location);
+    REQUIRE(counter != nullptr);
+    for (int i = 0; i < 3; i++) {
+        Enter(profiler, counter);
+        REQUIRE(!profiler.TakeHotBlock(location));
+    }
+    Enter(profiler, counter);
+    REQUIRE(profiler.TakeHotBlock(location));
+    REQUIRE(profiler.GetTier(location) == Backend::BlockTier::Optimized);
+    REQUIRE(profiler.GetCounter(location) == nullptr);
+}
+
+TEST_CASE("Block profiler: A missed expiry fires again", "[block_profiler]") {
+    const IR::LocationDescriptor location{0x1000};
+    const IR::LocationDescriptor other{0x2000};
+    Backend::BlockProfiler profiler{2, std::nullopt};
+
+    s32* const counter = profiler.GetCounter(location);
+    Enter(profiler, counter);
+    Enter(profiler, counter);
+
+    // The dispatcher looked up another block first, as after a context switch.
+    REQUIRE(!profiler.TakeHotBlock(other));
+    REQUIRE(profiler.GetTier(location) == Backend::BlockTier::Baseline);
+
+    // The block's next entries keep setting the flag until it is taken.
+    Enter(profiler, counter);
+    REQUIRE(!profiler.TakeHotBlock(other));
+    Enter(profiler, counter);
+    REQUIRE(profiler.TakeHotBlock(location));
+    REQUIRE(profiler.GetTier(location) == Backend::BlockTier::Optimized);
+}
@@ -0,0 +1,50 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "dynarmic/backend/code_cache_regions.h"
+
+using namespace Dynarmic;
+
+constexpr size_t MiB = 1024 * 1024;
+
+TEST_CASE("Code cache regions: Small caches are not split", "[code_cache]") {
+    Backend::CodeCacheRegions regions{4096, 12 * MiB};
+    REQUIRE(!regions.CanEvict());
+    REQUIRE(regions.CurrentEnd() == 12 * MiB);
+}
+
+TEST_CASE("Code cache regions: Least recently used region is evicted", "[code_cache]") {
+    Backend::CodeCacheRegions regions{0, 32 * MiB};
+    REQUIRE(regions.CanEvict());
+    REQUIRE(regions.CurrentEnd() == 8 * MiB);
+
+    // Empty regions are filled in order first.
+    auto region = regions.Advance();
+    REQUIRE(region.begin == 8 * MiB);
+    REQUIRE(!region.has_code);
+    region = regions.Advance();
+    REQUIRE(region.begin == 16 * MiB);
+    region = regions.Advance();
+    REQUIRE(region.begin == 24 * MiB);
+    REQUIRE(region.end == 32 * MiB);
+
+    // Code in the first region is still in use, so the second one goes.
+    regions.Touch(1 * MiB);
+    region = regions.Advance();
+    REQUIRE(region.begin == 8 * MiB);
+    REQUIRE(region.has_code);
+    region = regions.Advance();
+    REQUIRE(region.begin == 16 * MiB);
+    region = regions.Advance();
+    REQUIRE(region.begin == 24 * MiB);
+    region = regions.Advance();
+    REQUIRE(region.begin == 0);
+
+    regions.Reset();
+    REQUIRE(regions.CurrentEnd() == 8 * MiB);
+    region = regions.Advance();
+    REQUIRE(region.begin == 8 * MiB);
+    REQUIRE(!region.has_code);
+}
@@ -0,0 +1,156 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <array>
+#include <atomic>
+#include <barrier>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "dynarmic/common/common_types.h"
+#include "dynarmic/interface/exclusive_monitor.h"
+
+using namespace Dynarmic;
+
+namespace {
+
+constexpr size_t processor_count = 4;
+
+/// Exclusive store as the memory callbacks do it, only writing if memory is unchanged since the
+/// exclusive load.
+bool StoreExclusive(ExclusiveMonitor& monitor, size_t processor_id, std::atomic<u64>& word, VAddr vaddr, u64 value) {
+    return monitor.DoExclusiveOperation<u64>(processor_id, vaddr, [&](u64 expected) {
+        return word.compare_exchange_strong(expected, value);
+    });
+}
+
+u64 LoadExclusive(ExclusiveMonitor& monitor, size_t processor_id, std::atomic<u64>& word, VAddr vaddr) {
+    return monitor.ReadAndMark<u64>(processor_id, vaddr, [&] { return word.load(); });
+}
+
+}  // namespace
+
+TEST_CASE("Exclusive monitor: Store invalidates other reservations", "[exclusive_monitor]") {
+    ExclusiveMonitor monitor{processor_count};
+    std::atomic<u64> word{5};
+
+    REQUIRE(LoadExclusive(monitor, 0, word, 0x1000) == 5);
+    REQUIRE(LoadExclusive(monitor, 1, word, 0x1000) == 5);
+    REQUIRE(StoreExclusive(monitor, 1, word, 0x1000, 6));
+    REQUIRE(!StoreExclusive(monitor, 0, word, 0x1000, 7));
+    REQUIRE(word == 6);
+
+    // A reservation is used up by a store, successful or not.
+    REQUIRE(!StoreExclusive(monitor, 1, word, 0x1000, 8));
+
+    // Reservations of unrelated addresses are unaffected.
+    std::atomic<u64> other{1};
+    REQUIRE(LoadExclusive(monitor, 2, other, 0x2000) == 1);
+    REQUIRE(LoadExclusive(monitor, 3, word, 0x1000) == 6);
+    REQUIRE(StoreExclusive(monitor, 3, word, 0x1000, 9));
+    REQUIRE(StoreExclusive(monitor, 2, other, 0x2000, 2));
+
+    // Stores must be to the reserved address.
+    REQUIRE(LoadExclusive(monitor, 0, word, 0x1000) == 9);
+    REQUIRE(!StoreExclusive(monitor, 0, word, 0x1008, 10));
+}
+
+TEST_CASE("Exclusive monitor: Clear", "[exclusive_monitor]") {
+    ExclusiveMonitor monitor{processor_count};
+    std::atomic<u64> word{0};
+
+    LoadExclusive(monitor, 0, word, 0x1000);
+    LoadExclusive(monitor, 1, word, 0x1000);
+    monitor.ClearProcessor(0);
+    REQUIRE(!StoreExclusive(monitor, 0, word, 0x1000, 1));
+    REQUIRE(StoreExclusive(monitor, 1, word, 0x1000, 1));
+
+    LoadExclusive(monitor, 0, word, 0x1000);
+    LoadExclusive(monitor, 1, word, 0x1000);
+    monitor.Clear();
+    REQUIRE(!StoreExclusive(monitor, 0, word, 0x1000, 2));
+    REQUIRE(!StoreExclusive(monitor, 1, word, 0x1000, 2));
+    REQUIRE(word == 1);
+}
+
+TEST_CASE("Exclusive monitor: One of several racing stores succeeds", "[exclusive_monitor]") {
+    ExclusiveMonitor monitor{processor_count};
+    std::atomic<u64> word{0};
+    std::atomic<size_t> successes{0};
+    std::vector<size_t> successes_per_round;
+
+    constexpr size_t rounds = 2000;
+    std::barrier sync{processor_count, [&]() noexcept {
+        successes_per_round.push_back(successes.exchange(0));
+    }};
+
+    // Every processor stores back the value it read, so memory never changes and only the
+    // monitor can tell the stores apart.
+    std::vector<std::thread> threads;
+    for (size_t processor_id = 0; processor_id < processor_count; processor_id++) {
+        threads.emplace_back([&, processor_id] {
+            for (size_t round = 0; round < rounds; round++) {
+                const u64 value = LoadExclusive(monitor, processor_id, word, 0x1000);
+                sync.arrive_and_wait();
+                if (StoreExclusive(monitor, processor_id, word, 0x1000, value)) {
+                    successes++;
+                }
+                sync.arrive_and_wait();
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    REQUIRE(successes_per_round.size() == rounds * 2);
+    for (size_t round = 0; round < rounds; round++) {
+        REQUIRE(successes_per_round[round * 2] == 0);
+        REQUIRE(successes_per_round[round * 2 + 1] == 1);
+    }
+}
+
+TEST_CASE("Exclusive monitor: Concurrent increments are not lost", "[exclusive_monitor]") {
+    ExclusiveMonitor monitor{processor_count};
+    constexpr size_t increments = 100000;
+
+    // Two counters in the same granule and one in another, so that reservations of different
+    // addresses also race with each other.
+    std::array<std::atomic<u64>, 3> counters{};
+    constexpr std::array<VAddr, 3> addresses{0x1000, 0x1008, 0x2000};
+    std::array<std::atomic<size_t>, 3> successes{};
+
+    std::vector<std::thread> threads;
+    for (size_t processor_id = 0; processor_id < processor_count; processor_id++) {
+        threads.emplace_back([&, processor_id] {
+            for (size_t i = 0; i < increments; i++) {
+                const size_t index = (processor_id + i) % counters.size();
+                bool clear = i % 7 == 0;
+                while (true) {
+                    const u64 value = LoadExclusive(monitor, processor_id, counters[index], addresses[index]);
+                    if (clear) {
+                        // As on a context switch between the load and store.
+                        monitor.ClearProcessor(processor_id);
+                        clear = false;
+                    }
+                    if (StoreExclusive(monitor, processor_id, counters[index], addresses[index], value + 1)) {
+                        successes[index]++;
+                        break;
+                    }
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    u64 total = 0;
+    for (size_t index = 0; index < counters.size(); index++) {
+        REQUIRE(counters[index] == successes[index]);
+        total += counters[index];
+    }
+    REQUIRE(total == processor_count * increments);
+}
@@ -0,0 +1,77 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <regex>
+#include <string>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "dynarmic/frontend/A64/a64_ir_emitter.h"
+#include "dynarmic/frontend/A64/a64_location_descriptor.h"
+#include "dynarmic/ir/basic_block.h"
+#include "dynarmic/ir/serialization.h"
+
+using namespace Dynarmic;
+
+namespace {
+
+const A64::LocationDescriptor location{0x1000, {}};
+
+IR::Block MakeBlock() {
+    IR::Block block{location};
+    A64::IREmitter ir{block, location};
+    const IR::U64 loaded = ir.ReadMemory64(ir.GetX(A64::Reg::R1), IR::AccType::NORMAL);
+    ir.SetX(A64::Reg::R2, ir.Add(loaded, ir.Imm64(5)));
+    ir.SetQ(A64::Vec::V3, ir.ZeroVector());
+    ir.SetTerm(IR::Term::If{IR::Cond::EQ, IR::Term::LinkBlock{location.AdvancePC(8)}, IR::Term::ReturnToDispatch{}});
+    block.SetEndLocation(location.AdvancePC(8));
+    block.CycleCount() = 2;
+    return block;
+}
+
+/// Dumps a block without the addresses of its instructions, which differ between copies.
+std::string DumpWithoutAddresses(const IR::Block& block) {
+    static const std::regex address{"(\\[|inst )[0-9a-f]+"};
+    return std::regex_replace(IR::DumpBlock(block), address, "$1");
+}
+
+}  // namespace
+
+TEST_CASE("IR serialization: Round trip", "[ir]") {
+    const IR::Block block = MakeBlock();
+    std::vector<u8> data;
+    REQUIRE(IR::SerializeBlock(block, data));
+
+    IR::Block loaded{location};
+    REQUIRE(IR::DeserializeBlock(loaded, data));
+    REQUIRE(DumpWithoutAddresses(loaded) == DumpWithoutAddresses(block));
+}
+
+TEST_CASE("IR serialization: Truncated and corrupt input", "[ir]") {
+    const IR::Block block = MakeBlock();
+    std::vector<u8> data;
+    REQUIRE(IR::SerializeBlock(block, data));
+
+    for (size_t size = 0; size < data.size(); size++) {
+        IR::Block loaded{location};
+        REQUIRE(!IR::DeserializeBlock(loaded, {data.data(), size}));
+        REQUIRE(loaded.empty());
+    }
+
+    // Bad bytes must be rejected or decode to some valid block, without huge allocations or
+    // out of range registers. Among others, this makes the instruction count huge.
+    for (size_t i = 0; i < data.size(); i++) {
+        std::vector<u8> corrupt = data;
+        corrupt[i] = 0xFF;
+        IR::Block loaded{location};
+        if (!IR::DeserializeBlock(loaded, corrupt)) {
+            REQUIRE(loaded.empty());
+        }
+    }
+
+    std::vector<u8> trailing = data;
+    trailing.push_back(0);
+    IR::Block loaded{location};
+    REQUIRE(!IR::DeserializeBlock(loaded, trailing));
+}
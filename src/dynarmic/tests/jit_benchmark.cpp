@@ -0,0 +1,563 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+// Measures how quickly the JIT translates and runs a small corpus of guest kernels, and prints
+// the results as JSON so that runs can be compared by scripts.
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "dynarmic/common/assert.h"
+#include "dynarmic/common/common_types.h"
+#include "dynarmic/frontend/A32/a32_location_descriptor.h"
+#include "dynarmic/frontend/A32/translate/a32_translate.h"
+#include "dynarmic/frontend/A64/a64_location_descriptor.h"
+#include "dynarmic/frontend/A64/translate/a64_translate.h"
+#include "dynarmic/interface/A32/a32.h"
+#include "dynarmic/interface/A32/config.h"
+#include "dynarmic/interface/A64/a64.h"
+#include "dynarmic/interface/A64/config.h"
+#include "dynarmic/ir/basic_block.h"
+#include "dynarmic/ir/opt_passes.h"
+
+using namespace Dynarmic;
+
+namespace {
+
+constexpr size_t page_bits = 12;
+constexpr size_t page_count = 256;
+constexpr size_t memory_size = page_count << page_bits;
+
+/// Kernels are placed at address zero and work on data in [data_begin, data_end).
+constexpr u32 code_begin = 0;
+constexpr u32 data_begin = 0x10000;
+constexpr u32 data_end = 0x40000;
+
+/// Enough to compile every block of every kernel before timing starts.
+constexpr u64 warmup_ticks = 100'000;
+constexpr u64 default_ticks = 100'000'000;
+
+enum class Arch {
+    A32,
+    A64,
+};
+
+enum class Data {
+    /// Pseudo-random bytes, for kernels that treat their input as integers.
+    Bytes,
+    /// Small finite floats, so that FP kernels never see NaNs or denormals.
+    Floats,
+};
+
+struct Kernel {
+    const char* name;
+    Arch arch;
+    Data data;
+    std::vector<u32> code;
+};
+
+// Every kernel loops forever, so that a run only ends once the ticks given to it are used up.
+const std::vector<Kernel>& Corpus() {
+    static const std::vector<Kernel> corpus{
+        {"memcpy", Arch::A64, Data::Bytes, {
+             0xd2a00020,  // start: mov x0, #0x10000
+             0xd2a00041,  // mov x1, #0x20000
+             0xd2820002,  // mov x2, #4096
+             0xacc10400,  // loop: ldp q0, q1, [x0], #32
+             0xac810420,  // stp q0, q1, [x1], #32
+             0xf1008042,  // subs x2, x2, #32
+             0x54ffffa1,  // b.ne loop
+             0x17fffff9,  // b start
+         }},
+        {"matmul", Arch::A64, Data::Floats, {
+             0xd2a00020,  // start: mov x0, #0x10000
+             0xd2a00062,  // mov x2, #0x30000
+             0xd2800203,  // mov x3, #16
+             0xd2a00041,  // row: mov x1, #0x20000
+             0x4f00e404,  // movi v4.16b, #0
+             0x4f00e405,  // movi v5.16b, #0
+             0x4f00e406,  // movi v6.16b, #0
+             0x4f00e407,  // movi v7.16b, #0
+             0xd2800204,  // mov x4, #16
+             0xbc404410,  // k: ldr s16, [x0], #4
+             0x4cdf2820,  // ld1 {v0.4s-v3.4s}, [x1], #64
+             0x4f901004,  // fmla v4.4s, v0.4s, v16.s[0]
+             0x4f901025,  // fmla v5.4s, v1.4s, v16.s[0]
+             0x4f901046,  // fmla v6.4s, v2.4s, v16.s[0]
+             0x4f901067,  // fmla v7.4s, v3.4s, v16.s[0]
+             0xf1000484,  // subs x4, x4, #1
+             0x54ffff21,  // b.ne k
+             0x4c9f2844,  // st1 {v4.4s-v7.4s}, [x2], #64
+             0xf1000463,  // subs x3, x3, #1
+             0x54fffe01,  // b.ne row
+             0x17ffffec,  // b start
+         }},
+        {"sha256", Arch::A64, Data::Bytes, {
+             0xd2a00020,  // start: mov x0, #0x10000
+             0xd2800801,  // mov x1, #64
+             0xd2a00065,  // mov x5, #0x30000
+             0x4c40a8a0,  // ld1 {v0.4s, v1.4s}, [x5]
+             0x4cdf2804,  // blk: ld1 {v4.4s-v7.4s}, [x0], #64
+             0x4ea01c02,  // mov v2.16b, v0.16b
+             0x4ea11c23,  // mov v3.16b, v1.16b
+             0xd2800084,  // mov x4, #4
+             0xd2a00046,  // mov x6, #0x20000
+             0x4cdf28d0,  // rounds: ld1 {v16.4s-v19.4s}, [x6], #64
+             0x4ea48610,  // add v16.4s, v16.4s, v4.4s
+             0x4ea01c14,  // mov v20.16b, v0.16b
+             0x5e104020,  // sha256h q0, q1, v16.4s
+             0x5e105281,  // sha256h2 q1, q20, v16.4s
+             0x5e2828a4,  // sha256su0 v4.4s, v5.4s
+             0x5e0760c4,  // sha256su1 v4.4s, v6.4s, v7.4s
+             0x4ea58631,  // add v17.4s, v17.4s, v5.4s
+             0x4ea01c14,  // mov v20.16b, v0.16b
+             0x5e114020,  // sha256h q0, q1, v17.4s
+             0x5e115281,  // sha256h2 q1, q20, v17.4s
+             0x5e2828c5,  // sha256su0 v5.4s, v6.4s
+             0x5e0460e5,  // sha256su1 v5.4s, v7.4s, v4.4s
+             0x4ea68652,  // add v18.4s, v18.4s, v6.4s
+             0x4ea01c14,  // mov v20.16b, v0.16b
+             0x5e124020,  // sha256h q0, q1, v18.4s
+             0x5e125281,  // sha256h2 q1, q20, v18.4s
+             0x5e2828e6,  // sha256su0 v6.4s, v7.4s
+             0x5e056086,  // sha256su1 v6.4s, v4.4s, v5.4s
+             0x4ea78673,  // add v19.4s, v19.4s, v7.4s
+             0x4ea01c14,  // mov v20.16b, v0.16b
+             0x5e134020,  // sha256h q0, q1, v19.4s
+             0x5e135281,  // sha256h2 q1, q20, v19.4s
+             0x5e282887,  // sha256su0 v7.4s, v4.4s
+             0x5e0660a7,  // sha256su1 v7.4s, v5.4s, v6.4s
+             0xf1000484,  // subs x4, x4, #1
+             0x54fffcc1,  // b.ne rounds
+             0x4ea28400,  // add v0.4s, v0.4s, v2.4s
+             0x4ea38421,  // add v1.4s, v1.4s, v3.4s
+             0xf1000421,  // subs x1, x1, #1
+             0x54fffba1,  // b.ne blk
+             0x17ffffd8,  // b start
+         }},
+        {"fir", Arch::A64, Data::Floats, {
+             0xd2a00020,  // start: mov x0, #0x10000
+             0xd2a00041,  // mov x1, #0x20000
+             0xd2a00065,  // mov x5, #0x30000
+             0x4c40a8be,  // ld1 {v30.4s, v31.4s}, [x5]
+             0xd2802002,  // mov x2, #256
+             0x3dc00000,  // loop: ldr q0, [x0]
+             0x3dc00401,  // ldr q1, [x0, #16]
+             0x3dc00802,  // ldr q2, [x0, #32]
+             0x4f9e9003,  // fmul v3.4s, v0.4s, v30.s[0]
+             0x6e012004,  // ext v4.16b, v0.16b, v1.16b, #4
+             0x4fbe1083,  // fmla v3.4s, v4.4s, v30.s[1]
+             0x6e014004,  // ext v4.16b, v0.16b, v1.16b, #8
+             0x4f9e1883,  // fmla v3.4s, v4.4s, v30.s[2]
+             0x6e016004,  // ext v4.16b, v0.16b, v1.16b, #12
+             0x4fbe1883,  // fmla v3.4s, v4.4s, v30.s[3]
+             0x4f9f1023,  // fmla v3.4s, v1.4s, v31.s[0]
+             0x6e022024,  // ext v4.16b, v1.16b, v2.16b, #4
+             0x4fbf1083,  // fmla v3.4s, v4.4s, v31.s[1]
+             0x6e024024,  // ext v4.16b, v1.16b, v2.16b, #8
+             0x4f9f1883,  // fmla v3.4s, v4.4s, v31.s[2]
+             0x6e026024,  // ext v4.16b, v1.16b, v2.16b, #12
+             0x4fbf1883,  // fmla v3.4s, v4.4s, v31.s[3]
+             0x3c810423,  // str q3, [x1], #16
+             0x91004000,  // add x0, x0, #16
+             0xf1000442,  // subs x2, x2, #1
+             0x54fffd81,  // b.ne loop
+             0x17ffffe6,  // b start
+         }},
+        {"interpreter", Arch::A64, Data::Bytes, {
+             0xd2a00020,  // start: mov x0, #0x10000
+             0xd2808001,  // mov x1, #1024
+             0xd2800002,  // mov x2, #0
+             0x100000a3,  // adr x3, handlers
+             0x38401404,  // dispatch: ldrb w4, [x0], #1
+             0x12000484,  // and w4, w4, #3
+             0x8b041065,  // add x5, x3, x4, lsl #4
+             0xd61f00a0,  // br x5
+             0x91000c42,  // handlers: add x2, x2, #3
+             0x1400000f,  // b next
+             0xd503201f,  // nop
+             0xd503201f,  // nop
+             0xf240005f,  // tst x2, #1
+             0x54000160,  // b.eq next
+             0xd2401c42,  // eor x2, x2, #0xff
+             0x14000009,  // b next
+             0xf10fa05f,  // cmp x2, #1000
+             0x540000e3,  // b.lo next
+             0xd343fc42,  // lsr x2, x2, #3
+             0x14000005,  // b next
+             0xf1000442,  // subs x2, x2, #1
+             0x54000061,  // b.ne next
+             0xd28000e2,  // mov x2, #7
+             0x14000001,  // b next
+             0xf1000421,  // next: subs x1, x1, #1
+             0x54fffd61,  // b.ne dispatch
+             0x17ffffe6,  // b start
+         }},
+        {"memcpy", Arch::A32, Data::Bytes, {
+             0xe3a00801,  // start: mov r0, #0x10000
+             0xe3a01802,  // mov r1, #0x20000
+             0xe3a02a01,  // mov r2, #4096
+             0xe8b00ff0,  // loop: ldm r0!, {r4-r11}
+             0xe8a10ff0,  // stm r1!, {r4-r11}
+             0xe2522020,  // subs r2, r2, #32
+             0x1afffffb,  // bne loop
+             0xeafffff7,  // b start
+         }},
+        {"matmul", Arch::A32, Data::Bytes, {
+             0xe3a00801,  // start: mov r0, #0x10000
+             0xe3a02803,  // mov r2, #0x30000
+             0xe3a03008,  // mov r3, #8
+             0xe3a01802,  // row: mov r1, #0x20000
+             0xe3a04008,  // mov r4, #8
+             0xe3a05000,  // col: mov r5, #0
+             0xe3a06000,  // mov r6, #0
+             0xe7907106,  // kloop: ldr r7, [r0, r6, lsl #2]
+             0xe7918286,  // ldr r8, [r1, r6, lsl #5]
+             0xe0255897,  // mla r5, r7, r8, r5
+             0xe2866001,  // add r6, r6, #1
+             0xe3560008,  // cmp r6, #8
+             0x1afffff9,  // bne kloop
+             0xe4825004,  // str r5, [r2], #4
+             0xe2811004,  // add r1, r1, #4
+             0xe2544001,  // subs r4, r4, #1
+             0x1afffff3,  // bne col
+             0xe2800020,  // add r0, r0, #32
+             0xe2533001,  // subs r3, r3, #1
+             0x1affffee,  // bne row
+             0xeaffffea,  // b start
+         }},
+        {"fir", Arch::A32, Data::Floats, {
+             0xe3a00801,  // start: mov r0, #0x10000
+             0xe3a01802,  // mov r1, #0x20000
+             0xe3a03803,  // mov r3, #0x30000
+             0xf423ea8f,  // vld1.32 {d14, d15}, [r3]
+             0xe3a02c01,  // mov r2, #256
+             0xf420028f,  // loop: vld1.32 {d0-d3}, [r0]
+             0xf3a0494e,  // vmul.f32 q2, q0, d14[0]
+             0xf2b06442,  // vext.32 q3, q0, q1, #1
+             0xf3a6416e,  // vmla.f32 q2, q3, d14[1]
+             0xf2b06842,  // vext.32 q3, q0, q1, #2
+             0xf3a6414f,  // vmla.f32 q2, q3, d15[0]
+             0xf2b06c42,  // vext.32 q3, q0, q1, #3
+             0xf3a6416f,  // vmla.f32 q2, q3, d15[1]
+             0xf4014a8d,  // vst1.32 {d4, d5}, [r1]!
+             0xe2800010,  // add r0, r0, #16
+             0xe2522001,  // subs r2, r2, #1
+             0x1afffff3,  // bne loop
+             0xeaffffed,  // b start
+         }},
+        {"interpreter", Arch::A32, Data::Bytes, {
+             0xe3a00801,  // start: mov r0, #0x10000
+             0xe3a01b01,  // mov r1, #1024
+             0xe3a02000,  // mov r2, #0
+             0xe4d04001,  // dispatch: ldrb r4, [r0], #1
+             0xe2044003,  // and r4, r4, #3
+             0xe08ff204,  // add pc, pc, r4, lsl #4
+             0xe320f000,  // nop
+             0xe2822003,  // handlers: add r2, r2, #3
+             0xea00000d,  // b next
+             0xe320f000,  // nop
+             0xe320f000,  // nop
+             0xe3120001,  // tst r2, #1
+             0x0a000009,  // beq next
+             0xe22220ff,  // eor r2, r2, #0xff
+             0xea000007,  // b next
+             0xe3520ffa,  // cmp r2, #1000
+             0x3a000005,  // blo next
+             0xe1a021a2,  // lsr r2, r2, #3
+             0xea000003,  // b next
+             0xe2522001,  // subs r2, r2, #1
+             0x1a000001,  // bne next
+             0xe3a02007,  // mov r2, #7
+             0xeaffffff,  // b next
+             0xe2511001,  // next: subs r1, r1, #1
+             0x1affffe9,  // bne dispatch
+             0xeaffffe5,  // b start
+         }},
+    };
+    return corpus;
+}
+
+/// Flat guest memory, mirrored every memory_size bytes. The page table maps all of it, so the
+/// callbacks are only used for accesses the JIT cannot make inline.
+class GuestMemory {
+public:
+    explicit GuestMemory(const Kernel& kernel)
+            : bytes(memory_size) {
+        std::memcpy(bytes.data() + code_begin, kernel.code.data(), kernel.code.size() * sizeof(u32));
+
+        u32 lcg = 0x12345678;
+        for (u32 vaddr = data_begin; vaddr < data_end; vaddr += sizeof(u32)) {
+            lcg = lcg * 1664525 + 1013904223;
+            if (kernel.data == Data::Floats) {
+                Write<float>(vaddr, static_cast<float>(lcg >> 28) * 0.125f);
+            } else {
+                Write<u32>(vaddr, lcg);
+            }
+        }
+    }
+
+    template<typename T>
+    T Read(u64 vaddr) const {
+        T value;
+        std::memcpy(&value, bytes.data() + (vaddr & (memory_size - 1)), sizeof(T));
+        return value;
+    }
+
+    template<typename T>
+    void Write(u64 vaddr, T value) {
+        std::memcpy(bytes.data() + (vaddr & (memory_size - 1)), &value, sizeof(T));
+    }
+
+    u8* Page(size_t index) {
+        return bytes.data() + (index << page_bits);
+    }
+
+private:
+    std::vector<u8> bytes;
+};
+
+class A64BenchmarkEnv final : public A64::UserCallbacks {
+public:
+    explicit A64BenchmarkEnv(GuestMemory& memory)
+            : memory(memory) {}
+
+    u64 ticks_left = 0;
+
+    std::uint8_t MemoryRead8(u64 vaddr) override { return memory.Read<u8>(vaddr); }
+    std::uint16_t MemoryRead16(u64 vaddr) override { return memory.Read<u16>(vaddr); }
+    std::uint32_t MemoryRead32(u64 vaddr) override { return memory.Read<u32>(vaddr); }
+    std::uint64_t MemoryRead64(u64 vaddr) override { return memory.Read<u64>(vaddr); }
+    A64::Vector MemoryRead128(u64 vaddr) override { return {memory.Read<u64>(vaddr), memory.Read<u64>(vaddr + 8)}; }
+
+    void MemoryWrite8(u64 vaddr, std::uint8_t value) override { memory.Write(vaddr, value); }
+    void MemoryWrite16(u64 vaddr, std::uint16_t value) override { memory.Write(vaddr, value); }
+    void MemoryWrite32(u64 vaddr, std::uint32_t value) override { memory.Write(vaddr, value); }
+    void MemoryWrite64(u64 vaddr, std::uint64_t value) override { memory.Write(vaddr, value); }
+    void MemoryWrite128(u64 vaddr, A64::Vector value) override {
+        memory.Write(vaddr, value[0]);
+        memory.Write(vaddr + 8, value[1]);
+    }
+
+    void InterpreterFallback(u64, size_t) override { UNREACHABLE(); }
+    void CallSVC(std::uint32_t) override { UNREACHABLE(); }
+    void ExceptionRaised(u64, A64::Exception) override { UNREACHABLE(); }
+
+    void AddTicks(std::uint64_t ticks) override { ticks_left -= std::min(ticks, ticks_left); }
+    std::uint64_t GetTicksRemaining() override { return ticks_left; }
+    std::uint64_t GetCNTPCT() override { return 0; }
+
+private:
+    GuestMemory& memory;
+};
+
+class A32BenchmarkEnv final : public A32::UserCallbacks {
+public:
+    explicit A32BenchmarkEnv(GuestMemory& memory)
+            : memory(memory) {}
+
+    u64 ticks_left = 0;
+
+    std::uint8_t MemoryRead8(u32 vaddr) override { return memory.Read<u8>(vaddr); }
+    std::uint16_t MemoryRead16(u32 vaddr) override { return memory.Read<u16>(vaddr); }
+    std::uint32_t MemoryRead32(u32 vaddr) override { return memory.Read<u32>(vaddr); }
+    std::uint64_t MemoryRead64(u32 vaddr) override { return memory.Read<u64>(vaddr); }
+
+    void MemoryWrite8(u32 vaddr, std::uint8_t value) override { memory.Write(vaddr, value); }
+    void MemoryWrite16(u32 vaddr, std::uint16_t value) override { memory.Write(vaddr, value); }
+    void MemoryWrite32(u32 vaddr, std::uint32_t value) override { memory.Write(vaddr, value); }
+    void MemoryWrite64(u32 vaddr, std::uint64_t value) override { memory.Write(vaddr, value); }
+
+    void InterpreterFallback(u32, size_t) override { UNREACHABLE(); }
+    void CallSVC(std::uint32_t) override { UNREACHABLE(); }
+    void ExceptionRaised(u32, A32::Exception) override { UNREACHABLE(); }
+
+    void AddTicks(std::uint64_t ticks) override { ticks_left -= std::min(ticks, ticks_left); }
+    std::uint64_t GetTicksRemaining() override { return ticks_left; }
+
+private:
+    GuestMemory& memory;
+};
+
+struct IRSize {
+    size_t blocks = 0;
+    size_t unoptimized = 0;
+    size_t optimized = 0;
+};
+
+struct Result {
+    IRSize ir;
+    CodeCacheStatistics compile;
+    u64 executed_instructions = 0;
+    double seconds = 0.0;
+};
+
+/// Translates a kernel block by block from start to end, as laid out in memory rather than as
+/// executed, and adds up the IR instruction counts before and after optimization.
+template<typename TranslateBlock>
+IRSize MeasureIR(const Kernel& kernel, TranslateBlock translate_block) {
+    IRSize size;
+    const u64 code_end = code_begin + kernel.code.size() * sizeof(u32);
+    for (u64 pc = code_begin; pc < code_end;) {
+        pc = translate_block(pc, size);
+        size.blocks++;
+    }
+    return size;
+}
+
+template<typename JitT, typename Env>
+void Measure(JitT& jit, Env& env, u64 ticks, Result& result) {
+    // The warm up compiles the kernel, so that the timed run measures generated code only.
+    env.ticks_left = warmup_ticks;
+    jit.Run();
+    result.compile = jit.GetCodeCacheStatistics();
+
+    env.ticks_left = ticks;
+    const auto start_time = std::chrono::steady_clock::now();
+    jit.Run();
+    result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+    result.executed_instructions = ticks - env.ticks_left;
+}
+
+Result RunA64(const Kernel& kernel, u64 ticks, bool noopt) {
+    GuestMemory memory{kernel};
+    A64BenchmarkEnv env{memory};
+
+    std::vector<void*> page_table(page_count);
+    for (size_t i = 0; i < page_count; i++) {
+        page_table[i] = memory.Page(i);
+    }
+
+    A64::UserConfig conf{};
+    conf.callbacks = &env;
+    conf.page_table = page_table.data();
+    conf.page_table_address_space_bits = 20;
+    conf.silently_mirror_page_table = true;
+    if (noopt) {
+        conf.optimizations = no_optimizations;
+    }
+
+    Result result;
+    result.ir = MeasureIR(kernel, [&](u64 pc, IRSize& size) {
+        const auto get_code = [&env](u64 vaddr) { return env.MemoryReadCode(vaddr); };
+        IR::Block block{A64::LocationDescriptor{pc, {}}};
+        A64::Translate(block, A64::LocationDescriptor{pc, {}}, get_code, {conf.define_unpredictable_behaviour, conf.wall_clock_cntpct});
+        size.unoptimized += block.size();
+        Optimization::Optimize(block, conf, {});
+        size.optimized += block.size();
+        return A64::LocationDescriptor{block.EndLocation()}.PC();
+    });
+
+    A64::Jit jit{conf};
+    jit.SetPC(code_begin);
+    Measure(jit, env, ticks, result);
+    return result;
+}
+
+Result RunA32(const Kernel& kernel, u64 ticks, bool noopt) {
+    GuestMemory memory{kernel};
+    A32BenchmarkEnv env{memory};
+
+    auto page_table = std::make_unique<std::array<u8*, A32::UserConfig::NUM_PAGE_TABLE_ENTRIES>>();
+    page_table->fill(nullptr);
+    for (size_t i = 0; i < page_count; i++) {
+        (*page_table)[i] = memory.Page(i);
+    }
+
+    A32::UserConfig conf{};
+    conf.callbacks = &env;
+    conf.page_table = page_table.get();
+    if (noopt) {
+        conf.optimizations = no_optimizations;
+    }
+
+    Result result;
+    result.ir = MeasureIR(kernel, [&](u64 pc, IRSize& size) {
+        const A32::LocationDescriptor location{static_cast<u32>(pc), A32::PSR{0x000001d0}, A32::FPSCR{}};
+        IR::Block block = A32::Translate(location, &env, {conf.arch_version, conf.define_unpredictable_behaviour, conf.hook_hint_instructions});
+        size.unoptimized += block.size();
+        Optimization::Optimize(block, conf, {});
+        size.optimized += block.size();
+        return u64{A32::LocationDescriptor{block.EndLocation()}.PC()};
+    });
+
+    A32::Jit jit{conf};
+    jit.Regs()[15] = code_begin;
+    jit.SetCpsr(0x000001d0);  // User-mode
+    Measure(jit, env, ticks, result);
+    return result;
+}
+
+void PrintResult(const Kernel& kernel, const Result& result, bool last) {
+    const double compile_ns = static_cast<double>(result.compile.compile_time.count());
+    const double ns_per_instruction = result.compile.compiled_instructions ? compile_ns / result.compile.compiled_instructions : 0.0;
+    const double instructions_per_second = result.seconds > 0.0 ? result.executed_instructions / result.seconds : 0.0;
+
+    fmt::print("    {{\n");
+    fmt::print("      \"name\": \"{}\",\n", kernel.name);
+    fmt::print("      \"arch\": \"{}\",\n", kernel.arch == Arch::A64 ? "a64" : "a32");
+    fmt::print("      \"guest_instructions\": {},\n", kernel.code.size());
+    fmt::print("      \"ir\": {{\"blocks\": {}, \"instructions_before_optimize\": {}, \"instructions_after_optimize\": {}}},\n",
+               result.ir.blocks, result.ir.unoptimized, result.ir.optimized);
+    fmt::print("      \"compile\": {{\"blocks\": {}, \"guest_instructions\": {}, \"emitted_bytes\": {}, \"time_ns\": {}, \"ns_per_guest_instruction\": {:.1f}}},\n",
+               result.compile.compiled_blocks, result.compile.compiled_instructions, result.compile.emitted_bytes,
+               result.compile.compile_time.count(), ns_per_instruction);
+    fmt::print("      \"run\": {{\"guest_instructions\": {}, \"seconds\": {:.6f}, \"guest_instructions_per_second\": {:.0f}}}\n",
+               result.executed_instructions, result.seconds, instructions_per_second);
+    fmt::print("    }}{}\n", last ? "" : ",");
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    u64 ticks = default_ticks;
+    bool noopt = false;
+    std::optional<std::string_view> filter;
+
+    for (int i = 1; i < argc; i++) {
+        const std::string_view arg{argv[i]};
+        if (arg == "--ticks" && i + 1 < argc) {
+            ticks = std::strtoull(argv[++i], nullptr, 10);
+        } else if (arg == "noopt") {
+            noopt = true;
+        } else if (!arg.starts_with("-") && !filter) {
+            filter = arg;
+        } else {
+            fmt::print(stderr, "Usage: {} [--ticks <n>] [noopt] [a32|a64|<kernel name>]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    std::vector<const Kernel*> selected;
+    for (const Kernel& kernel : Corpus()) {
+        const std::string_view arch = kernel.arch == Arch::A64 ? "a64" : "a32";
+        if (!filter || *filter == arch || *filter == kernel.name) {
+            selected.push_back(&kernel);
+        }
+    }
+
+    fmt::print("{{\n");
+    fmt::print("  \"ticks\": {},\n", ticks);
+    fmt::print("  \"optimizations\": {},\n", !noopt);
+    fmt::print("  \"kernels\": [\n");
+    for (size_t i = 0; i < selected.size(); i++) {
+        const Kernel& kernel = *selected[i];
+        const Result result = kernel.arch == Arch::A64 ? RunA64(kernel, ticks, noopt) : RunA32(kernel, ticks, noopt);
+        PrintResult(kernel, result, i + 1 == selected.size());
+        std::fflush(stdout);
+    }
+    fmt::print("  ]\n");
+    fmt::print("}}\n");
+
+    return 0;
+}
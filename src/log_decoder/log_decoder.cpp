@@ -0,0 +1,158 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+// Converts a binary log written with `binary_logging` enabled back into the text log format.
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "common/logging/deferred.h"
+#include "common/logging/log_entry.h"
+#include "common/logging/text_formatter.h"
+
+namespace {
+
+using namespace Common::Log;
+
+class Reader {
+public:
+    explicit Reader(std::vector<u8> data_) : data{std::move(data_)} {}
+
+    template <typename T>
+    bool Read(T& value) {
+        if (data.size() - offset < sizeof(T)) {
+            return false;
+        }
+        std::memcpy(&value, data.data() + offset, sizeof(T));
+        offset += sizeof(T);
+        return true;
+    }
+
+    bool ReadBytes(std::size_t size, std::span<const u8>& out) {
+        if (data.size() - offset < size) {
+            return false;
+        }
+        out = {data.data() + offset, size};
+        offset += size;
+        return true;
+    }
+
+    bool AtEnd() const {
+        return offset == data.size();
+    }
+
+private:
+    std::vector<u8> data;
+    std::size_t offset = 0;
+};
+
+int Decode(Reader& reader, std::FILE* out) {
+    Deferred::Binary::FileHeader header{};
+    if (!reader.Read(header) || header.magic != Deferred::Binary::Magic) {
+        fmt::print(stderr, "Not an eden binary log\n");
+        return 1;
+    }
+    if (header.version != Deferred::Binary::Version) {
+        fmt::print(stderr, "Unsupported binary log version {}\n", header.version);
+        return 1;
+    }
+
+    std::unordered_map<u32, std::string> strings;
+    const auto lookup = [&strings](u32 id) -> std::string {
+        const auto it = strings.find(id);
+        return it != strings.end() ? it->second : fmt::format("<string {}>", id);
+    };
+
+    while (!reader.AtEnd()) {
+        Deferred::Binary::ChunkKind kind{};
+        if (!reader.Read(kind)) {
+            break;
+        }
+        switch (kind) {
+        case Deferred::Binary::ChunkKind::String: {
+            u32 id{};
+            u32 size{};
+            std::span<const u8> bytes;
+            if (!reader.Read(id) || !reader.Read(size) || !reader.ReadBytes(size, bytes)) {
+                fmt::print(stderr, "Truncated string chunk\n");
+                return 1;
+            }
+            strings[id].assign(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+            break;
+        }
+        case Deferred::Binary::ChunkKind::Message: {
+            u64 timestamp{};
+            Class log_class{};
+            Level log_level{};
+            u8 num_args{};
+            u32 line_num{};
+            u32 file_id{};
+            u32 function_id{};
+            u32 format_id{};
+            u32 args_size{};
+            std::span<const u8> args;
+            if (!reader.Read(timestamp) || !reader.Read(log_class) || !reader.Read(log_level) ||
+                !reader.Read(num_args) || !reader.Read(line_num) || !reader.Read(file_id) ||
+                !reader.Read(function_id) || !reader.Read(format_id) || !reader.Read(args_size) ||
+                !reader.ReadBytes(args_size, args)) {
+                fmt::print(stderr, "Truncated message chunk\n");
+                return 1;
+            }
+            const std::string filename = lookup(file_id);
+            const Entry entry{
+                .timestamp = std::chrono::microseconds{timestamp},
+                .log_class = log_class,
+                .log_level = log_level,
+                .filename = filename.c_str(),
+                .line_num = line_num,
+                .function = lookup(function_id),
+                .message = Deferred::FormatArgs(lookup(format_id), args, num_args),
+            };
+            fmt::print(out, "{}\n", FormatLogMessage(entry));
+            break;
+        }
+        default:
+            fmt::print(stderr, "Unknown chunk kind {}\n", static_cast<u8>(kind));
+            return 1;
+        }
+    }
+    return 0;
+}
+
+} // Anonymous namespace
+
+int main(int argc, char** argv) {
+    if (argc < 2 || argc > 3) {
+        fmt::print(stderr, "Usage: {} <eden_log.bin> [output.txt]\n", argv[0]);
+        return 1;
+    }
+
+    std::ifstream input{argv[1], std::ios::binary};
+    if (!input) {
+        fmt::print(stderr, "Could not open {}\n", argv[1]);
+        return 1;
+    }
+    Reader reader{std::vector<u8>(std::istreambuf_iterator<char>(input), {})};
+
+    std::FILE* out = stdout;
+    if (argc == 3) {
+        out = std::fopen(argv[2], "w");
+        if (!out) {
+            fmt::print(stderr, "Could not open {} for writing\n", argv[2]);
+            return 1;
+        }
+    }
+    const int result = Decode(reader, out);
+    if (out != stdout) {
+        std::fclose(out);
+    }
+    return result;
+}
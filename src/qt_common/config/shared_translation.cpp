@@ -72,6 +72,12 @@ std::unique_ptr<TranslationMap> InitializeTranslations(QObject* parent)
         tr("Increases the amount of emulated RAM from 4GB of the board to the "
            "devkit 8/6GB.\nDoesn't affect performance/stability but may allow HD texture "
            "mods to load."));
+    INSERT(Settings,
+           huge_pages,
+           tr("Huge Pages"),
+           tr("Backs emulated RAM with 2MB host pages to reduce TLB misses (Linux only).\n"
+              "Explicit mode needs a reserved hugetlb pool and disables fastmem.\n"
+              "Requires a restart to take effect."));
     INSERT(Settings, use_speed_limit, QString(), QString());
     INSERT(Settings,
            speed_limit,
@@ -113,6 +119,17 @@ std::unique_ptr<TranslationMap> InitializeTranslations(QObject* parent)
     INSERT(Settings, vtable_bouncing,
         tr("Virtual Table Bouncing"),
         tr("Bounces (by emulating a 0-valued return) any functions that triggers a prefetch abort"));
+    INSERT(Settings,
+           use_jit_translation_cache,
+           tr("Use persistent JIT cache"),
+           tr("Saves translated CPU code to disk so later launches of the same game skip most "
+              "of the JIT warm-up.\nOnly applies to 64-bit games running on Dynarmic."));
+    INSERT(Settings,
+           use_speculative_jit_compilation,
+           tr("Compile CPU code ahead of time"),
+           tr("Translates code the game is about to reach on a separate thread, which reduces "
+              "stutter when new areas load.\nUses an extra CPU core. Only applies to 64-bit "
+              "games running on Dynarmic."));
 
     // Cpu Debug
 
@@ -725,6 +742,12 @@ std::unique_ptr<ComboboxTranslationMap> ComboboxEnumeration(QObject* parent)
                               PAIR(GpuOverclock, Medium, tr("Medium (256)")),
                               PAIR(GpuOverclock, High, tr("High (512)")),
                           }});
+    translations->insert({Settings::EnumMetadata<Settings::HugePages>::Index(),
+                          {
+                              PAIR(HugePages, Off, tr("Off")),
+                              PAIR(HugePages, Transparent, tr("Transparent (madvise)")),
+                              PAIR(HugePages, HugeTlb, tr("Explicit (hugetlbfs)")),
+                          }});
 
 #undef PAIR
 #undef CTX_PAIR
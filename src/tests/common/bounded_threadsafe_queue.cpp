@@ -0,0 +1,107 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <array>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/bounded_threadsafe_queue.h"
+#include "common/common_types.h"
+
+TEST_CASE("BoundedQueue: Ranges stop at capacity", "[common]") {
+    Common::SPSCQueue<std::string, 8> queue;
+    std::vector<std::string> items(12);
+    for (size_t i = 0; i < items.size(); ++i) {
+        items[i] = std::to_string(i);
+    }
+
+    REQUIRE(queue.TryPushRange(items) == 8);
+    REQUIRE(!queue.TryEmplace("full"));
+
+    std::array<std::string, 5> out;
+    REQUIRE(queue.TryPopRange(out) == 5);
+    REQUIRE(out == std::array<std::string, 5>{"0", "1", "2", "3", "4"});
+
+    // The remaining items wrap around the end of the ring.
+    REQUIRE(queue.TryPushRange(std::span{items}.subspan(8)) == 4);
+    std::vector<std::string> rest(16);
+    REQUIRE(queue.TryPopRange(rest) == 7);
+    rest.resize(7);
+    REQUIRE(rest == std::vector<std::string>{"5", "6", "7", "8", "9", "10", "11"});
+    REQUIRE(queue.TryPopRange(out) == 0);
+}
+
+TEST_CASE("BoundedQueue: Batches keep order across threads", "[common]") {
+    constexpr u64 NumItems = 100000;
+    Common::SPSCQueue<u64, 64> queue;
+
+    std::jthread producer{[&] {
+        std::array<u64, 37> batch;
+        u64 next = 0;
+        while (next < NumItems) {
+            const size_t count = std::min<u64>(batch.size(), NumItems - next);
+            std::iota(batch.begin(), batch.begin() + count, next);
+            queue.PushRangeWait(std::span{batch}.first(count));
+            next += count;
+        }
+    }};
+
+    std::array<u64, 23> out;
+    u64 expected = 0;
+    while (expected < NumItems) {
+        const size_t count = queue.PopRangeWait(out);
+        REQUIRE(count != 0);
+        for (size_t i = 0; i < count; ++i) {
+            REQUIRE(out[i] == expected++);
+        }
+    }
+}
+
+TEST_CASE("BoundedQueue: Producers interleave with batches", "[common]") {
+    constexpr u64 NumProducers = 4;
+    constexpr u64 ItemsPerProducer = 20000;
+    Common::MPSCQueue<u64, 128> queue;
+
+    std::vector<std::jthread> producers;
+    for (u64 producer = 0; producer < NumProducers; ++producer) {
+        producers.emplace_back([&queue, producer] {
+            for (u64 i = 0; i < ItemsPerProducer; ++i) {
+                if (i % 2 == 0) {
+                    queue.EmplaceWait(producer << 32 | i);
+                } else {
+                    std::array<u64, 1> item{producer << 32 | i};
+                    queue.PushRangeWait(item);
+                }
+            }
+        });
+    }
+
+    // Every producer's items must arrive in the order it pushed them.
+    std::array<u64, NumProducers> next{};
+    std::array<u64, 16> out;
+    for (u64 received = 0; received < NumProducers * ItemsPerProducer;) {
+        const size_t count = queue.PopRangeWait(out);
+        for (size_t i = 0; i < count; ++i) {
+            REQUIRE((out[i] & 0xffffffff) == next[out[i] >> 32]++);
+        }
+        received += count;
+    }
+}
+
+TEST_CASE("BoundedQueue: Stop request wakes a parked consumer", "[common]") {
+    Common::SPSCQueue<u64> queue;
+    std::array<u64, 4> out;
+    size_t popped = 1;
+
+    std::jthread consumer{[&](std::stop_token stop_token) {
+        popped = queue.PopRangeWait(out, stop_token);
+    }};
+    std::this_thread::sleep_for(std::chrono::milliseconds{20});
+    consumer.request_stop();
+    consumer.join();
+    REQUIRE(popped == 0);
+}
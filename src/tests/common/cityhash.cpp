@@ -1,14 +1,33 @@
 // SPDX-FileCopyrightText: Copyright 2021 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
+#include <fmt/format.h>
 
 #include "common/cityhash.h"
+#include "common/literals.h"
+#include "common/xxh3.h"
 
 constexpr char msg[] = "The blue frogs are singing under the crimson sky.\n"
                        "It is time to run, Robert.";
 
 using namespace Common;
+using namespace Common::Literals;
+
+namespace {
+
+std::vector<u8> MakeSequence(size_t size) {
+    std::vector<u8> data(size);
+    std::iota(data.begin(), data.end(), u8{0});
+    return data;
+}
+
+} // Anonymous namespace
 
 TEST_CASE("CityHash", "[common]") {
     // These test results were built against a known good version.
@@ -19,3 +38,40 @@ TEST_CASE("CityHash", "[common]") {
     REQUIRE(CityHash128WithSeed(msg, sizeof(msg), {0xdead, 0xbeef}) ==
             u128{0xf0307dba81199ebe, 0xd77764e0c4a9eb74});
 }
+
+TEST_CASE("XXH3", "[common]") {
+    // These test results match the reference XXH3_64bits implementation.
+    REQUIRE(XXH3Hash64(nullptr, 0) == 0x2d06800538d394c2);
+    REQUIRE(XXH3Hash64(msg, sizeof(msg)) == 0xf7626818c7493e4b);
+    REQUIRE(XXH3Hash64WithSeed(msg, sizeof(msg), 0xdead) == 0xcc015b604638eff0);
+
+    const std::vector<u8> data = MakeSequence(4096);
+    REQUIRE(XXH3Hash64(data.data(), data.size()) == 0xeb4b7c3707879151);
+    REQUIRE(XXH3Hash64WithSeed(data.data(), data.size(), 0xdead) == 0xf6172c1215147412);
+}
+
+TEST_CASE("XXH3: Streaming matches one-shot", "[common]") {
+    const std::vector<u8> data = MakeSequence(5000);
+    for (const size_t size : {size_t{0}, size_t{17}, size_t{240}, size_t{241}, size_t{1024},
+                              size_t{1025}, size_t{5000}}) {
+        for (const size_t chunk : {size_t{1}, size_t{63}, size_t{64}, size_t{257}}) {
+            XXH3Hasher hasher{0xdead};
+            for (size_t offset = 0; offset < size; offset += chunk) {
+                hasher.Update(data.data() + offset, std::min(chunk, size - offset));
+            }
+            REQUIRE(hasher.Digest() == XXH3Hash64WithSeed(data.data(), size, 0xdead));
+        }
+    }
+}
+
+TEST_CASE("XXH3: Throughput", "[.][benchmark]") {
+    for (size_t size = 64; size <= 4_MiB; size *= 4) {
+        const std::vector<u8> data = MakeSequence(size);
+        BENCHMARK(fmt::format("CityHash64 {} bytes", size)) {
+            return CityHash64(reinterpret_cast<const char*>(data.data()), data.size());
+        };
+        BENCHMARK(fmt::format("XXH3Hash64 {} bytes ({})", size, XXH3KernelName())) {
+            return XXH3Hash64(data.data(), data.size());
+        };
+    }
+}
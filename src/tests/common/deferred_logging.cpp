@@ -0,0 +1,85 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <array>
+#include <string>
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+#include "common/common_types.h"
+#include "common/logging/deferred.h"
+
+namespace {
+
+enum class NamedEnum : u32 {
+    Value,
+};
+
+} // Anonymous namespace
+
+template <>
+struct fmt::formatter<NamedEnum> : fmt::formatter<std::string_view> {
+    template <typename FormatContext>
+    auto format(NamedEnum, FormatContext& ctx) const {
+        return fmt::formatter<std::string_view>::format("Value", ctx);
+    }
+};
+
+namespace Common::Log::Deferred {
+
+namespace {
+
+enum class TestEnum : u32 {
+    Value = 0x2A,
+};
+
+template <typename... Args>
+std::string RoundTrip(std::string_view format, const Args&... args) {
+    std::vector<u8> buffer((std::size_t{0} + ... + detail::EncodedSize(args)));
+    u8* out = buffer.data();
+    ((out = detail::Encode(out, args)), ...);
+    const std::size_t size = static_cast<std::size_t>(out - buffer.data());
+    REQUIRE(size == buffer.size());
+    return FormatArgs(format, std::span<const u8>(buffer.data(), size), sizeof...(Args));
+}
+
+} // Anonymous namespace
+
+TEST_CASE("DeferredLogging: Argument round trip", "[common]") {
+    const std::string owned = "owned";
+    REQUIRE(RoundTrip("{} {} {}", 1, -2, u64{0xFFFFFFFFFFFFFFFF}) == "1 -2 18446744073709551615");
+    REQUIRE(RoundTrip("{:08X} {:#x}", 0xABCu, u8{0x10}) == "00000ABC 0x10");
+    REQUIRE(RoundTrip("{} {}", TestEnum::Value, true) == "42 true");
+    REQUIRE(RoundTrip("{:.2f} {}", 3.14159, 'c') == "3.14 c");
+    REQUIRE(RoundTrip("{} {} {}", owned, "literal", std::string_view{"view"}) ==
+            "owned literal view");
+    REQUIRE(RoundTrip("no arguments") == "no arguments");
+}
+
+TEST_CASE("DeferredLogging: String arguments", "[common]") {
+    char array[8] = "array";
+    const char unterminated[4] = {'a', 'b', 'c', 'd'};
+    const char* const null_string = nullptr;
+    REQUIRE(RoundTrip("{} {} {}", array, unterminated, null_string) == "array abcd (null)");
+
+    const std::string long_string(MaxStringArgSize + 1, 'x');
+    const std::string logged = RoundTrip("{}", long_string);
+    REQUIRE(logged == long_string.substr(0, MaxStringArgSize) + std::string{TruncationMarker});
+    const std::string exact(MaxStringArgSize, 'x');
+    REQUIRE(RoundTrip("{}", exact) == exact);
+}
+
+TEST_CASE("DeferredLogging: Malformed input", "[common]") {
+    REQUIRE(RoundTrip("{} {}", 1).starts_with("<log format error"));
+    const std::array<u8, 3> truncated{static_cast<u8>(ArgType::Signed), 0, 0};
+    REQUIRE(FormatArgs("{}", truncated, 1).starts_with("<truncated log arguments>"));
+}
+
+TEST_CASE("DeferredLogging: Argument eligibility", "[common]") {
+    STATIC_REQUIRE(CanDefer<int, u64, double, bool, TestEnum, std::string, const char*>);
+    STATIC_REQUIRE(CanDefer<>);
+    STATIC_REQUIRE_FALSE(CanDefer<std::array<int, 2>>);
+    // Deferring would print the value instead of the name from the formatter.
+    STATIC_REQUIRE_FALSE(CanDefer<NamedEnum>);
+}
+
+} // namespace Common::Log::Deferred
@@ -184,3 +184,28 @@ TEST_CASE("HostMemory: Partial sparse middle unmap and check bindings", "[common
     REQUIRE(ptr[0x0000] == 19);
     REQUIRE(ptr[0x3fff] == 12);
 }
+
+TEST_CASE("HostMemory: Transparent huge pages map", "[common]") {
+    HostMemory mem(BACKING_SIZE, VIRTUAL_SIZE, Settings::HugePages::Transparent);
+    REQUIRE(mem.HugePageMode() != Settings::HugePages::HugeTlb);
+    mem.Map(0x200000, 0x400000, 0x400000, PERMS, HEAP);
+
+    volatile u8* const data = mem.VirtualBasePointer() + 0x200000;
+    data[0] = 42;
+    data[0x3fffff] = 24;
+    REQUIRE(data[0] == 42);
+    REQUIRE(data[0x3fffff] == 24);
+    REQUIRE(mem.BackingBasePointer()[0x400000] == 42);
+}
+
+TEST_CASE("HostMemory: Explicit huge pages fall back or disable fastmem", "[common]") {
+    HostMemory mem(BACKING_SIZE, VIRTUAL_SIZE, Settings::HugePages::HugeTlb);
+    if (mem.HugePageMode() == Settings::HugePages::HugeTlb) {
+        REQUIRE(mem.VirtualBasePointer() == nullptr);
+    } else {
+        REQUIRE(mem.VirtualBasePointer() != nullptr);
+    }
+    u8* const backing = mem.BackingBasePointer();
+    backing[0] = 7;
+    REQUIRE(backing[0] == 7);
+}
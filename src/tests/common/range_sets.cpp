@@ -0,0 +1,211 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <random>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <boost/icl/interval_set.hpp>
+#include <boost/icl/split_interval_map.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "common/range_sets.h"
+#include "common/range_sets.inc"
+
+namespace {
+
+using Ranges = std::vector<std::pair<u64, u64>>;
+using CountedRanges = std::vector<std::tuple<u64, u64, s32>>;
+
+// The boost::icl containers the range sets used to be built on serve as the reference.
+using ReferenceSet = boost::icl::interval_set<u64>;
+using ReferenceOverlapSet =
+    boost::icl::split_interval_map<u64, s32, boost::icl::partial_enricher, std::less,
+                                   boost::icl::inplace_plus, boost::icl::inter_section>;
+using ReferenceInterval = ReferenceSet::interval_type;
+
+Ranges Collect(const Common::RangeSet<u64>& set) {
+    Ranges result;
+    set.ForEach([&](u64 begin, u64 end) { result.emplace_back(begin, end); });
+    return result;
+}
+
+Ranges Collect(const ReferenceSet& set) {
+    Ranges result;
+    for (const auto& interval : set) {
+        result.emplace_back(interval.lower(), interval.upper());
+    }
+    return result;
+}
+
+CountedRanges Collect(const Common::OverlapRangeSet<u64>& set) {
+    CountedRanges result;
+    set.ForEach([&](u64 begin, u64 end, s32 count) { result.emplace_back(begin, end, count); });
+    return result;
+}
+
+CountedRanges Collect(const ReferenceOverlapSet& set) {
+    CountedRanges result;
+    for (const auto& [interval, count] : set) {
+        result.emplace_back(interval.lower(), interval.upper(), count);
+    }
+    return result;
+}
+
+void SubtractReference(ReferenceOverlapSet& set, u64 begin, u64 size, s32 amount,
+                       Ranges* deleted) {
+    const ReferenceInterval interval{begin, begin + size};
+    set += std::make_pair(interval, -amount);
+    bool any_removals;
+    do {
+        any_removals = false;
+        for (auto it = set.lower_bound(interval); it != set.upper_bound(interval); ++it) {
+            if (it->second <= 0) {
+                if (deleted && it->second == 0) {
+                    deleted->emplace_back(it->first.lower(), it->first.upper());
+                }
+                set.erase(it);
+                any_removals = true;
+                break;
+            }
+        }
+    } while (any_removals);
+}
+
+} // Anonymous namespace
+
+TEST_CASE("RangeSet: Add joins touching ranges", "[common]") {
+    Common::RangeSet<u64> set;
+    set.Add(0x1000, 0x1000);
+    set.Add(0x3000, 0x1000);
+    set.Add(0x2000, 0x1000);
+    REQUIRE(Collect(set) == Ranges{{0x1000, 0x4000}});
+
+    set.Subtract(0x1800, 0x1000);
+    REQUIRE(Collect(set) == Ranges{{0x1000, 0x1800}, {0x2800, 0x4000}});
+
+    Ranges in_range;
+    set.ForEachInRange(0x1400, 0x2000, [&](u64 begin, u64 end) { in_range.emplace_back(begin, end); });
+    REQUIRE(in_range == Ranges{{0x1400, 0x1800}, {0x2800, 0x3400}});
+
+    set.Clear();
+    REQUIRE(set.Empty());
+}
+
+TEST_CASE("RangeSet: Random operations match boost::icl", "[common]") {
+    std::mt19937_64 rng{0x5eed};
+    std::uniform_int_distribution<u64> address{0, 0x40000};
+    std::uniform_int_distribution<u64> size{0, 0x2000};
+
+    Common::RangeSet<u64> set;
+    ReferenceSet reference;
+    for (int i = 0; i < 20000; ++i) {
+        const u64 begin = address(rng);
+        const u64 length = size(rng);
+        if (rng() % 3 != 0) {
+            set.Add(begin, length);
+            reference.add(ReferenceInterval{begin, begin + length});
+        } else {
+            set.Subtract(begin, length);
+            reference.subtract(ReferenceInterval{begin, begin + length});
+        }
+        if (i % 256 == 0) {
+            REQUIRE(Collect(set) == Collect(reference));
+        }
+    }
+    REQUIRE(Collect(set) == Collect(reference));
+
+    for (int i = 0; i < 1000; ++i) {
+        const u64 begin = address(rng);
+        const u64 length = size(rng) + 1;
+        Ranges in_range;
+        set.ForEachInRange(begin, length,
+                           [&](u64 lower, u64 upper) { in_range.emplace_back(lower, upper); });
+        Ranges expected;
+        for (const auto& interval : reference & ReferenceInterval{begin, begin + length}) {
+            expected.emplace_back(interval.lower(), interval.upper());
+        }
+        REQUIRE(in_range == expected);
+    }
+}
+
+TEST_CASE("RangeSet: Merging sets matches boost::icl", "[common]") {
+    std::mt19937_64 rng{0xb01d};
+    std::uniform_int_distribution<u64> address{0, 0x100000};
+    std::uniform_int_distribution<u64> size{1, 0x3000};
+
+    for (const size_t other_ranges : {4, 64, 4096}) {
+        Common::RangeSet<u64> set;
+        Common::RangeSet<u64> other;
+        ReferenceSet reference;
+        ReferenceSet reference_other;
+        for (int i = 0; i < 2048; ++i) {
+            const u64 begin = address(rng);
+            const u64 length = size(rng);
+            set.Add(begin, length);
+            reference.add(ReferenceInterval{begin, begin + length});
+        }
+        for (size_t i = 0; i < other_ranges; ++i) {
+            const u64 begin = address(rng);
+            const u64 length = size(rng);
+            other.Add(begin, length);
+            reference_other.add(ReferenceInterval{begin, begin + length});
+        }
+
+        set.Subtract(other);
+        reference -= reference_other;
+        REQUIRE(Collect(set) == Collect(reference));
+
+        set.Add(other);
+        reference += reference_other;
+        REQUIRE(Collect(set) == Collect(reference));
+
+        // Both sets must stay usable after a bulk rebuild.
+        set.Add(0x123, 0x4567);
+        set.Subtract(0x2000, 0x100);
+        reference.add(ReferenceInterval{0x123, 0x123 + 0x4567});
+        reference.subtract(ReferenceInterval{0x2000, 0x2100});
+        REQUIRE(Collect(set) == Collect(reference));
+        REQUIRE(Collect(other) == Collect(reference_other));
+    }
+}
+
+TEST_CASE("OverlapRangeSet: Random operations match boost::icl", "[common]") {
+    std::mt19937_64 rng{0xc0ffee};
+    std::uniform_int_distribution<u64> address{0, 0x20000};
+    std::uniform_int_distribution<u64> size{1, 0x2000};
+
+    Common::OverlapRangeSet<u64> set;
+    ReferenceOverlapSet reference;
+    for (int i = 0; i < 10000; ++i) {
+        const u64 begin = address(rng);
+        const u64 length = size(rng);
+        switch (rng() % 4) {
+        case 0:
+        case 1:
+            set.Add(begin, length);
+            reference += std::make_pair(ReferenceInterval{begin, begin + length}, 1);
+            break;
+        case 2: {
+            Ranges deleted;
+            Ranges expected_deleted;
+            set.Subtract(begin, length, [&](u64 lower, u64 upper) {
+                deleted.emplace_back(lower, upper);
+            });
+            SubtractReference(reference, begin, length, 1, &expected_deleted);
+            REQUIRE(deleted == expected_deleted);
+            break;
+        }
+        default:
+            set.DeleteAll(begin, length);
+            SubtractReference(reference, begin, length, std::numeric_limits<s32>::max(), nullptr);
+            break;
+        }
+        if (i % 256 == 0) {
+            REQUIRE(Collect(set) == Collect(reference));
+        }
+    }
+    REQUIRE(Collect(set) == Collect(reference));
+}
@@ -0,0 +1,63 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+#include "common/task_scheduler.h"
+
+namespace Common {
+
+TEST_CASE("TaskScheduler: Nested groups", "[common]") {
+    TaskScheduler scheduler{4, "TestWorker"};
+    std::atomic<int> count{0};
+    TaskGroup group{TaskPriority::High, TaskGroup::Unbounded, scheduler};
+    for (int i = 0; i < 1000; ++i) {
+        group.QueueWork([&] {
+            // Waiting from inside a task must not deadlock when every worker does it.
+            TaskGroup nested{TaskPriority::Normal, TaskGroup::Unbounded, scheduler};
+            for (int j = 0; j < 3; ++j) {
+                nested.QueueWork([&] { ++count; });
+            }
+            nested.Wait();
+        });
+    }
+    group.Wait();
+    REQUIRE(count == 3000);
+}
+
+TEST_CASE("TaskScheduler: Serial group keeps order", "[common]") {
+    TaskScheduler scheduler{4, "TestWorker"};
+    std::vector<int> order;
+    TaskGroup serial{TaskPriority::Low, 1, scheduler};
+    for (int i = 0; i < 1000; ++i) {
+        serial.QueueWork([&order, i] { order.push_back(i); });
+    }
+    serial.Wait();
+    REQUIRE(order.size() == 1000);
+    for (int i = 0; i < 1000; ++i) {
+        REQUIRE(order[i] == i);
+    }
+}
+
+TEST_CASE("TaskScheduler: Cancellation", "[common]") {
+    TaskScheduler scheduler{2, "TestWorker"};
+    std::atomic<int> count{0};
+    {
+        TaskGroup group{TaskPriority::Normal, 1, scheduler};
+        for (int i = 0; i < 1000; ++i) {
+            group.QueueWork([&] {
+                std::this_thread::sleep_for(std::chrono::microseconds{100});
+                ++count;
+            });
+        }
+        std::stop_source stop_source;
+        stop_source.request_stop();
+        group.Wait(stop_source.get_token());
+    }
+    REQUIRE(count < 1000);
+}
+
+} // namespace Common
@@ -1,18 +1,26 @@
 // SPDX-FileCopyrightText: 2016 Dolphin Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
 
 #include <array>
+#include <atomic>
 #include <bitset>
 #include <chrono>
 #include <cstdlib>
 #include <memory>
 #include <optional>
+#include <random>
+#include <set>
 #include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
 
 #include "core/core.h"
 #include "core/core_timing.h"
+#include "core/timing_wheel.h"
 
 namespace {
 // Numbers are chosen randomly to make sure the correct one is given.
@@ -139,3 +147,94 @@ TEST_CASE("CoreTiming[BasicOrderNoPausing]", "[core]") {
     printf("HostTimer No Pausing Timer Time: %.3f %.6f\n", timer_time / 1000.f,
            timer_time / 1000000.f);
 }
+
+TEST_CASE("CoreTiming[TimingWheelOrder]", "[core]") {
+    std::vector<std::shared_ptr<Core::Timing::EventType>> events;
+    for (std::size_t i = 0; i < 8; i++) {
+        events.push_back(Core::Timing::CreateEvent("event", HostCallbackTemplate<0>));
+    }
+
+    // Compare against a sorted set with delays spanning every level of the wheel.
+    std::mt19937_64 rng{1234};
+    Core::Timing::TimingWheel wheel;
+    std::set<std::tuple<s64, u64, std::size_t>> reference;
+    u64 fifo = 0;
+    s64 now = 0;
+    for (std::size_t step = 0; step < 20000; step++) {
+        const u64 op = rng() % 8;
+        if (op < 4) {
+            const std::size_t type = rng() % events.size();
+            const s64 time = now + static_cast<s64>(rng() % (1ULL << (10 + rng() % 40)));
+            wheel.Insert({time, fifo, events[type], 0}, events[type].get());
+            reference.emplace(time, fifo++, type);
+        } else if (op == 4) {
+            const std::size_t type = rng() % events.size();
+            wheel.RemoveType(events[type].get());
+            std::erase_if(reference, [type](const auto& entry) { return std::get<2>(entry) == type; });
+        } else {
+            now += static_cast<s64>(rng() % 200000);
+            while (const auto handle = wheel.PopDue(now)) {
+                REQUIRE(!reference.empty());
+                const auto& [time, order, type] = *reference.begin();
+                REQUIRE(wheel.Get(*handle).time == time);
+                REQUIRE(wheel.Get(*handle).fifo_order == order);
+                reference.erase(reference.begin());
+                wheel.Free(*handle);
+            }
+            REQUIRE((reference.empty() || std::get<0>(*reference.begin()) > now));
+        }
+        REQUIRE(wheel.Size() == reference.size());
+    }
+}
+
+TEST_CASE("CoreTiming[LoopingEvents]", "[.][benchmark]") {
+    constexpr std::size_t num_events = 4096;
+    static std::atomic<u64> num_callbacks;
+    num_callbacks = 0;
+
+    ScopeInit guard;
+    auto& core_timing = guard.core_timing;
+    core_timing.SyncPause(true);
+    core_timing.SyncPause(false);
+
+    std::vector<std::shared_ptr<Core::Timing::EventType>> events;
+    for (std::size_t i = 0; i < num_events; i++) {
+        events.push_back(Core::Timing::CreateEvent(
+            "looping", [](s64, std::chrono::nanoseconds) -> std::optional<std::chrono::nanoseconds> {
+                num_callbacks.fetch_add(1, std::memory_order::relaxed);
+                return std::nullopt;
+            }));
+    }
+
+    // Periods between 50us and 16ms, similar to audio, vsync and service timers.
+    for (std::size_t i = 0; i < num_events; i++) {
+        const auto period = std::chrono::microseconds{50 + (i * 7919) % 16000};
+        core_timing.ScheduleLoopingEvent(period, period, events[i]);
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds{500});
+    for (const auto& event : events) {
+        core_timing.UnscheduleEvent(event);
+    }
+    printf("HostTimer Looping Events: %llu callbacks in 500ms\n",
+           static_cast<unsigned long long>(num_callbacks.load()));
+
+    Core::Timing::TimingWheel wheel;
+    BENCHMARK("TimingWheel schedule and pop 4096 looping events") {
+        s64 now = 0;
+        for (std::size_t i = 0; i < num_events; i++) {
+            wheel.Insert({static_cast<s64>(i * 7919 % 16000000), i, events[i], 1},
+                         events[i].get());
+        }
+        u64 popped = 0;
+        for (std::size_t round = 0; round < 16; round++) {
+            now += 1000000;
+            while (const auto handle = wheel.PopDue(now)) {
+                const auto& event = wheel.Get(*handle);
+                wheel.Reinsert(*handle, event.time + 16000000, event.fifo_order + num_events, 1);
+                ++popped;
+            }
+        }
+        wheel.Clear();
+        return popped;
+    };
+}
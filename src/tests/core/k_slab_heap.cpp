@@ -0,0 +1,104 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <set>
+#include <thread>
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+#include "core/hle/kernel/k_slab_heap.h"
+
+namespace Kernel {
+
+namespace {
+
+struct Object {
+    u64 data[4];
+};
+
+constexpr size_t NumObjects = 256;
+
+} // Anonymous namespace
+
+TEST_CASE("KSlabHeap: Objects cached by other threads can be allocated", "[core]") {
+    std::vector<Object> memory(NumObjects);
+    KSlabHeap<Object> heap;
+    heap.Initialize(memory.data(), memory.size() * sizeof(Object));
+
+    // Free every object from threads that exit, leaving some of them in their caches.
+    std::vector<Object*> objects;
+    for (size_t i = 0; i < NumObjects; i++) {
+        objects.push_back(heap.Allocate());
+        REQUIRE(objects.back() != nullptr);
+    }
+    REQUIRE(heap.Allocate() == nullptr);
+    for (size_t i = 0; i < 4; i++) {
+        std::thread{[&, i] {
+            for (size_t j = i; j < NumObjects; j += 4) {
+                heap.Free(objects[j]);
+            }
+        }}.join();
+    }
+
+    std::set<Object*> allocated;
+    for (size_t i = 0; i < NumObjects; i++) {
+        Object* const obj = heap.Allocate();
+        REQUIRE(obj != nullptr);
+        REQUIRE(allocated.insert(obj).second);
+    }
+    REQUIRE(heap.Allocate() == nullptr);
+}
+
+TEST_CASE("KSlabHeap: Concurrent allocations are unique", "[core]") {
+    std::vector<Object> memory(NumObjects);
+    KSlabHeap<Object> heap;
+    heap.Initialize(memory.data(), memory.size() * sizeof(Object));
+
+    constexpr size_t NumThreads = 4;
+    constexpr size_t PerThread = NumObjects / NumThreads;
+    std::array<bool, NumThreads> failed{};
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < NumThreads; i++) {
+        threads.emplace_back([&, i] {
+            std::vector<Object*> held;
+            for (size_t round = 0; round < 2000; round++) {
+                while (held.size() < PerThread) {
+                    Object* const obj = heap.Allocate();
+                    if (obj == nullptr) {
+                        failed[i] = true;
+                        return;
+                    }
+                    // Stamp the object, a double allocation shows as a foreign stamp.
+                    obj->data[0] = i;
+                    held.push_back(obj);
+                }
+                for (Object* obj : held) {
+                    if (obj->data[0] != i) {
+                        failed[i] = true;
+                    }
+                }
+                // Free a varying part, so that objects move between threads' caches.
+                const size_t count = (round * 7 + i) % PerThread + 1;
+                for (size_t j = 0; j < count; j++) {
+                    heap.Free(held.back());
+                    held.pop_back();
+                }
+            }
+            for (Object* obj : held) {
+                heap.Free(obj);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    REQUIRE(std::ranges::none_of(failed, [](bool value) { return value; }));
+
+    for (size_t i = 0; i < NumObjects; i++) {
+        REQUIRE(heap.Allocate() != nullptr);
+    }
+    REQUIRE(heap.Allocate() == nullptr);
+}
+
+} // namespace Kernel
@@ -10,6 +10,7 @@
 #include <memory>
 #include <numeric>
 
+#include "common/allocation_profiler.h"
 #include "common/range_sets.inc"
 #include "video_core/buffer_cache/buffer_cache_base.h"
 #include "video_core/guest_memory.h"
@@ -337,6 +338,7 @@ void BufferCache<P>::DisableGraphicsUniformBuffer(size_t stage, u32 index) {
 
 template <class P>
 void BufferCache<P>::UpdateGraphicsBuffers(bool is_indexed) {
+    ALLOCATION_SCOPE(BufferCache);
     do {
         channel_state->has_deleted_buffers = false;
         DoUpdateGraphicsBuffers(is_indexed);
@@ -345,6 +347,7 @@ void BufferCache<P>::UpdateGraphicsBuffers(bool is_indexed) {
 
 template <class P>
 void BufferCache<P>::UpdateComputeBuffers() {
+    ALLOCATION_SCOPE(BufferCache);
     do {
         channel_state->has_deleted_buffers = false;
         DoUpdateComputeBuffers();
@@ -536,9 +539,7 @@ void BufferCache<P>::CommitAsyncFlushesHigh() {
         auto& current_intervals = *it;
         auto next_it = std::next(it);
         while (next_it != committed_gpu_modified_ranges.end()) {
-            next_it->ForEach([&current_intervals](DAddr start, DAddr end) {
-                current_intervals.Subtract(start, end - start);
-            });
+            current_intervals.Subtract(*next_it);
             next_it++;
         }
         it++;
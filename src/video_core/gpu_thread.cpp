@@ -4,10 +4,14 @@
 // SPDX-FileCopyrightText: Copyright 2019 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <array>
+
+#include "common/allocation_profiler.h"
 #include "common/assert.h"
 #include "common/scope_exit.h"
 #include "common/settings.h"
 #include "common/thread.h"
+#include "common/tracing.h"
 #include "core/core.h"
 #include "core/frontend/graphics_context.h"
 #include "video_core/control/scheduler.h"
@@ -26,34 +30,39 @@ static void RunThread(std::stop_token stop_token, Core::System& system,
     Common::SetCurrentThreadName("GPU");
     Common::SetCurrentThreadPriority(Common::ThreadPriority::Critical);
     system.RegisterHostThread();
+    ALLOCATION_SCOPE(GPUThread);
 
     auto current_context = context.Acquire();
     VideoCore::RasterizerInterface* const rasterizer = renderer.ReadRasterizer();
 
-    CommandDataContainer next;
+    // Commands are popped in batches, one queue handoff covers every command in the batch.
+    std::array<CommandDataContainer, 32> batch;
 
     while (!stop_token.stop_requested()) {
-        state.queue.PopWait(next, stop_token);
-        if (stop_token.stop_requested()) {
-            break;
-        }
-        if (auto* submit_list = std::get_if<SubmitListCommand>(&next.data)) {
-            scheduler.Push(submit_list->channel, std::move(submit_list->entries));
-        } else if (std::holds_alternative<GPUTickCommand>(next.data)) {
-            system.GPU().TickWork();
-        } else if (const auto* flush = std::get_if<FlushRegionCommand>(&next.data)) {
-            rasterizer->FlushRegion(flush->addr, flush->size);
-        } else if (const auto* invalidate = std::get_if<InvalidateRegionCommand>(&next.data)) {
-            rasterizer->OnCacheInvalidation(invalidate->addr, invalidate->size);
-        } else {
-            ASSERT(false);
-        }
-        state.signaled_fence.store(next.fence);
-        if (next.block) {
-            // We have to lock the write_lock to ensure that the condition_variable wait not get a
-            // race between the check and the lock itself.
-            std::scoped_lock lk{state.write_lock};
-            state.cv.notify_all();
+        const size_t count = state.queue.PopRangeWait(batch, stop_token);
+        for (size_t i = 0; i < count && !stop_token.stop_requested(); ++i) {
+            CommandDataContainer& next = batch[i];
+            TRACE_ZONE_ARG("gpu", "GPU::Command", "fence", next.fence);
+            TRACE_FLOW_END("gpu", "GPU command", next.fence);
+            if (auto* submit_list = std::get_if<SubmitListCommand>(&next.data)) {
+                TRACE_ZONE("gpu", "GPU::Pushbuffer");
+                scheduler.Push(submit_list->channel, std::move(submit_list->entries));
+            } else if (std::holds_alternative<GPUTickCommand>(next.data)) {
+                system.GPU().TickWork();
+            } else if (const auto* flush = std::get_if<FlushRegionCommand>(&next.data)) {
+                rasterizer->FlushRegion(flush->addr, flush->size);
+            } else if (const auto* invalidate = std::get_if<InvalidateRegionCommand>(&next.data)) {
+                rasterizer->OnCacheInvalidation(invalidate->addr, invalidate->size);
+            } else {
+                ASSERT(false);
+            }
+            state.signaled_fence.store(next.fence);
+            if (next.block) {
+                // We have to lock the write_lock to ensure that the condition_variable wait not
+                // get a race between the check and the lock itself.
+                std::scoped_lock lk{state.write_lock};
+                state.cv.notify_all();
+            }
         }
     }
 }
@@ -97,6 +106,7 @@ void ThreadManager::FlushAndInvalidateRegion(DAddr addr, u64 size) {
 }
 
 u64 ThreadManager::PushCommand(CommandData&& command_data, bool block) {
+    TRACE_ZONE("gpu", "GPU::PushCommand");
     if (!is_async) {
         // In synchronous GPU mode, block the caller until the command has executed
         block = true;
@@ -104,6 +114,7 @@ u64 ThreadManager::PushCommand(CommandData&& command_data, bool block) {
 
     std::unique_lock lk(state.write_lock);
     const u64 fence{++state.last_fence};
+    TRACE_FLOW_BEGIN("gpu", "GPU command", fence);
     state.queue.EmplaceWait(std::move(command_data), fence, block);
 
     if (block) {
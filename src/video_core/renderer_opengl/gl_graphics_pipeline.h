@@ -12,8 +12,8 @@
 #include <utility>
 
 #include "common/bit_field.h"
-#include "common/cityhash.h"
 #include "common/common_types.h"
+#include "common/xxh3.h"
 #include "shader_recompiler/shader_info.h"
 #include "video_core/engines/maxwell_3d.h"
 #include "video_core/renderer_opengl/gl_buffer_cache.h"
@@ -49,7 +49,7 @@ struct GraphicsPipelineKey {
     VideoCommon::TransformFeedbackState xfb_state;
 
     size_t Hash() const noexcept {
-        return static_cast<size_t>(Common::CityHash64(reinterpret_cast<const char*>(this), Size()));
+        return static_cast<size_t>(Common::XXH3Hash64(this, Size()));
     }
 
     bool operator==(const GraphicsPipelineKey& rhs) const noexcept {
@@ -9,9 +9,9 @@
 #include <bit>
 #include <numeric>
 #include <ranges>
-#include "common/cityhash.h"
 #include "common/common_types.h"
 #include "common/settings.h"
+#include "common/xxh3.h"
 #include "video_core/engines/draw_manager.h"
 #include "video_core/renderer_vulkan/fixed_pipeline_state.h"
 #include "video_core/renderer_vulkan/vk_state_tracker.h"
@@ -286,7 +286,7 @@ void FixedPipelineState::DynamicState::Refresh3(const Maxwell& regs) {
 }
 
 size_t FixedPipelineState::Hash() const noexcept {
-    const u64 hash = Common::CityHash64(reinterpret_cast<const char*>(this), Size());
+    const u64 hash = Common::XXH3Hash64(this, Size());
     return static_cast<size_t>(hash);
 }
 
@@ -14,10 +14,12 @@
 
 #include <fmt/ranges.h>
 
+#include "common/allocation_profiler.h"
 #include "common/logging/log.h"
 #include <ranges>
 #include "common/scope_exit.h"
 #include "common/settings.h"
+#include "common/tracing.h"
 #include "core/core_timing.h"
 #include "core/frontend/graphics_context.h"
 #include "video_core/capture.h"
@@ -181,6 +183,8 @@ RendererVulkan::~RendererVulkan() {
 }
 
 void RendererVulkan::Composite(std::span<const Tegra::FramebufferConfig> framebuffers) {
+    TRACE_ZONE("present", "RendererVulkan::Composite");
+    ALLOCATION_SCOPE(Renderer);
     SCOPE_EXIT {
         render_window.OnFrameDisplayed();
     };
@@ -12,7 +12,7 @@
 #include <vector>
 
 #include "common/common_types.h"
-#include "common/thread_worker.h"
+#include "common/task_scheduler.h"
 #include "shader_recompiler/frontend/ir/basic_block.h"
 #include "shader_recompiler/frontend/ir/value.h"
 #include "shader_recompiler/frontend/maxwell/control_flow.h"
@@ -168,8 +168,8 @@ private:
     std::filesystem::path vulkan_pipeline_cache_filename;
     vk::PipelineCache vulkan_pipeline_cache;
 
-    Common::ThreadWorker workers;
-    Common::ThreadWorker serialization_thread;
+    Common::TaskGroup workers;
+    Common::TaskGroup serialization_queue;
     DynamicFeatures dynamic_features;
 };
 
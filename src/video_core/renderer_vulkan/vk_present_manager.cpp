@@ -6,6 +6,7 @@
 
 #include "common/settings.h"
 #include "common/thread.h"
+#include "common/tracing.h"
 #include "core/frontend/emu_window.h"
 #include "video_core/renderer_vulkan/vk_present_manager.h"
 #include "video_core/renderer_vulkan/vk_scheduler.h"
@@ -315,6 +316,7 @@ void PresentManager::SetImageCount() {
 }
 
 void PresentManager::CopyToSwapchain(Frame* frame) {
+    TRACE_ZONE("present", "PresentManager::CopyToSwapchain");
     bool requires_recreation = false;
 
     while (true) {
@@ -12,6 +12,7 @@
 #include "video_core/renderer_vulkan/vk_query_cache.h"
 
 #include "common/thread.h"
+#include "common/tracing.h"
 #include "video_core/renderer_vulkan/vk_command_pool.h"
 #include "video_core/renderer_vulkan/vk_master_semaphore.h"
 #include "video_core/renderer_vulkan/vk_scheduler.h"
@@ -181,6 +182,7 @@ void Scheduler::WorkerThread(std::stop_token stop_token) {
             // Perform the work, tracking whether the chunk was a submission
             // before executing.
             const bool has_submit = work->HasSubmit();
+            TRACE_ZONE("vulkan", "Scheduler::ExecuteChunk");
             work->ExecuteAll(current_cmdbuf, current_upload_cmdbuf);
 
             // If the chunk was a submission, reallocate the command buffer.
@@ -12,12 +12,12 @@
 #include <utility>
 
 #include "common/assert.h"
-#include "common/cityhash.h"
 #include "common/common_types.h"
 #include "common/div_ceil.h"
 #include "common/fs/fs.h"
 #include "common/fs/path_util.h"
 #include "common/logging/log.h"
+#include "common/xxh3.h"
 #include <ranges>
 #include "shader_recompiler/environment.h"
 #include "video_core/engines/kepler_compute.h"
@@ -159,7 +159,7 @@ std::optional<u64> GenericEnvironment::Analyze() {
     }
     cached_lowest = start_address;
     cached_highest = start_address + static_cast<u32>(*size);
-    return Common::CityHash64(reinterpret_cast<const char*>(code.data()), *size);
+    return Common::XXH3Hash64(code.data(), *size);
 }
 
 void GenericEnvironment::SetCachedSize(size_t size_bytes) {
@@ -189,7 +189,7 @@ u64 GenericEnvironment::CalculateHash() const {
     const size_t size{ReadSizeBytes()};
     const auto data{std::make_unique<char[]>(size)};
     gpu_memory->ReadBlock(program_base + read_lowest, data.get(), size);
-    return Common::CityHash64(data.get(), size);
+    return Common::XXH3Hash64(data.get(), size);
 }
 
 void GenericEnvironment::Dump(u64 pipeline_hash, u64 shader_hash) {
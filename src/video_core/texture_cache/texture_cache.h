@@ -10,6 +10,7 @@
 #include <boost/container/small_vector.hpp>
 
 #include "common/alignment.h"
+#include "common/allocation_profiler.h"
 #include "common/settings.h"
 #include "video_core/control/channel_state.h"
 #include "video_core/dirty_flags.h"
@@ -295,6 +296,7 @@ typename P::Sampler& TextureCache<P>::GetSampler(SamplerId id) noexcept {
 
 template <class P>
 void TextureCache<P>::SynchronizeGraphicsDescriptors() {
+    ALLOCATION_SCOPE(TextureCache);
     using SamplerBinding = Tegra::Engines::Maxwell3D::Regs::SamplerBinding;
     const bool linked_tsc = maxwell3d->regs.sampler_binding == SamplerBinding::ViaHeaderBinding;
     const u32 tic_limit = maxwell3d->regs.tex_header.limit;
@@ -311,6 +313,7 @@ void TextureCache<P>::SynchronizeGraphicsDescriptors() {
 
 template <class P>
 void TextureCache<P>::SynchronizeComputeDescriptors() {
+    ALLOCATION_SCOPE(TextureCache);
     const bool linked_tsc = kepler_compute->launch_description.linked_tsc;
     const u32 tic_limit = kepler_compute->regs.tic.limit;
     const u32 tsc_limit = linked_tsc ? tic_limit : kepler_compute->regs.tsc.limit;
@@ -422,6 +425,7 @@ bool TextureCache<P>::RescaleRenderTargets() {
 
 template <class P>
 void TextureCache<P>::UpdateRenderTargets(bool is_clear) {
+    ALLOCATION_SCOPE(TextureCache);
     using namespace VideoCommon::Dirty;
     auto& flags = maxwell3d->dirty.flags;
     if (!flags[Dirty::RenderTargets]) {
@@ -25,7 +25,7 @@
 #include <ranges>
 #include "common/scratch_buffer.h"
 #include "common/slot_vector.h"
-#include "common/thread_worker.h"
+#include "common/task_scheduler.h"
 #include "video_core/compatible_formats.h"
 #include "video_core/control/channel_state_cache.h"
 #include "video_core/delayed_destruction_ring.h"
@@ -501,8 +501,9 @@ private:
     u64 modification_tick = 0;
     u64 frame_tick = 0;
 
-    Common::ThreadWorker texture_decode_worker{1, "TextureDecoder"};
     std::vector<std::unique_ptr<AsyncDecodeContext>> async_decodes;
+    // Declared after the decode contexts so running decodes finish before those are destroyed
+    Common::TaskGroup texture_decode_worker{Common::TaskPriority::Normal, 1};
 
     // Join caching
     boost::container::small_vector<ImageId, 4> join_overlap_ids;
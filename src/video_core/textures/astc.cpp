@@ -18,9 +18,9 @@
 
 #include "common/alignment.h"
 #include "common/common_types.h"
+#include "common/task_scheduler.h"
 #include <ranges>
 #include "video_core/textures/astc.h"
-#include "video_core/textures/workers.h"
 
 class InputBitStream {
 public:
@@ -1659,7 +1659,7 @@ void Decompress(std::span<const uint8_t> data, uint32_t width, uint32_t height,
     const u32 rows = Common::DivideUp(height, block_height);
     const u32 cols = Common::DivideUp(width, block_width);
 
-    Common::ThreadWorker& workers{GetThreadWorkers()};
+    Common::TaskGroup workers{Common::TaskPriority::High};
 
     for (u32 z = 0; z < depth; ++z) {
         const u32 depth_offset = z * height * width * 4;
@@ -1689,7 +1689,7 @@ void Decompress(std::span<const uint8_t> data, uint32_t width, uint32_t height,
             };
             workers.QueueWork(std::move(decompress_stride));
         }
-        workers.WaitForRequests();
+        workers.Wait();
     }
 }
 
@@ -6,8 +6,8 @@
 
 #include <array>
 
-#include "common/cityhash.h"
 #include "common/settings.h"
+#include "common/xxh3.h"
 #include "video_core/textures/texture.h"
 
 using Tegra::Texture::TICEntry;
@@ -97,9 +97,9 @@ float TSCEntry::MaxAnisotropy() const noexcept {
 } // namespace Tegra::Texture
 
 size_t std::hash<TICEntry>::operator()(const TICEntry& tic) const noexcept {
-    return Common::CityHash64(reinterpret_cast<const char*>(&tic), sizeof tic);
+    return Common::XXH3Hash64(&tic, sizeof tic);
 }
 
 size_t std::hash<TSCEntry>::operator()(const TSCEntry& tsc) const noexcept {
-    return Common::CityHash64(reinterpret_cast<const char*>(&tsc), sizeof tsc);
+    return Common::XXH3Hash64(&tsc, sizeof tsc);
 }
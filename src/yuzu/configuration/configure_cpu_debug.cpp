@@ -34,6 +34,16 @@ void ConfigureCpuDebug::SetConfiguration() {
     ui->cpuopt_const_prop->setChecked(Settings::values.cpuopt_const_prop.GetValue());
     ui->cpuopt_misc_ir->setEnabled(runtime_lock);
     ui->cpuopt_misc_ir->setChecked(Settings::values.cpuopt_misc_ir.GetValue());
+    ui->cpuopt_trace_formation->setEnabled(runtime_lock);
+    ui->cpuopt_trace_formation->setChecked(Settings::values.cpuopt_trace_formation.GetValue());
+    ui->cpuopt_tiered_compilation->setEnabled(runtime_lock);
+    ui->cpuopt_tiered_compilation->setChecked(
+        Settings::values.cpuopt_tiered_compilation.GetValue());
+    ui->cpuopt_live_interval_regalloc->setEnabled(runtime_lock);
+    ui->cpuopt_live_interval_regalloc->setChecked(
+        Settings::values.cpuopt_live_interval_regalloc.GetValue());
+    ui->cpuopt_memory_forwarding->setEnabled(runtime_lock);
+    ui->cpuopt_memory_forwarding->setChecked(Settings::values.cpuopt_memory_forwarding.GetValue());
     ui->cpuopt_reduce_misalign_checks->setEnabled(runtime_lock);
     ui->cpuopt_reduce_misalign_checks->setChecked(
         Settings::values.cpuopt_reduce_misalign_checks.GetValue());
@@ -58,6 +68,11 @@ void ConfigureCpuDebug::ApplyConfiguration() {
     Settings::values.cpuopt_context_elimination = ui->cpuopt_context_elimination->isChecked();
     Settings::values.cpuopt_const_prop = ui->cpuopt_const_prop->isChecked();
     Settings::values.cpuopt_misc_ir = ui->cpuopt_misc_ir->isChecked();
+    Settings::values.cpuopt_trace_formation = ui->cpuopt_trace_formation->isChecked();
+    Settings::values.cpuopt_tiered_compilation = ui->cpuopt_tiered_compilation->isChecked();
+    Settings::values.cpuopt_live_interval_regalloc =
+        ui->cpuopt_live_interval_regalloc->isChecked();
+    Settings::values.cpuopt_memory_forwarding = ui->cpuopt_memory_forwarding->isChecked();
     Settings::values.cpuopt_reduce_misalign_checks = ui->cpuopt_reduce_misalign_checks->isChecked();
     Settings::values.cpuopt_fastmem = ui->cpuopt_fastmem->isChecked();
     Settings::values.cpuopt_fastmem_exclusives = ui->cpuopt_fastmem_exclusives->isChecked();
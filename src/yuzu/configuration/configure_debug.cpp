@@ -46,6 +46,12 @@ void ConfigureDebug::SetConfiguration() {
     ui->dump_audio_commands->setChecked(Settings::values.dump_audio_commands.GetValue());
     ui->quest_flag->setChecked(Settings::values.quest_flag.GetValue());
     ui->use_debug_asserts->setChecked(Settings::values.use_debug_asserts.GetValue());
+#ifdef YUZU_TRACING
+    ui->enable_tracing->setChecked(Settings::values.enable_tracing.GetValue());
+#else
+    ui->enable_tracing->setVisible(false);
+#endif
+    ui->enable_call_stats->setChecked(Settings::values.enable_call_stats.GetValue());
     ui->use_auto_stub->setChecked(Settings::values.use_auto_stub.GetValue());
     ui->enable_all_controllers->setChecked(Settings::values.enable_all_controllers.GetValue());
     ui->extended_logging->setChecked(Settings::values.extended_logging.GetValue());
@@ -110,6 +116,8 @@ void ConfigureDebug::ApplyConfiguration() {
     Settings::values.dump_audio_commands = ui->dump_audio_commands->isChecked();
     Settings::values.quest_flag = ui->quest_flag->isChecked();
     Settings::values.use_debug_asserts = ui->use_debug_asserts->isChecked();
+    Settings::values.enable_tracing = ui->enable_tracing->isChecked();
+    Settings::values.enable_call_stats = ui->enable_call_stats->isChecked();
     Settings::values.use_auto_stub = ui->use_auto_stub->isChecked();
     Settings::values.enable_all_controllers = ui->enable_all_controllers->isChecked();
     Settings::values.renderer_debug = ui->enable_graphics_debugging->isChecked();
@@ -517,6 +517,9 @@ void SvcWrap_SendSyncRequestLight64(Core::System& system, std::span<uint64_t, 8>
 void SvcWrap_CallSecureMonitor64From32(Core::System& system, std::span<uint64_t, 8> args);
 void SvcWrap_CallSecureMonitor64(Core::System& system, std::span<uint64_t, 8> args);
 
+// Returns the name of a supervisor call, or nullptr if there is none with that index.
+const char* GetSvcName(u32 imm);
+
 // Perform a supervisor call by index.
 void Call(Core::System& system, u32 imm);
 
@@ -526,7 +529,10 @@ void Call(Core::System& system, u32 imm);
 PROLOGUE_CPP = """
 #include <type_traits>
 
+#include "common/allocation_profiler.h"
+#include "common/tracing.h"
 #include "core/arm/arm_interface.h"
+#include "core/call_stats.h"
 #include "core/core.h"
 #include "core/hle/kernel/k_process.h"
 #include "core/hle/kernel/svc.h"
@@ -573,12 +579,15 @@ void Call(Core::System& system, u32 imm) {
         imm,
         GetArg32(args, 0), GetArg32(args, 1), GetArg32(args, 2),
         GetArg32(args, 3), GetArg32(args, 4), GetArg32(args, 5), GetArg32(args, 6));
-    //kernel.EnterSVCProfile();
+    TRACE_ZONE_ARG("kernel", "SVC", "id", imm);
+    ALLOCATION_SCOPE(Kernel);
+    auto& call_stats = system.GetCallStats();
+    const u64 call_start = call_stats.Begin();
     if (process.Is64Bit())
         Call64(system, imm, args);
     else
         Call32(system, imm, args);
-    //kernel.ExitSVCProfile();
+    call_stats.EndSvc(imm, call_start);
     kernel.CurrentPhysicalCore().LoadSvcArguments(process, args);
 }
 
@@ -604,6 +613,23 @@ def emit_call(bitness, names, suffix):
     return "\n".join(lines)
 
 
+def emit_names(names):
+    indent = "    "
+    lines = [
+        "const char* GetSvcName(u32 imm) {",
+        f"{indent}switch (SvcId(imm)) {{"
+    ]
+
+    for _, name in names:
+        lines.append(f"{indent}case SvcId::{name}: return \"{name}\";")
+
+    lines.append(f"{indent}default: return nullptr;")
+    lines.append(f"{indent}}}")
+    lines.append("}")
+
+    return "\n".join(lines)
+
+
 def build_fn_declaration(return_type, name, arguments):
     arg_list = ["Core::System& system"]
     for arg in arguments:
@@ -660,6 +686,7 @@ def main():
 
     call_32 = emit_call(BIT_32, names, SUFFIX_NAMES[BIT_32])
     call_64 = emit_call(BIT_64, names, SUFFIX_NAMES[BIT_64])
+    svc_names = emit_names(names)
     enum_decls = build_enum_declarations()
 
     with open("src/core/hle/kernel/svc.h", "w") as f:
@@ -684,6 +711,8 @@ def main():
         f.write(call_32)
         f.write("\n\n")
         f.write(call_64)
+        f.write("\n\n")
+        f.write(svc_names)
         f.write(EPILOGUE_CPP)
 
     print(f"Done (emitted {len(names)} definitions)")